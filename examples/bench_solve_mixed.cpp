@@ -0,0 +1,124 @@
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <armadillo>
+
+using namespace std;
+using namespace arma;
+
+// Benchmark of solve() with solve_opts::mixed against the full double precision solvers,
+// for square systems with n = 1000 to 20000 (by default).
+//
+// For each size, two systems are solved:
+// - a well conditioned system, where the single precision factorisation and the iterative refinement succeed;
+//   this shows the crossover against the double precision solver
+// - a poorly conditioned system (rcond around 1e-10), where the refinement does not converge
+//   and solve() falls back to the double precision solver; this shows the cost of the fallback
+//
+// The speedup depends on the BLAS/LAPACK library and on the number of threads it uses;
+// set the number of threads via the environment, eg. OPENBLAS_NUM_THREADS or OMP_NUM_THREADS.
+//
+// Memory use is about 3 copies of an n x n double precision matrix, ie. about 10 GB for n = 20000;
+// the largest size can be given as the first argument, eg. ./bench_solve_mixed 10000
+//
+// Compile with, for example:
+//   g++ bench_solve_mixed.cpp -o bench_solve_mixed -std=c++11 -O2 -I ../include -DARMA_DONT_USE_WRAPPER -DARMA_NO_DEBUG -lopenblas
+
+
+// relative backward error ||A*x - b|| / (||A|| * ||x|| + ||b||), with 1-norms
+inline
+double
+backward_error(const mat& A, const vec& x, const vec& b)
+  {
+  return norm(A*x - b, 1) / (norm(A, 1) * norm(x, 1) + norm(b, 1));
+  }
+
+
+
+inline
+void
+run(const mat& A, const vec& b, const char* label)
+  {
+  wall_clock timer;
+  
+  vec x_full;
+  vec x_fast;
+  vec x_mixed;
+  
+  timer.tic();
+  const bool status_full  = solve(x_full, A, b);
+  const double t_full     = timer.toc();
+  
+  timer.tic();
+  const bool status_fast  = solve(x_fast, A, b, solve_opts::fast);
+  const double t_fast     = timer.toc();
+  
+  timer.tic();
+  const bool status_mixed = solve(x_mixed, A, b, solve_opts::mixed);
+  const double t_mixed    = timer.toc();
+  
+  cout << setw(6) << A.n_rows << "  " << setw(5) << label;
+  
+  cout << fixed << setprecision(3);
+  
+  cout << "  " << setw(9) << t_full;
+  cout << "  " << setw(9) << t_fast;
+  cout << "  " << setw(9) << t_mixed;
+  cout << "  " << setw(7) << (t_full / t_mixed);
+  cout << "  " << setw(7) << (t_fast / t_mixed);
+  
+  cout << scientific << setprecision(1);
+  
+  cout << "  " << setw(8) << ((status_full ) ? backward_error(A, x_full,  b) : datum::nan);
+  cout << "  " << setw(8) << ((status_mixed) ? backward_error(A, x_mixed, b) : datum::nan);
+  
+  cout << endl;
+  
+  if(status_fast == false)  { cout << "  (solve_opts::fast failed)" << endl; }
+  }
+
+
+
+int
+main(int argc, char** argv)
+  {
+  cout << "Armadillo version: " << arma_version::as_string() << endl;
+  
+  const uword max_n = (argc > 1) ? uword(std::atol(argv[1])) : uword(20000);
+  
+  const uword sizes[] = { 1000, 2000, 3000, 5000, 7500, 10000, 15000, 20000 };
+  
+  const char* env_threads = std::getenv("OPENBLAS_NUM_THREADS");
+  
+  cout << "OPENBLAS_NUM_THREADS: " << ((env_threads != nullptr) ? env_threads : "(not set)") << endl;
+  cout << endl;
+  
+  cout << "times in seconds; 'good' is well conditioned, 'poor' needs the fallback to double precision" << endl;
+  cout << endl;
+  cout << "     n   sys       full       fast      mixed  full/mx  fast/mx  err_full    err_mx" << endl;
+  
+  arma_rng::set_seed(123);
+  
+  for(const uword n : sizes)
+    {
+    if(n > max_n)  { break; }
+  
+    mat A(n, n, fill::randn);
+    vec b(n,    fill::randn);
+  
+    A.diag() += double(n);
+  
+    run(A, b, "good");
+  
+    // make the last column nearly a copy of the first one, so that rcond is around 1e-10;
+    // the single precision factorisation is then too inaccurate for the refinement to converge
+  
+    A.diag() -= double(n);
+  
+    A.col(n-1) = A.col(0) + 1e-10 * vec(n, fill::randn);
+  
+    run(A, b, "poor");
+    }
+  
+  return 0;
+  }
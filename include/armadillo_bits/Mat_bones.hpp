@@ -50,6 +50,8 @@ class Mat : public Base< eT, Mat<eT> >
   
   arma_align_mem eT mem_local[ arma_config::mat_prealloc ];  // local storage, for small vectors and matrices
   
+  arma_aligned struct_hint_state hint_state;  // structure hint; reset whenever the elements may be modified
+  
   
   public:
   
@@ -460,6 +462,14 @@ class Mat : public Base< eT, Mat<eT> >
   arma_warn_unused arma_inline       eT* memptr();
   arma_warn_unused arma_inline const eT* memptr() const;
   
+  inline Mat& set_hint(const struct_hint kind);
+  inline Mat& set_hint(const struct_hint kind, const uword KL, const uword KU);
+  
+  arma_warn_unused inline struct_hint get_hint() const;
+  arma_warn_unused inline struct_hint get_hint(uword& out_KL, uword& out_KU) const;
+  
+  arma_inline void reset_hint();
+  
   
   template<typename eT2, typename expr>
   inline Mat& copy_size(const Base<eT2,expr>& X);
@@ -343,6 +343,8 @@ Mat<eT>::init_warm(uword in_n_rows, uword in_n_cols)
   {
   arma_extra_debug_sigprint( arma_str::format("in_n_rows = %u, in_n_cols = %u") % in_n_rows % in_n_cols );
   
+  hint_state.reset();
+  
   if( (n_rows == in_n_rows) && (n_cols == in_n_cols) )  { return; }
   
   bool  err_state = false;
@@ -780,6 +782,8 @@ Mat<eT>::Mat(Mat<eT>&& X)
       access::rw(X.mem)    = nullptr;
       }
     }
+  
+  hint_state = X.hint_state;
   }
 
 
@@ -893,6 +897,8 @@ Mat<eT>::Mat(const Mat<eT>& in_mat)
   init_cold();
   
   arrayops::copy( memptr(), in_mat.mem, in_mat.n_elem );
+  
+  hint_state = in_mat.hint_state;
   }
 
 
@@ -910,6 +916,8 @@ Mat<eT>::operator=(const Mat<eT>& in_mat)
     init_warm(in_mat.n_rows, in_mat.n_cols);
     
     arrayops::copy( memptr(), in_mat.mem, in_mat.n_elem );
+    
+    hint_state = in_mat.hint_state;
     }
   
   return *this;
@@ -1059,6 +1067,9 @@ Mat<eT>::swap(Mat<eT>& B)
   Mat<eT>& A = (*this);
   
   arma_extra_debug_sigprint(arma_str::format("A = %x   B = %x") % &A % &B);
+  
+  const struct_hint_state A_hint = A.hint_state;
+  const struct_hint_state B_hint = B.hint_state;
 
   bool layout_ok = false;
   
@@ -1175,6 +1186,9 @@ Mat<eT>::swap(Mat<eT>& B)
       A.steal_mem(C);
       }
     }
+  
+  A.hint_state = B_hint;
+  B.hint_state = A_hint;
   }
 
 
@@ -1227,6 +1241,8 @@ Mat<eT>::steal_mem(Mat<eT>& x, const bool is_move)
     access::rw(mem_state) = x_mem_state;
     access::rw(mem)       = x.mem;
     
+    hint_state = x.hint_state;
+    
     access::rw(x.n_rows)    = (x_vec_state == 2) ? 1 : 0;
     access::rw(x.n_cols)    = (x_vec_state == 1) ? 1 : 0;
     access::rw(x.n_elem)    = 0;
@@ -3019,6 +3035,8 @@ Mat<eT>::row(const uword row_num)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds( row_num >= n_rows, "Mat::row(): index out of bounds" );
   
   return subview_row<eT>(*this, row_num);
@@ -3048,6 +3066,8 @@ Mat<eT>::operator()(const uword row_num, const span& col_span)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   const bool col_all = col_span.whole;
   
   const uword local_n_cols = n_cols;
@@ -3107,6 +3127,8 @@ Mat<eT>::col(const uword col_num)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds( col_num >= n_cols, "Mat::col(): index out of bounds" );
   
   return subview_col<eT>(*this, col_num);
@@ -3136,6 +3158,8 @@ Mat<eT>::operator()(const span& row_span, const uword col_num)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   const bool row_all = row_span.whole;
   
   const uword local_n_rows = n_rows;
@@ -3199,6 +3223,8 @@ Mat<eT>::unsafe_col(const uword col_num)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds( col_num >= n_cols, "Mat::unsafe_col(): index out of bounds" );
   
   return Col<eT>(colptr(col_num), n_rows, false, true);
@@ -3235,6 +3261,8 @@ Mat<eT>::rows(const uword in_row1, const uword in_row2)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds
     (
     (in_row1 > in_row2) || (in_row2 >= n_rows),
@@ -3277,6 +3305,8 @@ Mat<eT>::cols(const uword in_col1, const uword in_col2)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds
     (
     (in_col1 > in_col2) || (in_col2 >= n_cols),
@@ -3319,6 +3349,8 @@ Mat<eT>::rows(const span& row_span)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   const bool row_all = row_span.whole;
   
   const uword local_n_rows = n_rows;
@@ -3375,6 +3407,8 @@ Mat<eT>::cols(const span& col_span)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   const bool col_all = col_span.whole;
   
   const uword local_n_cols = n_cols;
@@ -3431,6 +3465,8 @@ Mat<eT>::submat(const uword in_row1, const uword in_col1, const uword in_row2, c
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds
     (
     (in_row1 > in_row2) || (in_col1 >  in_col2) || (in_row2 >= n_rows) || (in_col2 >= n_cols),
@@ -3475,6 +3511,8 @@ Mat<eT>::submat(const uword in_row1, const uword in_col1, const SizeMat& s)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   const uword l_n_rows = n_rows;
   const uword l_n_cols = n_cols;
   
@@ -3525,6 +3563,8 @@ Mat<eT>::submat(const span& row_span, const span& col_span)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   const bool row_all = row_span.whole;
   const bool col_all = col_span.whole;
   
@@ -3596,6 +3636,8 @@ Mat<eT>::operator()(const span& row_span, const span& col_span)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return (*this).submat(row_span, col_span);
   }
 
@@ -3620,6 +3662,8 @@ Mat<eT>::operator()(const uword in_row1, const uword in_col1, const SizeMat& s)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return (*this).submat(in_row1, in_col1, s);
   }
 
@@ -3644,6 +3688,8 @@ Mat<eT>::head_rows(const uword N)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds( (N > n_rows), "Mat::head_rows(): size out of bounds" );
   
   return subview<eT>(*this, 0, 0, N, n_cols);
@@ -3672,6 +3718,8 @@ Mat<eT>::tail_rows(const uword N)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds( (N > n_rows), "Mat::tail_rows(): size out of bounds" );
   
   const uword start_row = n_rows - N;
@@ -3704,6 +3752,8 @@ Mat<eT>::head_cols(const uword N)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds( (N > n_cols), "Mat::head_cols(): size out of bounds" );
   
   return subview_cols<eT>(*this, 0, N);
@@ -3732,6 +3782,8 @@ Mat<eT>::tail_cols(const uword N)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   arma_debug_check_bounds( (N > n_cols), "Mat::tail_cols(): size out of bounds" );
   
   const uword start_col = n_cols - N;
@@ -3765,6 +3817,8 @@ Mat<eT>::elem(const Base<uword,T1>& a)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_elem1<eT,T1>(*this, a);
   }
 
@@ -3791,6 +3845,8 @@ Mat<eT>::operator()(const Base<uword,T1>& a)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_elem1<eT,T1>(*this, a);
   }
 
@@ -3817,6 +3873,8 @@ Mat<eT>::elem(const Base<uword,T1>& ri, const Base<uword,T2>& ci)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_elem2<eT,T1,T2>(*this, ri, ci, false, false);
   }
 
@@ -3843,6 +3901,8 @@ Mat<eT>::submat(const Base<uword,T1>& ri, const Base<uword,T2>& ci)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_elem2<eT,T1,T2>(*this, ri, ci, false, false);
   }
 
@@ -3869,6 +3929,8 @@ Mat<eT>::operator()(const Base<uword,T1>& ri, const Base<uword,T2>& ci)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_elem2<eT,T1,T2>(*this, ri, ci, false, false);
   }
 
@@ -3895,6 +3957,8 @@ Mat<eT>::rows(const Base<uword,T1>& ri)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_elem2<eT,T1,T1>(*this, ri, ri, false, true);
   }
 
@@ -3921,6 +3985,8 @@ Mat<eT>::cols(const Base<uword,T2>& ci)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_elem2<eT,T2,T2>(*this, ci, ci, true, false);
   }
 
@@ -3946,6 +4012,8 @@ Mat<eT>::each_col()
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_each1< Mat<eT>, 0>(*this);
   }
 
@@ -3958,6 +4026,8 @@ Mat<eT>::each_row()
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_each1< Mat<eT>, 1>(*this);
   }
 
@@ -3995,6 +4065,8 @@ Mat<eT>::each_col(const Base<uword, T1>& indices)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_each2< Mat<eT>, 0, T1 >(*this, indices);
   }
 
@@ -4008,6 +4080,8 @@ Mat<eT>::each_row(const Base<uword, T1>& indices)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   return subview_each2< Mat<eT>, 1, T1 >(*this, indices);
   }
 
@@ -4183,6 +4257,8 @@ Mat<eT>::diag(const sword in_id)
   {
   arma_extra_debug_sigprint();
   
+  hint_state.reset();
+  
   const uword row_offset = (in_id < 0) ? uword(-in_id) : 0;
   const uword col_offset = (in_id > 0) ? uword( in_id) : 0;
   
@@ -4239,6 +4315,8 @@ Mat<eT>::swap_rows(const uword in_row1, const uword in_row2)
     "Mat::swap_rows(): index out of bounds"
     );
   
+  hint_state.reset();
+  
   if(n_elem > 0)
     {
     for(uword ucol=0; ucol < local_n_cols; ++ucol)
@@ -6173,6 +6251,8 @@ Mat<eT>::operator() (const uword ii)
   {
   arma_debug_check_bounds( (ii >= n_elem), "Mat::operator(): index out of bounds" );
   
+  hint_state.reset();
+  
   return access::rw(mem[ii]);
   }
 
@@ -6196,6 +6276,8 @@ arma_inline
 eT&
 Mat<eT>::operator[] (const uword ii)
   {
+  hint_state.reset();
+  
   return access::rw(mem[ii]);
   }
 
@@ -6218,6 +6300,8 @@ arma_inline
 eT&
 Mat<eT>::at(const uword ii)
   {
+  hint_state.reset();
+  
   return access::rw(mem[ii]);
   }
 
@@ -6242,6 +6326,8 @@ Mat<eT>::operator() (const uword in_row, const uword in_col)
   {
   arma_debug_check_bounds( ((in_row >= n_rows) || (in_col >= n_cols)), "Mat::operator(): index out of bounds" );
   
+  hint_state.reset();
+  
   return access::rw(mem[in_row + in_col*n_rows]);
   }
 
@@ -6266,6 +6352,8 @@ arma_inline
 eT&
 Mat<eT>::at(const uword in_row, const uword in_col)
   {
+  hint_state.reset();
+  
   return access::rw( mem[in_row + in_col*n_rows] );
   }
 
@@ -6290,6 +6378,8 @@ Mat<eT>::at(const uword in_row, const uword in_col) const
     eT&
   Mat<eT>::operator[] (const uword in_row, const uword in_col)
     {
+    hint_state.reset();
+    
     return access::rw( mem[in_row + in_col*n_rows] );
     }
   
@@ -6750,6 +6840,8 @@ arma_inline
 eT*
 Mat<eT>::colptr(const uword in_col)
   {
+  hint_state.reset();
+  
   return & access::rw(mem[in_col*n_rows]);
   }
 
@@ -6772,6 +6864,8 @@ arma_inline
 eT*
 Mat<eT>::memptr()
   {
+  hint_state.reset();
+  
   return const_cast<eT*>(mem);
   }
 
@@ -6788,6 +6882,80 @@ Mat<eT>::memptr() const
 
 
 
+//! declare the structure of the matrix, so that solve(), inv(), det() and log_det() can skip their detection scans;
+//! the hint is not checked, and is discarded as soon as the matrix may be modified
+template<typename eT>
+inline
+Mat<eT>&
+Mat<eT>::set_hint(const struct_hint kind)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (kind == struct_hint::band), "Mat::set_hint(): number of sub- and super-diagonals must be given for struct_hint::band" );
+  
+  return (*this).set_hint(kind, uword(0), uword(0));
+  }
+
+
+
+template<typename eT>
+inline
+Mat<eT>&
+Mat<eT>::set_hint(const struct_hint kind, const uword KL, const uword KU)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (is_square() == false), "Mat::set_hint(): matrix must be square sized" );
+  
+  // vectors have their own element accessors, which don't reset the hint
+  
+  if( (vec_state != 0) || (kind == struct_hint::none) )  { hint_state.reset(); return *this; }
+  
+  const uword N_max = (n_rows > 0) ? (n_rows-1) : uword(0);
+  
+  const bool status = hint_state.set(kind, (std::min)(KL, N_max), (std::min)(KU, N_max));
+  
+  if(status == false)  { arma_debug_warn_level(3, "Mat::set_hint(): bandwidth too large; hint ignored"); }
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+inline
+struct_hint
+Mat<eT>::get_hint() const
+  {
+  uword KL = 0;
+  uword KU = 0;
+  
+  return hint_state.get(KL, KU);
+  }
+
+
+
+template<typename eT>
+inline
+struct_hint
+Mat<eT>::get_hint(uword& out_KL, uword& out_KU) const
+  {
+  return hint_state.get(out_KL, out_KU);
+  }
+
+
+
+//! discard the structure hint
+template<typename eT>
+arma_inline
+void
+Mat<eT>::reset_hint()
+  {
+  hint_state.reset();
+  }
+
+
+
 //! change the matrix to have user specified dimensions (data is not preserved)
 template<typename eT>
 inline
@@ -9267,6 +9435,8 @@ Mat<eT>::front()
   {
   arma_debug_check( (n_elem == 0), "Mat::front(): matrix is empty" );
   
+  hint_state.reset();
+  
   return access::rw(mem[0]);
   }
 
@@ -9291,6 +9461,8 @@ Mat<eT>::back()
   {
   arma_debug_check( (n_elem == 0), "Mat::back(): matrix is empty" );
   
+  hint_state.reset();
+  
   return access::rw(mem[n_elem-1]);
   }
 
@@ -9522,6 +9694,8 @@ Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::operator=(const fixed<fixed_n_rows,
     const eT* src  = (use_extra) ? X.mem_local_extra : X.mem_local;
     
     arrayops::copy( dest, src, fixed_n_elem );
+    
+    Mat<eT>::hint_state = X.hint_state;
     }
   
   return *this;
@@ -9647,6 +9821,8 @@ arma_inline
 eT&
 Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::operator[] (const uword ii)
   {
+  Mat<eT>::hint_state.reset();
+  
   return (use_extra) ? mem_local_extra[ii] : mem_local[ii];
   }
 
@@ -9669,6 +9845,8 @@ arma_inline
 eT&
 Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::at(const uword ii)
   {
+  Mat<eT>::hint_state.reset();
+  
   return (use_extra) ? mem_local_extra[ii] : mem_local[ii];
   }
 
@@ -9691,6 +9869,8 @@ arma_inline
 eT&
 Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::operator() (const uword ii)
   {
+  Mat<eT>::hint_state.reset();
+  
   arma_debug_check_bounds( (ii >= fixed_n_elem), "Mat::operator(): index out of bounds" );
   
   return (use_extra) ? mem_local_extra[ii] : mem_local[ii];
@@ -9719,6 +9899,8 @@ Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::operator() (const uword ii) const
     eT&
   Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::operator[] (const uword in_row, const uword in_col)
     {
+    Mat<eT>::hint_state.reset();
+    
     const uword iq = in_row + in_col*fixed_n_rows;
     
     return (use_extra) ? mem_local_extra[iq] : mem_local[iq];
@@ -9747,6 +9929,8 @@ arma_inline
 eT&
 Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::at(const uword in_row, const uword in_col)
   {
+  Mat<eT>::hint_state.reset();
+  
   const uword iq = in_row + in_col*fixed_n_rows;
   
   return (use_extra) ? mem_local_extra[iq] : mem_local[iq];
@@ -9773,6 +9957,8 @@ arma_inline
 eT&
 Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::operator() (const uword in_row, const uword in_col)
   {
+  Mat<eT>::hint_state.reset();
+  
   arma_debug_check_bounds( ((in_row >= fixed_n_rows) || (in_col >= fixed_n_cols)), "Mat::operator(): index out of bounds" );
   
   const uword iq = in_row + in_col*fixed_n_rows;
@@ -9803,6 +9989,8 @@ arma_inline
 eT*
 Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::colptr(const uword in_col)
   {
+  Mat<eT>::hint_state.reset();
+  
   eT* mem_actual = (use_extra) ? mem_local_extra : mem_local;
   
   return & access::rw(mem_actual[in_col*fixed_n_rows]);
@@ -9829,6 +10017,8 @@ arma_inline
 eT*
 Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::memptr()
   {
+  Mat<eT>::hint_state.reset();
+  
   return (use_extra) ? mem_local_extra : mem_local;
   }
 
@@ -9864,6 +10054,8 @@ Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::fill(const eT val)
   {
   arma_extra_debug_sigprint();
   
+  Mat<eT>::hint_state.reset();
+  
   eT* mem_use = (use_extra) ? &(mem_local_extra[0]) : &(mem_local[0]);
   
   arrayops::inplace_set_fixed<eT,fixed_n_elem>( mem_use, val );
@@ -9881,6 +10073,8 @@ Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::zeros()
   {
   arma_extra_debug_sigprint();
   
+  Mat<eT>::hint_state.reset();
+  
   eT* mem_use = (use_extra) ? &(mem_local_extra[0]) : &(mem_local[0]);
   
   arrayops::inplace_set_fixed<eT,fixed_n_elem>( mem_use, eT(0) );
@@ -9898,6 +10092,8 @@ Mat<eT>::fixed<fixed_n_rows, fixed_n_cols>::ones()
   {
   arma_extra_debug_sigprint();
   
+  Mat<eT>::hint_state.reset();
+  
   eT* mem_use = (use_extra) ? &(mem_local_extra[0]) : &(mem_local[0]);
   
   arrayops::inplace_set_fixed<eT,fixed_n_elem>( mem_use, eT(1) );
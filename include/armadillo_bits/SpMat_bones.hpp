@@ -112,6 +112,12 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   template<typename T1, typename T2>
   inline SpMat(const bool add_values, const Base<uword,T1>& locations, const Base<eT,T2>& values, const uword n_rows, const uword n_cols, const bool sort_locations = true, const bool check_for_zeros = true);
   
+  template<typename T2>
+  inline SpMat(Mat<uword>&& locations, const Base<eT,T2>& values, const uword n_rows, const uword n_cols, const bool sort_locations = true, const bool check_for_zeros = true);
+  
+  template<typename T2>
+  inline SpMat(const bool add_values, Mat<uword>&& locations, const Base<eT,T2>& values, const uword n_rows, const uword n_cols, const bool sort_locations = true, const bool check_for_zeros = true);
+  
   inline SpMat& operator= (const eT val); //! sets size to 1x1
   inline SpMat& operator*=(const eT val);
   inline SpMat& operator/=(const eT val);
@@ -171,6 +177,9 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   inline SpMat& operator%=(const spdiagview<eT>& X);
   inline SpMat& operator/=(const spdiagview<eT>& X);
   
+  inline            SpMat(const sp_compact<eT>& X);
+  inline SpMat& operator=(const sp_compact<eT>& X);
+  
   // delayed unary ops
   template<typename T1, typename spop_type> inline             SpMat(const SpOp<T1, spop_type>& X);
   template<typename T1, typename spop_type> inline SpMat& operator= (const SpOp<T1, spop_type>& X);
@@ -632,6 +641,11 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   //! synchronise CSC from cache
   inline void sync() const;
   
+  //! compressed sparse row (CSR) copy of the matrix; built on first use and discarded when the matrix is modified
+  inline const SpMat_csr<eT>& csr() const;
+  
+  arma_warn_unused inline bool has_csr() const;
+  
   //! don't use this unless you're writing internal Armadillo code
   inline void remove_zeros();
   
@@ -660,8 +674,9 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   
   inline void init_simple(const SpMat<eT>& x);
   
-  inline void init_batch_std(const Mat<uword>& locations, const Mat<eT>& values, const bool sort_locations);
-  inline void init_batch_add(const Mat<uword>& locations, const Mat<eT>& values, const bool sort_locations);
+  inline void init_batch(const Mat<uword>& locations, const Mat<eT>& values, const bool sort_locations, const bool add_values, const bool check_for_zeros, Mat<uword>* locations_consumed = nullptr);
+  
+  inline static uword init_batch_col(uword* rows, eT* vals, const uword N, const bool add_values, const bool check_for_zeros, uword& n_duplicates);
   
   inline SpMat(const arma_vec_indicator&, const uword in_vec_state);
   inline SpMat(const arma_vec_indicator&, const uword in_n_rows, const uword in_n_cols, const uword in_vec_state);
@@ -699,6 +714,8 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   arma_aligned mutable std::mutex cache_mutex;
   #endif
   
+  arma_aligned mutable SpMat_csr<eT> csr_mirror;  // guarded by the same lock as the cache
+  
   arma_inline void invalidate_cache() const;
   arma_inline void invalidate_csc()   const;
   
@@ -715,6 +732,8 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   friend class SpMat_MapMat_val<eT>;
   friend class SpSubview_MapMat_val<eT>;
   friend class spdiagview<eT>;
+  friend class sp_pattern;
+  friend class sp_reorder;
   
   template<typename xT1, typename xT2> friend class SpSubview_col_list;
   
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup SpMat_csr
+//! @{
+
+
+//! compressed sparse row (CSR) copy of a sparse matrix;
+//! built on request via SpMat::csr() and discarded as soon as the matrix is modified
+template<typename eT>
+class SpMat_csr
+  {
+  public:
+  
+  typedef eT elem_type;
+  
+  const uword n_rows;
+  const uword n_cols;
+  const uword n_nonzero;
+  
+  const eT*    const values;       //!< non-zero values, stored row by row
+  const uword* const col_indices;  //!< column index of each value; sorted within each row
+  const uword* const row_ptrs;     //!< start of each row within values and col_indices; row_ptrs[n_rows] = n_nonzero
+  
+  inline ~SpMat_csr();
+  inline  SpMat_csr();
+  
+  SpMat_csr(const SpMat_csr&)            = delete;
+  SpMat_csr& operator=(const SpMat_csr&) = delete;
+  
+  arma_inline bool is_valid() const;
+  
+  
+  private:
+  
+  arma_aligned state_type valid;
+  
+  arma_inline void reset();
+  arma_cold inline void reset_cold();
+  
+  inline void init(const SpMat<eT>& x);
+  
+  friend class SpMat<eT>;
+  };
+
+
+
+//! @}
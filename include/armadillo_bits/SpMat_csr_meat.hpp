@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup SpMat_csr
+//! @{
+
+
+
+template<typename eT>
+inline
+SpMat_csr<eT>::~SpMat_csr()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  reset_cold();
+  }
+
+
+
+template<typename eT>
+inline
+SpMat_csr<eT>::SpMat_csr()
+  : n_rows     (0)
+  , n_cols     (0)
+  , n_nonzero  (0)
+  , values     (nullptr)
+  , col_indices(nullptr)
+  , row_ptrs   (nullptr)
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+arma_inline
+bool
+SpMat_csr<eT>::is_valid() const
+  {
+  return (valid == 1);
+  }
+
+
+
+template<typename eT>
+arma_inline
+void
+SpMat_csr<eT>::reset()
+  {
+  if(valid == 0)  { return; }
+  
+  reset_cold();
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMat_csr<eT>::reset_cold()
+  {
+  arma_extra_debug_sigprint();
+  
+  valid = 0;
+  
+  if(values     )  { memory::release(access::rw(values));      }
+  if(col_indices)  { memory::release(access::rw(col_indices)); }
+  if(row_ptrs   )  { memory::release(access::rw(row_ptrs));    }
+  
+  access::rw(n_rows)    = 0;
+  access::rw(n_cols)    = 0;
+  access::rw(n_nonzero) = 0;
+  
+  access::rw(values)      = nullptr;
+  access::rw(col_indices) = nullptr;
+  access::rw(row_ptrs)    = nullptr;
+  }
+
+
+
+//! the CSC form of the transpose of x is the CSR form of x
+template<typename eT>
+inline
+void
+SpMat_csr<eT>::init(const SpMat<eT>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  reset_cold();
+  
+  SpMat<eT> xt;
+  
+  spop_strans::apply_noalias(xt, x);
+  
+  access::rw(n_rows)    = x.n_rows;
+  access::rw(n_cols)    = x.n_cols;
+  access::rw(n_nonzero) = xt.n_nonzero;
+  
+  access::rw(values)      = xt.values;
+  access::rw(col_indices) = xt.row_indices;
+  access::rw(row_ptrs)    = xt.col_ptrs;
+  
+  access::rw(xt.values)      = nullptr;
+  access::rw(xt.row_indices) = nullptr;
+  access::rw(xt.col_ptrs)    = nullptr;
+  
+  access::rw(xt.n_nonzero) = 0;
+  
+  valid = 1;
+  }
+
+
+
+//! @}
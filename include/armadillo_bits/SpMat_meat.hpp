@@ -337,37 +337,7 @@ SpMat<eT>::SpMat(const Base<uword,T1>& locations_expr, const Base<eT,T2>& vals_e
   uvec bounds = arma::max(locs, 1);
   init_cold(bounds[0] + 1, bounds[1] + 1);
   
-  // Ensure that there are no zeros
-  const uword N_old = vals.n_elem;
-        uword N_new = 0;
-  
-  for(uword i=0; i < N_old; ++i)  { N_new += (vals[i] != eT(0)) ? uword(1) : uword(0); }
-  
-  if(N_new != N_old)
-    {
-    Col<eT>    filtered_vals(   N_new, arma_nozeros_indicator());
-    Mat<uword> filtered_locs(2, N_new, arma_nozeros_indicator());
-    
-    uword index = 0;
-    for(uword i = 0; i < N_old; ++i)
-      {
-      if(vals[i] != eT(0))
-        {
-        filtered_vals[index] = vals[i];
-        
-        filtered_locs.at(0, index) = locs.at(0, i);
-        filtered_locs.at(1, index) = locs.at(1, i);
-        
-        ++index;
-        }
-      }
-    
-    init_batch_std(filtered_locs, filtered_vals, sort_locations);
-    }
-  else
-    {
-    init_batch_std(locs, vals, sort_locations);
-    }
+  init_batch(locs, vals, sort_locations, false, true);
   }
 
 
@@ -405,44 +375,7 @@ SpMat<eT>::SpMat(const Base<uword,T1>& locations_expr, const Base<eT,T2>& vals_e
   
   init_cold(in_n_rows, in_n_cols);
   
-  // Ensure that there are no zeros, unless the user asked not to.
-  if(check_for_zeros)
-    {
-    const uword N_old = vals.n_elem;
-          uword N_new = 0;
-    
-    for(uword i=0; i < N_old; ++i)  { N_new += (vals[i] != eT(0)) ? uword(1) : uword(0); }
-    
-    if(N_new != N_old)
-      {
-      Col<eT>    filtered_vals(   N_new, arma_nozeros_indicator());
-      Mat<uword> filtered_locs(2, N_new, arma_nozeros_indicator());
-      
-      uword index = 0;
-      for(uword i = 0; i < N_old; ++i)
-        {
-        if(vals[i] != eT(0))
-          {
-          filtered_vals[index] = vals[i];
-          
-          filtered_locs.at(0, index) = locs.at(0, i);
-          filtered_locs.at(1, index) = locs.at(1, i);
-          
-          ++index;
-          }
-        }
-      
-      init_batch_std(filtered_locs, filtered_vals, sort_locations);
-      }
-    else
-      {
-      init_batch_std(locs, vals, sort_locations);
-      }
-    }
-  else
-    {
-    init_batch_std(locs, vals, sort_locations);
-    }
+  init_batch(locs, vals, sort_locations, false, check_for_zeros);
   }
 
 
@@ -474,44 +407,70 @@ SpMat<eT>::SpMat(const bool add_values, const Base<uword,T1>& locations_expr, co
   
   init_cold(in_n_rows, in_n_cols);
   
-  // Ensure that there are no zeros, unless the user asked not to.
-  if(check_for_zeros)
-    {
-    const uword N_old = vals.n_elem;
-          uword N_new = 0;
-    
-    for(uword i=0; i < N_old; ++i)  { N_new += (vals[i] != eT(0)) ? uword(1) : uword(0); }
-    
-    if(N_new != N_old)
-      {
-      Col<eT>    filtered_vals(   N_new, arma_nozeros_indicator());
-      Mat<uword> filtered_locs(2, N_new, arma_nozeros_indicator());
-      
-      uword index = 0;
-      for(uword i = 0; i < N_old; ++i)
-        {
-        if(vals[i] != eT(0))
-          {
-          filtered_vals[index] = vals[i];
-          
-          filtered_locs.at(0, index) = locs.at(0, i);
-          filtered_locs.at(1, index) = locs.at(1, i);
-          
-          ++index;
-          }
-        }
-      
-      add_values ? init_batch_add(filtered_locs, filtered_vals, sort_locations) : init_batch_std(filtered_locs, filtered_vals, sort_locations);
-      }
-    else
-      {
-      add_values ? init_batch_add(locs, vals, sort_locations) : init_batch_std(locs, vals, sort_locations);
-      }
-    }
-  else
-    {
-    add_values ? init_batch_add(locs, vals, sort_locations) : init_batch_std(locs, vals, sort_locations);
-    }
+  init_batch(locs, vals, sort_locations, add_values, check_for_zeros);
+  }
+
+
+
+//! Insert a large number of values at once, taking ownership of the locations matrix.
+//! The memory used by the locations is released as soon as the locations have been bucketed by column,
+//! which lowers the peak memory use when constructing large matrices.
+template<typename eT>
+template<typename T2>
+inline
+SpMat<eT>::SpMat(Mat<uword>&& locs, const Base<eT,T2>& vals_expr, const uword in_n_rows, const uword in_n_cols, const bool sort_locations, const bool check_for_zeros)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , vec_state(0)
+  , values(nullptr)
+  , row_indices(nullptr)
+  , col_ptrs(nullptr)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const quasi_unwrap<T2> vals_tmp( vals_expr.get_ref() );
+  
+  const Mat<eT>& vals = vals_tmp.M;
+  
+  arma_debug_check( (vals.is_vec() == false),     "SpMat::SpMat(): given 'values' object must be a vector"                 );
+  arma_debug_check( (locs.n_rows != 2),           "SpMat::SpMat(): locations matrix must have two rows"                    );
+  arma_debug_check( (locs.n_cols != vals.n_elem), "SpMat::SpMat(): number of locations is different than number of values" );
+  
+  init_cold(in_n_rows, in_n_cols);
+  
+  init_batch(locs, vals, sort_locations, false, check_for_zeros, ((locs.mem_state == 0) ? &locs : nullptr));
+  }
+
+
+
+template<typename eT>
+template<typename T2>
+inline
+SpMat<eT>::SpMat(const bool add_values, Mat<uword>&& locs, const Base<eT,T2>& vals_expr, const uword in_n_rows, const uword in_n_cols, const bool sort_locations, const bool check_for_zeros)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , vec_state(0)
+  , values(nullptr)
+  , row_indices(nullptr)
+  , col_ptrs(nullptr)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const quasi_unwrap<T2> vals_tmp( vals_expr.get_ref() );
+  
+  const Mat<eT>& vals = vals_tmp.M;
+  
+  arma_debug_check( (vals.is_vec() == false),     "SpMat::SpMat(): given 'values' object must be a vector"                 );
+  arma_debug_check( (locs.n_rows != 2),           "SpMat::SpMat(): locations matrix must have two rows"                    );
+  arma_debug_check( (locs.n_cols != vals.n_elem), "SpMat::SpMat(): number of locations is different than number of values" );
+  
+  init_cold(in_n_rows, in_n_cols);
+  
+  init_batch(locs, vals, sort_locations, add_values, check_for_zeros, ((locs.mem_state == 0) ? &locs : nullptr));
   }
 
 
@@ -1296,6 +1255,30 @@ SpMat<eT>::operator=(const SpSubview<eT>& X)
     {
     init(X.n_rows, X.n_cols, X.n_nonzero);
     
+    if( (X.n_rows == 1) && X.m.has_csr() )
+      {
+      // extract from the row of the CSR mirror, rather than searching each column
+      
+      const SpMat_csr<eT>& m_csr = X.m.csr();
+      
+      const uword sv_col_start = X.aux_col1;
+      const uword sv_col_endp1 = X.aux_col1 + X.n_cols;
+      
+      const uword* row_start = &(m_csr.col_indices[ m_csr.row_ptrs[X.aux_row1    ] ]);
+      const uword* row_endp1 = &(m_csr.col_indices[ m_csr.row_ptrs[X.aux_row1 + 1] ]);
+      
+      const uword* it = std::lower_bound(row_start, row_endp1, sv_col_start);
+      
+      uword count = 0;
+      
+      for(; (it != row_endp1) && ((*it) < sv_col_endp1); ++it, ++count)
+        {
+        access::rw(row_indices[count]) = 0;
+        access::rw(values[count])      = m_csr.values[it - m_csr.col_indices];
+        ++access::rw(col_ptrs[(*it) - sv_col_start + 1]);
+        }
+      }
+    else
     if(X.n_rows == X.m.n_rows)
       {
       const uword sv_col_start = X.aux_col1;
@@ -1667,6 +1650,58 @@ SpMat<eT>::operator/=(const spdiagview<eT>& X)
 
 
 
+template<typename eT>
+inline
+SpMat<eT>::SpMat(const sp_compact<eT>& X)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , vec_state(0)
+  , values(nullptr)
+  , row_indices(nullptr)
+  , col_ptrs(nullptr)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  (*this).operator=(X);
+  }
+
+
+
+//! copy the CSC arrays of X, widening the row indices; the elements are already sorted
+template<typename eT>
+inline
+SpMat<eT>&
+SpMat<eT>::operator=(const sp_compact<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword nnz = X.n_nonzero;
+  
+  init(X.n_rows, X.n_cols, nnz);
+  
+  arrayops::copy( access::rwp(values),   X.values.memptr(),   nnz       );
+  arrayops::copy( access::rwp(col_ptrs), X.col_ptrs.memptr(), n_cols + 1);
+  
+        uword* out_row_indices = access::rwp(row_indices);
+  const u32*     X_row_indices = X.row_indices.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<uword>::eval(nnz);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword i=0; i < nnz; ++i)  { out_row_indices[i] = uword(X_row_indices[i]); }
+  
+  return *this;
+  }
+
+
+
 template<typename eT>
 template<typename T1, typename spop_type>
 inline
@@ -5225,315 +5260,383 @@ SpMat<eT>::init_simple(const SpMat<eT>& x)
 
 
 
+//! construct from (row, column, value) triplets;
+//! the triplets are bucketed by column via a stable counting sort, then each column is sorted by row,
+//! which avoids a global comparison sort and allows each stage to be parallelised;
+//! identical locations are either added (add_values = true) or reported, and zeros are removed in place.
+//! if locs_consumed is not null, its memory is released as soon as the triplets have been bucketed.
 template<typename eT>
 inline
 void
-SpMat<eT>::init_batch_std(const Mat<uword>& locs, const Mat<eT>& vals, const bool sort_locations)
+SpMat<eT>::init_batch(const Mat<uword>& locs, const Mat<eT>& vals, const bool sort_locations, const bool add_values, const bool check_for_zeros, Mat<uword>* locs_consumed)
   {
   arma_extra_debug_sigprint();
   
-  // Resize to correct number of elements.
-  mem_resize(vals.n_elem);
+  const uword N = locs.n_cols;
+  
+  if(N == 0)
+    {
+    if(locs_consumed != nullptr)  { locs_consumed->reset(); }
+    
+    return;
+    }
+  
+  const uword local_n_rows = n_rows;
+  const uword local_n_cols = n_cols;
+  
+  const uword* locs_mem = locs.memptr();
+  const eT*    vals_mem = vals.memptr();
   
-  // Reset column pointers to zero.
-  arrayops::fill_zeros(access::rwp(col_ptrs), n_cols + 1);
+  // each thread has its own column histogram,
+  // so the number of threads is also limited by the size of the histograms relative to the number of triplets
   
-  bool actually_sorted = true;
+  uword n_threads = 1;
   
-  if(sort_locations)
+  #if defined(ARMA_USE_OPENMP)
     {
-    // check if we really need a time consuming sort
+    if(mp_gate<eT>::eval(N))
+      {
+      const uword n_threads_max = uword(mp_thread_limit::get());
+      const uword n_threads_fit = N / (std::max)(local_n_cols + 1, arma_config::mp_threshold);
+      
+      n_threads = (std::max)( uword(1), (std::min)(n_threads_max, n_threads_fit) );
+      }
+    }
+    
+    const bool use_mp = (n_threads > 1);
+  #endif
+  
+  const uword chunk_size = N / n_threads;
+  
+  podarray<uword> counts(n_threads * local_n_cols);
+  
+  podarray<uword> t_n_invalid(n_threads);
+  podarray<uword> t_n_unordered(n_threads);
+  podarray<uword> t_first(n_threads);
+  podarray<uword> t_last(n_threads);
+  
+  // stage 1: count the retained triplets in each column
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(use_mp)
+  #endif
+  for(uword t=0; t < n_threads; ++t)
+    {
+    const uword start = (t+0) * chunk_size;
+    const uword endp1 = ((t+1) == n_threads) ? N : ((t+1) * chunk_size);
+    
+    uword* t_counts = &(counts[t * local_n_cols]);
     
-    const uword locs_n_cols = locs.n_cols;
+    arrayops::fill_zeros(t_counts, local_n_cols);
     
-    for(uword i = 1; i < locs_n_cols; ++i)
+    uword n_invalid   = 0;
+    uword n_unordered = 0;
+    uword first       = N;
+    uword last        = N;
+    
+    for(uword i=start; i < endp1; ++i)
       {
-      const uword* locs_i   = locs.colptr(i  );
-      const uword* locs_im1 = locs.colptr(i-1);
+      if( check_for_zeros && (vals_mem[i] == eT(0)) )  { continue; }
       
-      const uword row_i = locs_i[0];
-      const uword col_i = locs_i[1];
+      const uword row = locs_mem[2*i    ];
+      const uword col = locs_mem[2*i + 1];
       
-      const uword row_im1 = locs_im1[0];
-      const uword col_im1 = locs_im1[1];
+      if( (row >= local_n_rows) || (col >= local_n_cols) )  { ++n_invalid; continue; }
       
-      if( (col_i < col_im1) || ((col_i == col_im1) && (row_i <= row_im1)) )
+      if(last == N)
+        {
+        first = i;
+        }
+      else
         {
-        actually_sorted = false;
-        break;
+        const uword last_row = locs_mem[2*last    ];
+        const uword last_col = locs_mem[2*last + 1];
+        
+        if( (col < last_col) || ((col == last_col) && (row < last_row)) )  { ++n_unordered; }
         }
+      
+      last = i;
+      
+      ++(t_counts[col]);
       }
     
-    if(actually_sorted == false)
+    t_n_invalid[t]   = n_invalid;
+    t_n_unordered[t] = n_unordered;
+    t_first[t]       = first;
+    t_last[t]        = last;
+    }
+  
+  uword n_invalid   = 0;
+  uword n_unordered = 0;
+  uword last        = N;
+  
+  for(uword t=0; t < n_threads; ++t)
+    {
+    n_invalid   += t_n_invalid[t];
+    n_unordered += t_n_unordered[t];
+    
+    const uword first = t_first[t];
+    
+    if(first == N)  { continue; }
+    
+    if(last != N)
       {
-      // see op_sort_index_bones.hpp for the definition of arma_sort_index_packet and arma_sort_index_helper_ascend
-      
-      std::vector< arma_sort_index_packet<uword> > packet_vec(locs_n_cols);
+      const uword row = locs_mem[2*first    ];
+      const uword col = locs_mem[2*first + 1];
       
-      const uword* locs_mem = locs.memptr();
+      const uword last_row = locs_mem[2*last    ];
+      const uword last_col = locs_mem[2*last + 1];
       
-      for(uword i = 0; i < locs_n_cols; ++i)
-        {
-        const uword row = (*locs_mem);  locs_mem++;
-        const uword col = (*locs_mem);  locs_mem++;
-        
-        packet_vec[i].val   = (col * n_rows) + row;
-        packet_vec[i].index = i;
-        }
+      if( (col < last_col) || ((col == last_col) && (row < last_row)) )  { ++n_unordered; }
+      }
+    
+    last = t_last[t];
+    }
+  
+  arma_debug_check( (n_invalid > 0), "SpMat::SpMat(): invalid row or column index" );
+  
+  arma_debug_check
+    (
+    ( (sort_locations == false) && (n_unordered > 0) ),
+    "SpMat::SpMat(): out of order points; either pass sort_locations = true, or sort points in column-major ordering"
+    );
+  
+  // stage 2: convert the histograms into per-thread offsets within each column, and the column totals into column pointers
+  
+  uword* col_ptrs_mem = access::rwp(col_ptrs);
+  
+  col_ptrs_mem[0] = 0;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(use_mp)
+  #endif
+  for(uword col=0; col < local_n_cols; ++col)
+    {
+    uword acc = 0;
+    
+    for(uword t=0; t < n_threads; ++t)
+      {
+      uword& count = counts[t * local_n_cols + col];
       
-      arma_sort_index_helper_ascend<uword> comparator;
+      const uword tmp = count;
       
-      std::sort( packet_vec.begin(), packet_vec.end(), comparator );
+      count = acc;
       
-      // insert the elements in the sorted order
-      for(uword i = 0; i < locs_n_cols; ++i)
-        {
-        const uword index = packet_vec[i].index;
-        
-        const uword* locs_i = locs.colptr(index);
-        
-        const uword row_i = locs_i[0];
-        const uword col_i = locs_i[1];
-        
-        arma_debug_check( ( (row_i >= n_rows) || (col_i >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-        
-        if(i > 0)
-          {
-          const uword prev_index = packet_vec[i-1].index;
-          
-          const uword* locs_im1 = locs.colptr(prev_index);
-          
-          const uword row_im1 = locs_im1[0];
-          const uword col_im1 = locs_im1[1];
-          
-          arma_debug_check( ( (row_i == row_im1) && (col_i == col_im1) ), "SpMat::SpMat(): detected identical locations" );
-          }
-        
-        access::rw(values[i])      = vals[index];
-        access::rw(row_indices[i]) = row_i;
-        
-        access::rw(col_ptrs[ col_i + 1 ])++;
-        }
+      acc += tmp;
       }
+    
+    col_ptrs_mem[col + 1] = acc;
     }
   
-  if( (sort_locations == false) || (actually_sorted == true) )
+  arrayops::inplace_cumsum_mp(col_ptrs_mem, local_n_cols + 1);
+  
+  const uword n_kept = col_ptrs_mem[local_n_cols];
+  
+  mem_resize(n_kept);
+  
+  eT*    values_mem      = access::rwp(values);
+  uword* row_indices_mem = access::rwp(row_indices);
+  
+  // stage 3: scatter the triplets into their columns; each thread writes its triplets in the given order
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(use_mp)
+  #endif
+  for(uword t=0; t < n_threads; ++t)
     {
-    // Now set the values and row indices correctly.
-    // Increment the column pointers in each column (so they are column "counts").
+    const uword start = (t+0) * chunk_size;
+    const uword endp1 = ((t+1) == n_threads) ? N : ((t+1) * chunk_size);
     
-    const uword locs_n_cols = locs.n_cols;
+    uword* t_offsets = &(counts[t * local_n_cols]);
     
-    for(uword i=0; i < locs_n_cols; ++i)
+    for(uword i=start; i < endp1; ++i)
       {
-      const uword* locs_i = locs.colptr(i);
+      const eT val = vals_mem[i];
       
-      const uword row_i = locs_i[0];
-      const uword col_i = locs_i[1];
+      if( check_for_zeros && (val == eT(0)) )  { continue; }
       
-      arma_debug_check( ( (row_i >= n_rows) || (col_i >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
+      const uword row = locs_mem[2*i    ];
+      const uword col = locs_mem[2*i + 1];
       
-      if(i > 0)
-        {
-        const uword* locs_im1 = locs.colptr(i-1);
-        
-        const uword row_im1 = locs_im1[0];
-        const uword col_im1 = locs_im1[1];
-        
-        arma_debug_check
-          (
-          ( (col_i < col_im1) || ((col_i == col_im1) && (row_i < row_im1)) ),
-          "SpMat::SpMat(): out of order points; either pass sort_locations = true, or sort points in column-major ordering"
-          );
-        
-        arma_debug_check( ( (col_i == col_im1) && (row_i == row_im1) ), "SpMat::SpMat(): detected identical locations" );
-        }
+      if( (row >= local_n_rows) || (col >= local_n_cols) )  { continue; }
       
-      access::rw(values[i])      = vals[i];
-      access::rw(row_indices[i]) = row_i;
+      const uword pos = col_ptrs_mem[col] + t_offsets[col];
       
-      access::rw(col_ptrs[ col_i + 1 ])++;
+      ++(t_offsets[col]);
+      
+      row_indices_mem[pos] = row;
+      values_mem[pos]      = val;
       }
     }
   
-  // Now fix the column pointers.
-  for(uword i = 0; i < n_cols; ++i)
+  if(locs_consumed != nullptr)  { locs_consumed->reset(); }
+  
+  // stage 4: sort each column by row, then add or report identical locations and remove zeros;
+  // the new length of each column is stored in counts
+  
+  uword n_final      = 0;
+  uword n_duplicates = 0;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(dynamic,64) num_threads(int(n_threads)) if(use_mp) reduction(+:n_final,n_duplicates)
+  #endif
+  for(uword col=0; col < local_n_cols; ++col)
     {
-    access::rw(col_ptrs[i + 1]) += col_ptrs[i];
+    const uword start = col_ptrs_mem[col    ];
+    const uword endp1 = col_ptrs_mem[col + 1];
+    
+    const uword count = SpMat<eT>::init_batch_col(&(row_indices_mem[start]), &(values_mem[start]), endp1 - start, add_values, check_for_zeros, n_duplicates);
+    
+    counts[col] = count;
+    
+    n_final += count;
     }
+  
+  arma_debug_check( (n_duplicates > 0), "SpMat::SpMat(): detected identical locations" );
+  
+  if(n_final == n_kept)  { return; }
+  
+  // stage 5: pack the shortened columns into new storage
+  
+  podarray<uword> new_col_ptrs(local_n_cols + 1);
+  
+  uword* new_col_ptrs_mem = new_col_ptrs.memptr();
+  
+  new_col_ptrs_mem[0] = 0;
+  
+  arrayops::copy(&(new_col_ptrs_mem[1]), counts.memptr(), local_n_cols);
+  
+  arrayops::inplace_cumsum_mp(new_col_ptrs_mem, local_n_cols + 1);
+  
+  eT*    new_values      = memory::acquire<eT>   (n_final + 1);
+  uword* new_row_indices = memory::acquire<uword>(n_final + 1);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads)) if(use_mp)
+  #endif
+  for(uword col=0; col < local_n_cols; ++col)
+    {
+    const uword old_start = col_ptrs_mem[col];
+    const uword new_start = new_col_ptrs_mem[col];
+    
+    arrayops::copy(&(new_values[new_start]),      &(values_mem[old_start]),      counts[col]);
+    arrayops::copy(&(new_row_indices[new_start]), &(row_indices_mem[old_start]), counts[col]);
+    }
+  
+  memory::release(values_mem);
+  memory::release(row_indices_mem);
+  
+  access::rw(values)      = new_values;
+  access::rw(row_indices) = new_row_indices;
+  
+  access::rw(     values[n_final]) = 0;
+  access::rw(row_indices[n_final]) = 0;
+  
+  access::rw(n_nonzero) = n_final;
+  
+  arrayops::copy(col_ptrs_mem, new_col_ptrs_mem, local_n_cols + 1);
   }
 
 
 
+//! sort one column of a batch insertion by row, then add or count identical locations and remove zeros;
+//! returns the new number of elements in the column
 template<typename eT>
 inline
-void
-SpMat<eT>::init_batch_add(const Mat<uword>& locs, const Mat<eT>& vals, const bool sort_locations)
+uword
+SpMat<eT>::init_batch_col(uword* rows, eT* vals, const uword N, const bool add_values, const bool check_for_zeros, uword& n_duplicates)
   {
-  arma_extra_debug_sigprint();
-  
-  if(locs.n_cols < 2)
-    {
-    init_batch_std(locs, vals, false);
-    return;
-    }
+  bool is_sorted = true;
   
-  // Reset column pointers to zero.
-  arrayops::fill_zeros(access::rwp(col_ptrs), n_cols + 1);
+  for(uword i=1; i < N; ++i)  { if(rows[i] < rows[i-1])  { is_sorted = false; break; } }
   
-  bool actually_sorted = true;
-  
-  if(sort_locations)
+  if(is_sorted == false)
     {
-    // sort_index() uses std::sort() which may use quicksort... so we better
-    // make sure it's not already sorted before taking an O(N^2) sort penalty.
-    for(uword i = 1; i < locs.n_cols; ++i)
-      {
-      const uword* locs_i   = locs.colptr(i  );
-      const uword* locs_im1 = locs.colptr(i-1);
-      
-      if( (locs_i[1] < locs_im1[1]) || (locs_i[1] == locs_im1[1]  &&  locs_i[0] <= locs_im1[0]) )
-        {
-        actually_sorted = false;
-        break;
-        }
-      }
+    // both sorts are stable, so identical locations are added in the given order
     
-    if(actually_sorted == false)
+    if(N <= uword(32))
       {
-      // This may not be the fastest possible implementation but it maximizes code reuse.
-      Col<uword> abslocs(locs.n_cols, arma_nozeros_indicator());
-      
-      for(uword i = 0; i < locs.n_cols; ++i)
+      for(uword i=1; i < N; ++i)
         {
-        const uword* locs_i = locs.colptr(i);
+        const uword row = rows[i];
+        const eT    val = vals[i];
+        
+        uword j = i;
         
-        abslocs[i] = locs_i[1] * n_rows + locs_i[0];
+        while( (j > 0) && (rows[j-1] > row) )  { rows[j] = rows[j-1]; vals[j] = vals[j-1]; --j; }
+        
+        rows[j] = row;
+        vals[j] = val;
         }
+      }
+    else
+      {
+      // see op_sort_index_bones.hpp for the definition of arma_sort_index_packet and arma_sort_index_helper_ascend
       
-      uvec sorted_indices = sort_index(abslocs); // Ascending sort.
-      
-      // work out the number of unique elments 
-      uword n_unique = 1;  // first element is unique
+      std::vector< arma_sort_index_packet<uword> > packet_vec(N);
       
-      for(uword i=1; i < sorted_indices.n_elem; ++i)
+      for(uword i=0; i < N; ++i)
         {
-        const uword* locs_i   = locs.colptr( sorted_indices[i  ] );
-        const uword* locs_im1 = locs.colptr( sorted_indices[i-1] );
-        
-        if( (locs_i[1] != locs_im1[1]) || (locs_i[0] != locs_im1[0]) )  { ++n_unique; }
+        packet_vec[i].val   = rows[i];
+        packet_vec[i].index = i;
         }
       
-      // resize to correct number of elements
-      mem_resize(n_unique);
+      arma_sort_index_helper_ascend<uword> comparator;
+      
+      std::stable_sort( packet_vec.begin(), packet_vec.end(), comparator );
       
-      // Now we add the elements in this sorted order.
-      uword count = 0;
+      podarray<eT> tmp_vals(N);
       
-      // first element
-        {
-        const uword  i      = 0;
-        const uword* locs_i = locs.colptr( sorted_indices[i] );
-        
-        arma_debug_check( ( (locs_i[0] >= n_rows) || (locs_i[1] >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-        
-        access::rw(values[count])      = vals[ sorted_indices[i] ];
-        access::rw(row_indices[count]) = locs_i[0];
-        
-        access::rw(col_ptrs[ locs_i[1] + 1 ])++;
-        }
+      arrayops::copy(tmp_vals.memptr(), vals, N);
       
-      for(uword i=1; i < sorted_indices.n_elem; ++i)
+      for(uword i=0; i < N; ++i)
         {
-        const uword* locs_i   = locs.colptr( sorted_indices[i  ] );
-        const uword* locs_im1 = locs.colptr( sorted_indices[i-1] );
-        
-        arma_debug_check( ( (locs_i[0] >= n_rows) || (locs_i[1] >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-        
-        if( (locs_i[1] == locs_im1[1]) && (locs_i[0] == locs_im1[0]) )
-          {
-          access::rw(values[count]) += vals[ sorted_indices[i] ];
-          }
-        else
-          {
-          count++;
-          access::rw(values[count])      = vals[ sorted_indices[i] ];
-          access::rw(row_indices[count]) = locs_i[0];
-          
-          access::rw(col_ptrs[ locs_i[1] + 1 ])++;
-          }
+        rows[i] = packet_vec[i].val;
+        vals[i] = tmp_vals[ packet_vec[i].index ];
         }
       }
     }
   
-  if( (sort_locations == false) || (actually_sorted == true) )
+  uword count = 0;
+  
+  for(uword i=0; i < N; ++i)
     {
-    // work out the number of unique elments 
-    uword n_unique = 1;  // first element is unique
+    const uword row = rows[i];
+    const eT    val = vals[i];
     
-    for(uword i=1; i < locs.n_cols; ++i)
+    if( (count > 0) && (rows[count-1] == row) )
       {
-      const uword* locs_i   = locs.colptr(i  );
-      const uword* locs_im1 = locs.colptr(i-1);
+      if(add_values)  { vals[count-1] += val; }  else  { ++n_duplicates; }
       
-      if( (locs_i[1] != locs_im1[1]) || (locs_i[0] != locs_im1[0]) )  { ++n_unique; }
+      continue;
       }
     
-    // resize to correct number of elements
-    mem_resize(n_unique);
+    rows[count] = row;
+    vals[count] = val;
     
-    // Now set the values and row indices correctly.
-    // Increment the column pointers in each column (so they are column "counts").
+    ++count;
+    }
+  
+  if(add_values && check_for_zeros)
+    {
+    // added values may cancel out
     
-    uword count = 0;
+    uword count_nz = 0;
     
-    // first element
+    for(uword i=0; i < count; ++i)
       {
-      const uword  i      = 0;
-      const uword* locs_i = locs.colptr(i);
+      if(vals[i] == eT(0))  { continue; }
       
-      arma_debug_check( ( (locs_i[0] >= n_rows) || (locs_i[1] >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
+      rows[count_nz] = rows[i];
+      vals[count_nz] = vals[i];
       
-      access::rw(values[count])      = vals[i];
-      access::rw(row_indices[count]) = locs_i[0];
-      
-      access::rw(col_ptrs[ locs_i[1] + 1 ])++;
+      ++count_nz;
       }
     
-    for(uword i=1; i < locs.n_cols; ++i)
-      {
-      const uword* locs_i   = locs.colptr(i  );
-      const uword* locs_im1 = locs.colptr(i-1);
-      
-      arma_debug_check( ( (locs_i[0] >= n_rows) || (locs_i[1] >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-      
-      arma_debug_check
-        (
-        ( (locs_i[1] < locs_im1[1]) || (locs_i[1] == locs_im1[1]  &&  locs_i[0] < locs_im1[0]) ),
-        "SpMat::SpMat(): out of order points; either pass sort_locations = true, or sort points in column-major ordering"
-        );
-      
-      if( (locs_i[1] == locs_im1[1]) && (locs_i[0] == locs_im1[0]) )
-        {
-        access::rw(values[count]) += vals[i];
-        }
-      else
-        {
-        count++;
-        
-        access::rw(values[count])      = vals[i];
-        access::rw(row_indices[count]) = locs_i[0];
-        
-        access::rw(col_ptrs[ locs_i[1] + 1 ])++;
-        }
-      }
+    count = count_nz;
     }
   
-  // Now fix the column pointers.
-  for(uword i = 0; i < n_cols; ++i)
-    {
-    access::rw(col_ptrs[i + 1]) += col_ptrs[i];
-    }
+  return count;
   }
 
 
@@ -5632,6 +5735,57 @@ SpMat<eT>::sync() const
 
 
 
+template<typename eT>
+inline
+const SpMat_csr<eT>&
+SpMat<eT>::csr() const
+  {
+  arma_extra_debug_sigprint();
+  
+  sync_csc();
+  
+  // same double-checked locking as in sync_cache()
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(csr_mirror.is_valid() == false)
+      {
+      #pragma omp critical (arma_SpMat_cache)
+        {
+        if(csr_mirror.is_valid() == false)  { csr_mirror.init(*this); }
+        }
+      }
+    }
+  #elif (!defined(ARMA_DONT_USE_STD_MUTEX))
+    {
+    if(csr_mirror.is_valid() == false)
+      {
+      const std::lock_guard<std::mutex> lock(cache_mutex);
+      
+      if(csr_mirror.is_valid() == false)  { csr_mirror.init(*this); }
+      }
+    }
+  #else
+    {
+    if(csr_mirror.is_valid() == false)  { csr_mirror.init(*this); }
+    }
+  #endif
+  
+  return csr_mirror;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+SpMat<eT>::has_csr() const
+  {
+  return ( (sync_state != 1) && csr_mirror.is_valid() );
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -5746,6 +5900,10 @@ SpMat<eT>::steal_mem_simple(SpMat<eT>& x)
   
   if(this == &x)  { return; }
   
+  csr_mirror.reset();
+  
+  x.csr_mirror.reset();
+  
   if(values     )  { memory::release(access::rw(values));      }
   if(row_indices)  { memory::release(access::rw(row_indices)); }
   if(col_ptrs   )  { memory::release(access::rw(col_ptrs));    }
@@ -6624,6 +6782,8 @@ SpMat<eT>::invalidate_cache() const
   {
   arma_extra_debug_sigprint();
   
+  csr_mirror.reset();
+  
   if(sync_state == 0)  { return; }
   
   cache.reset();
@@ -6640,6 +6800,8 @@ SpMat<eT>::invalidate_csc() const
   {
   arma_extra_debug_sigprint();
   
+  csr_mirror.reset();
+  
   sync_state = 1;
   }
 
@@ -44,6 +44,21 @@ SpSubview<eT>::SpSubview(const SpMat<eT>& in_m, const uword in_row1, const uword
   
   m.sync_csc();
   
+  if( (in_n_rows == 1) && m.has_csr() )
+    {
+    const SpMat_csr<eT>& m_csr = m.csr();
+    
+    const uword* row_start = &(m_csr.col_indices[ m_csr.row_ptrs[in_row1    ] ]);
+    const uword* row_endp1 = &(m_csr.col_indices[ m_csr.row_ptrs[in_row1 + 1] ]);
+    
+    const uword* first = std::lower_bound(row_start, row_endp1, in_col1            );
+    const uword* last  = std::lower_bound(first,     row_endp1, in_col1 + in_n_cols);
+    
+    access::rw(n_nonzero) = uword(last - first);
+    
+    return;
+    }
+  
   // There must be a O(1) way to do this
   uword lend     = m.col_ptrs[in_col1 + in_n_cols];
   uword lend_row = in_row1 + in_n_rows;
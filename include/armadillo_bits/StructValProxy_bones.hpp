@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup StructValProxy
+//! @{
+
+
+// Value proxy for dense matrices with structured storage (band_mat, symmat_packed, trimat_packed),
+// where some elements are implied rather than stored.
+// Reading gives the value of any element; writing is only allowed for elements held in the storage,
+// or for writing a zero to an implied zero element.
+// This class uses T1::get_elem() and T1::set_elem()
+
+template<typename T1>
+class StructValProxy
+  {
+  public:
+  
+  typedef typename T1::elem_type eT;  // convenience typedef
+  
+  friend class band_mat<eT>;
+  friend class symmat_packed<eT>;
+  friend class trimat_packed<eT>;
+  
+  inline StructValProxy() = delete;
+  
+  inline StructValProxy& operator=(const StructValProxy& rhs);
+  
+  inline StructValProxy& operator= (const eT rhs);
+  inline StructValProxy& operator+=(const eT rhs);
+  inline StructValProxy& operator-=(const eT rhs);
+  inline StructValProxy& operator*=(const eT rhs);
+  inline StructValProxy& operator/=(const eT rhs);
+  
+  arma_inline operator eT() const;
+  
+  
+  private:
+  
+  arma_inline StructValProxy(const uword in_row, const uword in_col, T1& in_parent);
+  
+  arma_aligned const uword row;
+  arma_aligned const uword col;
+  
+  arma_aligned T1& parent;
+  };
+
+
+
+//! @}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup StructValProxy
+//! @{
+
+
+
+template<typename T1>
+arma_inline
+StructValProxy<T1>::StructValProxy(const uword in_row, const uword in_col, T1& in_parent)
+  : row   (in_row   )
+  , col   (in_col   )
+  , parent(in_parent)
+  {
+  }
+
+
+
+template<typename T1>
+inline
+StructValProxy<T1>&
+StructValProxy<T1>::operator=(const StructValProxy<T1>& rhs)
+  {
+  return (*this).operator=(eT(rhs));
+  }
+
+
+
+template<typename T1>
+inline
+StructValProxy<T1>&
+StructValProxy<T1>::operator=(const eT rhs)
+  {
+  parent.set_elem(row, col, rhs);
+  
+  return *this;
+  }
+
+
+
+template<typename T1>
+inline
+StructValProxy<T1>&
+StructValProxy<T1>::operator+=(const eT rhs)
+  {
+  parent.set_elem(row, col, parent.get_elem(row, col) + rhs);
+  
+  return *this;
+  }
+
+
+
+template<typename T1>
+inline
+StructValProxy<T1>&
+StructValProxy<T1>::operator-=(const eT rhs)
+  {
+  parent.set_elem(row, col, parent.get_elem(row, col) - rhs);
+  
+  return *this;
+  }
+
+
+
+template<typename T1>
+inline
+StructValProxy<T1>&
+StructValProxy<T1>::operator*=(const eT rhs)
+  {
+  parent.set_elem(row, col, parent.get_elem(row, col) * rhs);
+  
+  return *this;
+  }
+
+
+
+template<typename T1>
+inline
+StructValProxy<T1>&
+StructValProxy<T1>::operator/=(const eT rhs)
+  {
+  parent.set_elem(row, col, parent.get_elem(row, col) / rhs);
+  
+  return *this;
+  }
+
+
+
+template<typename T1>
+arma_inline
+StructValProxy<T1>::operator eT() const
+  {
+  return parent.get_elem(row, col);
+  }
+
+
+
+//! @}
@@ -188,6 +188,13 @@ struct arma_config
   #endif
   
   
+  #if defined(ARMA_COMPENSATED_SUM)
+    static constexpr bool compensated_sum = true;
+  #else
+    static constexpr bool compensated_sum = false;
+  #endif
+  
+  
   #if (defined(_POSIX_C_SOURCE) && (_POSIX_C_SOURCE >= 200112L))
     static constexpr bool posix = true;
   #else
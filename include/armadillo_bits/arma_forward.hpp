@@ -60,6 +60,18 @@ template<typename eT> class MapMat_val;
 template<typename eT> class SpMat_MapMat_val;
 template<typename eT> class SpSubview_MapMat_val;
 
+template<typename eT> class SpMat_csr;
+template<typename eT> class sp_sell;
+template<typename eT> class sp_compact;
+template<typename eT> class sp_trisolve;
+template<typename eT> class band_mat;
+template<typename T1> class StructValProxy;
+template<typename eT> class symmat_packed;
+template<typename eT> class trimat_packed;
+
+class sp_pattern;
+class sp_reorder;
+
 template<typename eT, typename T1>              class subview_elem1;
 template<typename eT, typename T1, typename T2> class subview_elem2;
 
@@ -405,6 +417,28 @@ struct  csv_name;
 
 
 
+//! \addtogroup struct_hint
+//! @{
+
+
+enum struct struct_hint : unsigned int
+  {
+  none  = 0,  //!< no structure known
+  sym   = 1,  //!< symmetric (real) or hermitian (complex)
+  sympd = 2,  //!< symmetric/hermitian positive definite
+  triu  = 3,  //!< upper triangular
+  tril  = 4,  //!< lower triangular
+  band  = 5   //!< banded, with KL sub-diagonals and KU super-diagonals
+  };
+
+
+class struct_hint_state;
+
+
+//! @}
+
+
+
 //! \addtogroup fn_spsolve
 //! @{
 
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup arma_profiler
+//! @{
+
+
+// lightweight profiler, enabled at compile time by defining ARMA_PROFILE before including armadillo;
+// every function with arma_extra_debug_sigprint() that belongs to an op_*, glue_*, BLAS or LAPACK wrapper class
+// records the number of calls, the wall time, the bytes allocated for temporaries and whether an OpenMP parallel path was taken;
+// times, bytes and parallel paths are inclusive of nested calls on the same thread
+
+
+class arma_profiler
+  {
+  public:
+  
+  class site
+    {
+    public:
+    
+    const std::string name;
+    const bool        active;
+    
+    std::atomic<u64> n_calls;
+    std::atomic<u64> n_nanosec;
+    std::atomic<u64> n_bytes;
+    std::atomic<u64> n_parallel;
+    
+    inline site(const std::string& in_name, const bool in_active);
+    };
+  
+  
+  class scope
+    {
+    public:
+    
+    inline  scope(site* in_site);
+    inline ~scope();
+    
+    
+    private:
+    
+    site* s;
+    
+    u64 bytes_start;
+    u64 parallel_start;
+    
+    std::chrono::steady_clock::time_point time_start;
+    };
+  
+  
+  inline static site* get_site(const char* sig);
+  
+  inline static void reset();
+  
+  inline static void print();
+  inline static void print(std::ostream& o);
+  
+  inline static void print_json();
+  inline static void print_json(std::ostream& o);
+  
+  inline static void at_exit(const char* format);
+  
+  inline static void note_alloc(const size_t n_bytes);
+  inline static void note_parallel();
+  
+  
+  private:
+  
+  class state_type
+    {
+    public:
+    
+    #if !defined(ARMA_DONT_USE_STD_MUTEX)
+      std::mutex mutex;
+    #endif
+    
+    std::vector<site*> sites;
+    
+    std::string exit_format = "table";
+    };
+  
+  class exit_hook
+    {
+    public:
+    
+    inline ~exit_hook();
+    };
+  
+  struct entry
+    {
+    std::string name;
+    u64         n_calls;
+    u64         n_nanosec;
+    u64         n_bytes;
+    u64         n_parallel;
+    };
+  
+  inline static state_type& get_state();
+  
+  inline static u64& thread_bytes();
+  inline static u64& thread_parallel();
+  
+  inline static bool parse_sig(std::string& name, const char* sig);
+  
+  inline static void collect(std::vector<entry>& out);
+  };
+
+
+
+//! @}
@@ -0,0 +1,413 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup arma_profiler
+//! @{
+
+
+
+inline
+arma_profiler::site::site(const std::string& in_name, const bool in_active)
+  : name      (in_name  )
+  , active    (in_active)
+  , n_calls   (0)
+  , n_nanosec (0)
+  , n_bytes   (0)
+  , n_parallel(0)
+  {
+  }
+
+
+
+inline
+arma_profiler::scope::scope(arma_profiler::site* in_site)
+  : s             ( (in_site->active) ? in_site : nullptr )
+  , bytes_start   (0)
+  , parallel_start(0)
+  {
+  if(s == nullptr)  { return; }
+  
+  bytes_start    = arma_profiler::thread_bytes();
+  parallel_start = arma_profiler::thread_parallel();
+  time_start     = std::chrono::steady_clock::now();
+  }
+
+
+
+inline
+arma_profiler::scope::~scope()
+  {
+  if(s == nullptr)  { return; }
+  
+  const std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+  
+  const u64 n_nanosec = u64( std::chrono::duration_cast<std::chrono::nanoseconds>(time_end - time_start).count() );
+  
+  s->n_calls.fetch_add(  u64(1),                                          std::memory_order_relaxed);
+  s->n_nanosec.fetch_add(n_nanosec,                                       std::memory_order_relaxed);
+  s->n_bytes.fetch_add(  arma_profiler::thread_bytes() - bytes_start,     std::memory_order_relaxed);
+  
+  if(arma_profiler::thread_parallel() != parallel_start)  { s->n_parallel.fetch_add(u64(1), std::memory_order_relaxed); }
+  }
+
+
+
+//! print the statistics at program exit, in the format selected via at_exit()
+inline
+arma_profiler::exit_hook::~exit_hook()
+  {
+  #if defined(ARMA_PROFILE)
+    {
+    state_type& state = arma_profiler::get_state();
+    
+    bool        have_sites = false;
+    std::string format;
+    
+      {
+      #if !defined(ARMA_DONT_USE_STD_MUTEX)
+        const std::lock_guard<std::mutex> lock(state.mutex);
+      #endif
+      
+      have_sites = (state.sites.empty() == false);
+      format     = state.exit_format;
+      }
+    
+    if(have_sites && (format == "table"))  { arma_profiler::print(get_cerr_stream());      }
+    if(have_sites && (format == "json" ))  { arma_profiler::print_json(get_cerr_stream()); }
+    }
+  #endif
+  }
+
+
+
+//! the state and the sites it holds are deliberately never deleted:
+//! the static site pointers declared by arma_extra_debug_sigprint() can still be used by destructors of other static objects
+inline
+arma_profiler::state_type&
+arma_profiler::get_state()
+  {
+  static state_type* const state = new state_type;
+  
+  static exit_hook hook;
+  
+  return *state;
+  }
+
+
+
+inline
+u64&
+arma_profiler::thread_bytes()
+  {
+  #if defined(ARMA_PROFILE)
+    static thread_local u64 val = 0;
+  #else
+    static u64 val = 0;
+  #endif
+  
+  return val;
+  }
+
+
+
+inline
+u64&
+arma_profiler::thread_parallel()
+  {
+  #if defined(ARMA_PROFILE)
+    static thread_local u64 val = 0;
+  #else
+    static u64 val = 0;
+  #endif
+  
+  return val;
+  }
+
+
+
+//! extract the function name from the signature, and determine whether the function is instrumented
+inline
+bool
+arma_profiler::parse_sig(std::string& name, const char* sig)
+  {
+  const std::string full(sig);
+  
+  // the name is the token before the argument list, which may contain spaces within template arguments
+  
+  size_t end = full.find('(');
+  
+  if( (end != std::string::npos) && (end >= 8) && (full.compare(end-8, 10, "operator()") == 0) )  { end = full.find('(', end+2); }
+  
+  if(end == std::string::npos)  { end = full.size(); }
+  
+  size_t start = end;
+  int    depth = 0;
+  
+  while(start > 0)
+    {
+    const char c = full[start-1];
+    
+         if(c == '>')  { ++depth; }
+    else if(c == '<')  { --depth; }
+    else if( (c == ' ') && (depth <= 0) )  { break; }
+    
+    --start;
+    }
+  
+  name = full.substr(start, end - start);
+  
+  if(name.compare(0, 6, "arma::") == 0)  { name.erase(0, 6); }
+  
+  const char* prefixes[] = { "op_", "glue_", "spop_", "spglue_", "mtop_", "mtglue_", "mtspop_", "eop_", "eglue_", "gemm", "gemv", "syrk", "herk", "auxlib::", "sp_auxlib::" };
+  
+  for(size_t i=0; i < (sizeof(prefixes) / sizeof(prefixes[0])); ++i)
+    {
+    if(name.compare(0, std::strlen(prefixes[i]), prefixes[i]) == 0)  { return true; }
+    }
+  
+  return false;
+  }
+
+
+
+//! called once per instantiated function, via the static variable declared by arma_extra_debug_sigprint()
+inline
+arma_profiler::site*
+arma_profiler::get_site(const char* sig)
+  {
+  static site* const inactive_site = new site(std::string(), false);  // never deleted; see get_state()
+  
+  std::string name;
+  
+  if(arma_profiler::parse_sig(name, sig) == false)  { return inactive_site; }
+  
+  site* s = new site(name, true);
+  
+  state_type& state = arma_profiler::get_state();
+  
+  #if !defined(ARMA_DONT_USE_STD_MUTEX)
+    const std::lock_guard<std::mutex> lock(state.mutex);
+  #endif
+  
+  state.sites.push_back(s);
+  
+  return s;
+  }
+
+
+
+inline
+void
+arma_profiler::note_alloc(const size_t n_bytes)
+  {
+  arma_profiler::thread_bytes() += u64(n_bytes);
+  }
+
+
+
+inline
+void
+arma_profiler::note_parallel()
+  {
+  arma_profiler::thread_parallel() += u64(1);
+  }
+
+
+
+//! gather the records, merging instantiations of the same function, and sort by decreasing time
+inline
+void
+arma_profiler::collect(std::vector<arma_profiler::entry>& out)
+  {
+  out.clear();
+  
+  state_type& state = arma_profiler::get_state();
+  
+  #if !defined(ARMA_DONT_USE_STD_MUTEX)
+    const std::lock_guard<std::mutex> lock(state.mutex);
+  #endif
+  
+  std::map<std::string, entry> merged;
+  
+  for(size_t i=0; i < state.sites.size(); ++i)
+    {
+    const site& s = *(state.sites[i]);
+    
+    const u64 n_calls = s.n_calls.load(std::memory_order_relaxed);
+    
+    if(n_calls == 0)  { continue; }
+    
+    entry& e = merged[s.name];
+    
+    e.name        = s.name;
+    e.n_calls    += n_calls;
+    e.n_nanosec  += s.n_nanosec.load(std::memory_order_relaxed);
+    e.n_bytes    += s.n_bytes.load(std::memory_order_relaxed);
+    e.n_parallel += s.n_parallel.load(std::memory_order_relaxed);
+    }
+  
+  for(std::map<std::string, entry>::const_iterator it = merged.begin(); it != merged.end(); ++it)
+    {
+    out.push_back(it->second);
+    }
+  
+  std::stable_sort( out.begin(), out.end(), [](const entry& a, const entry& b) { return (a.n_nanosec > b.n_nanosec); } );
+  }
+
+
+
+inline
+void
+arma_profiler::reset()
+  {
+  state_type& state = arma_profiler::get_state();
+  
+  #if !defined(ARMA_DONT_USE_STD_MUTEX)
+    const std::lock_guard<std::mutex> lock(state.mutex);
+  #endif
+  
+  for(size_t i=0; i < state.sites.size(); ++i)
+    {
+    site& s = *(state.sites[i]);
+    
+    s.n_calls    = 0;
+    s.n_nanosec  = 0;
+    s.n_bytes    = 0;
+    s.n_parallel = 0;
+    }
+  }
+
+
+
+inline
+void
+arma_profiler::print()
+  {
+  arma_profiler::print(get_cout_stream());
+  }
+
+
+
+//! summary table, sorted by decreasing time
+inline
+void
+arma_profiler::print(std::ostream& o)
+  {
+  std::vector<entry> entries;
+  
+  arma_profiler::collect(entries);
+  
+  const std::ios::fmtflags orig_flags     = o.flags();
+  const std::streamsize    orig_precision = o.precision();
+  
+  o.unsetf(std::ios::scientific);
+  o.setf(std::ios::fixed);
+  o.precision(3);
+  
+  o.width(12);  o << "calls";
+  o.width(14);  o << "time_ms";
+  o.width(14);  o << "temp_MB";
+  o.width(10);  o << "parallel";
+  o << "  function" << '\n';
+  
+  for(size_t i=0; i < entries.size(); ++i)
+    {
+    const entry& e = entries[i];
+    
+    o.width(12);  o << e.n_calls;
+    o.width(14);  o << double(e.n_nanosec) / double(1e6);
+    o.width(14);  o << double(e.n_bytes) / double(1024*1024);
+    o.width(10);  o << e.n_parallel;
+    o << "  " << e.name << '\n';
+    }
+  
+  o.flush();
+  
+  o.flags(orig_flags);
+  o.precision(orig_precision);
+  }
+
+
+
+inline
+void
+arma_profiler::print_json()
+  {
+  arma_profiler::print_json(get_cout_stream());
+  }
+
+
+
+inline
+void
+arma_profiler::print_json(std::ostream& o)
+  {
+  std::vector<entry> entries;
+  
+  arma_profiler::collect(entries);
+  
+  o << '[';
+  
+  for(size_t i=0; i < entries.size(); ++i)
+    {
+    const entry& e = entries[i];
+    
+    std::string name;
+    
+    for(size_t j=0; j < e.name.size(); ++j)
+      {
+      const char c = e.name[j];
+      
+      if( (c == '"') || (c == '\\') )  { name.push_back('\\'); }
+      
+      name.push_back(c);
+      }
+    
+    o << ((i == 0) ? "\n" : ",\n");
+    o << "  {\"function\": \"" << name << "\", \"calls\": " << e.n_calls << ", \"time_ns\": " << e.n_nanosec;
+    o << ", \"temp_bytes\": " << e.n_bytes << ", \"parallel_calls\": " << e.n_parallel << '}';
+    }
+  
+  o << "\n]\n";
+  
+  o.flush();
+  }
+
+
+
+//! select the output produced at program exit: "table" (default), "json" or "none"
+inline
+void
+arma_profiler::at_exit(const char* format)
+  {
+  const std::string format_str(format);
+  
+  arma_debug_check( ((format_str != "table") && (format_str != "json") && (format_str != "none")), "arma_profiler::at_exit(): unknown format" );
+  
+  state_type& state = arma_profiler::get_state();
+  
+  #if !defined(ARMA_DONT_USE_STD_MUTEX)
+    const std::lock_guard<std::mutex> lock(state.mutex);
+  #endif
+  
+  state.exit_format = format_str;
+  }
+
+
+
+//! @}
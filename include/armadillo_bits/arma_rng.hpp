@@ -34,6 +34,10 @@
   #undef ARMA_USE_THREAD_LOCAL
 #endif
 
+#if defined(ARMA_RNG_ALT)
+  #undef ARMA_USE_CTR_RNG
+#endif
+
 
 // NOTE: ARMA_WARMUP_PRODUCER enables a workaround 
 // NOTE: for thread_local issue on macOS 11 and/or AppleClang 12.0
@@ -93,6 +97,8 @@ class arma_rng
   
   #if   defined(ARMA_RNG_ALT)
     static constexpr int rng_method = 2;
+  #elif defined(ARMA_USE_CTR_RNG)
+    static constexpr int rng_method = 3;
   #elif defined(ARMA_USE_CXX11_RNG)
     static constexpr int rng_method = 1;
   #else
@@ -221,6 +227,14 @@ inline
 void
 arma_rng::set_seed(const arma_rng::seed_type val)
   {
+  #if defined(ARMA_USE_CTR_RNG)
+    {
+    arma_rng_ctr::set_seed(val);
+    }
+  #endif
+  
+  // NOTE: the producers below are seeded in all cases, as randg() doesn't use the counter-based RNG
+  
   #if   defined(ARMA_RNG_ALT)
     {
     arma_rng_alt::set_seed(val);
@@ -332,6 +346,14 @@ struct arma_rng::randi
       {
       return eT( arma_rng_alt::randi_val() );
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      int out = 0;
+      
+      arma_rng_ctr::randi_fill(&out, uword(1), 0, std::numeric_limits<int>::max());
+      
+      return eT(out);
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       constexpr double scale = double(std::numeric_limits<int>::max()) / double(std::mt19937_64::max());
@@ -361,7 +383,7 @@ struct arma_rng::randi
       {
       return arma_rng_alt::randi_max_val();
       }
-    #elif defined(ARMA_USE_CXX11_RNG)
+    #elif defined(ARMA_USE_CXX11_RNG) || defined(ARMA_USE_CTR_RNG)
       {
       return std::numeric_limits<int>::max();
       }
@@ -382,6 +404,10 @@ struct arma_rng::randi
       {
       arma_rng_alt::randi_fill(mem, N, a, b);
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      arma_rng_ctr::randi_fill(mem, N, a, b);
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::uniform_int_distribution<int> local_i_distr(a, b);
@@ -427,6 +453,14 @@ struct arma_rng::randu
       {
       return eT( arma_rng_alt::randu_val() );
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      eT out = eT(0);
+      
+      arma_rng_ctr::randu_fill(&out, uword(1), double(0), double(1));
+      
+      return out;
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       constexpr double scale = double(1.0) / double(std::mt19937_64::max());
@@ -456,6 +490,10 @@ struct arma_rng::randu
       {
       for(uword i=0; i < N; ++i)  { mem[i] = eT( arma_rng_alt::randu_val() ); }
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      arma_rng_ctr::randu_fill(mem, N, double(0), double(1));
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::uniform_real_distribution<double> local_u_distr;
@@ -496,6 +534,10 @@ struct arma_rng::randu
       
       for(uword i=0; i < N; ++i)  { mem[i] = eT( arma_rng_alt::randu_val() * r + a ); }
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      arma_rng_ctr::randu_fill(mem, N, a, b);
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::uniform_real_distribution<double> local_u_distr(a,b);
@@ -540,6 +582,14 @@ struct arma_rng::randu< std::complex<T> >
       
       return std::complex<T>(a, b);
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      std::complex<T> out;
+      
+      arma_rng_ctr::randu_fill(&out, uword(1), double(0), double(1));
+      
+      return out;
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::uniform_real_distribution<double> local_u_distr;
@@ -581,6 +631,10 @@ struct arma_rng::randu< std::complex<T> >
         mem[i] = std::complex<T>(a, b);
         }
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      arma_rng_ctr::randu_fill(mem, N, double(0), double(1));
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::uniform_real_distribution<double> local_u_distr;
@@ -647,6 +701,10 @@ struct arma_rng::randu< std::complex<T> >
         mem[i] = std::complex<T>(tmp1, tmp2);
         }
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      arma_rng_ctr::randu_fill(mem, N, a, b);
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::uniform_real_distribution<double> local_u_distr(a,b);
@@ -714,6 +772,14 @@ struct arma_rng::randn
       {
       return eT( arma_rng_alt::randn_val() );
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      eT out = eT(0);
+      
+      arma_rng_ctr::randn_fill(&out, uword(1), double(0), double(1));
+      
+      return out;
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::normal_distribution<double> local_n_distr;
@@ -743,6 +809,15 @@ struct arma_rng::randn
       {
       arma_rng_alt::randn_dual_val(out1, out2);
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      eT tmp[2];
+      
+      arma_rng_ctr::randn_fill(&(tmp[0]), uword(2), double(0), double(1));
+      
+      out1 = tmp[0];
+      out2 = tmp[1];
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::normal_distribution<double> local_n_distr;
@@ -779,6 +854,10 @@ struct arma_rng::randn
       
       if(i < N)  { mem[i] = eT( arma_rng_alt::randn_val() ); }
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      arma_rng_ctr::randn_fill(mem, N, double(0), double(1));
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::normal_distribution<double> local_n_distr;
@@ -837,6 +916,10 @@ struct arma_rng::randn
         mem[i] = (val_i * sd) + mu;
         }
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      arma_rng_ctr::randn_fill(mem, N, mu, sd);
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::normal_distribution<double> local_n_distr(mu, sd);
@@ -927,6 +1010,10 @@ struct arma_rng::randn< std::complex<T> >
       {
       for(uword i=0; i < N; ++i)  { mem[i] = std::complex<T>( arma_rng::randn< std::complex<T> >() ); }
       }
+    #elif defined(ARMA_USE_CTR_RNG)
+      {
+      arma_rng_ctr::randn_fill(mem, N, double(0), double(1));
+      }
     #elif defined(ARMA_USE_CXX11_RNG)
       {
       std::normal_distribution<double> local_n_distr;
@@ -0,0 +1,378 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup arma_rng_ctr
+//! @{
+
+
+// counter-based RNG, using the Philox4x32-10 function described in:
+// John K. Salmon, Mark A. Moraes, Ron O. Dror, David E. Shaw.
+// Parallel Random Numbers: As Easy as 1, 2, 3.
+// Proceedings of the International Conference for High Performance Computing (SC11), 2011.
+// https://doi.org/10.1145/2063384.2063405
+//
+// each block of random bits is a pure function of (seed, stream, position),
+// so a fill of N elements can be split over any number of threads
+// and still produce exactly the same values
+
+
+class arma_rng_ctr
+  {
+  public:
+  
+  typedef u64 seed_type;
+  
+  class state_type
+    {
+    public:
+    
+    seed_type          key;
+    u64                stream;
+    std::atomic<u64>   position;
+    
+    inline state_type(const seed_type in_key, const u64 in_stream)
+      : key     (in_key   )
+      , stream  (in_stream)
+      , position(0        )
+      {
+      }
+    };
+  
+  static constexpr seed_type default_seed = seed_type(5489u);
+  
+  inline static state_type& get_state();
+  
+  inline static void set_seed(const seed_type val);
+  inline static void set_stream(const u64 stream);
+  inline static void skip(const u64 n_blocks);
+  
+  inline static void philox(u32* out, const u64 ctr_lo, const u64 ctr_hi, const seed_type key);
+  
+  template<typename eT> inline static void randu_fill(eT* mem, const uword N, const double a, const double b);
+  template<typename eT> inline static void randn_fill(eT* mem, const uword N, const double mu, const double sd);
+  template<typename eT> inline static void randi_fill(eT* mem, const uword N, const int a, const int b);
+  
+  template<typename T> inline static void randu_fill(std::complex<T>* mem, const uword N, const double a, const double b);
+  template<typename T> inline static void randn_fill(std::complex<T>* mem, const uword N, const double mu, const double sd);
+  
+
+  private:
+  
+  arma_inline static double to_unit_closed_open(const u32 hi, const u32 lo);
+  arma_inline static double to_unit_open_closed(const u32 hi, const u32 lo);
+  
+  arma_inline static void box_muller(double& out1, double& out2, const u32* bits);
+  
+  template<typename eT, typename functor>
+  inline static void fill_blocks(eT* mem, const uword N, const uword vals_per_block, const functor& F);
+  };
+
+
+
+inline
+arma_rng_ctr::state_type&
+arma_rng_ctr::get_state()
+  {
+  // NOTE: same thread_local restrictions as for the default producer in arma_rng.hpp
+  
+  #if defined(ARMA_FORCE_USE_THREAD_LOCAL) || ( (!defined(ARMA_DONT_USE_THREAD_LOCAL)) && (!(defined(__APPLE__) && defined(__GNUG__) && !defined(__clang__))) && (!(defined(__MINGW32__) || defined(__MINGW64__) || defined(__CYGWIN__) || defined(__MSYS__) || defined(__MSYS2__))) )
+    
+    // each thread has its own state; before any seed is set, each thread uses its own stream
+    
+    static std::atomic<u64> stream_counter(0);
+    
+    static thread_local state_type state(arma_rng_ctr::default_seed, stream_counter++);
+  
+  #else
+    
+    static state_type state(arma_rng_ctr::default_seed, 0);
+  
+  #endif
+  
+  return state;
+  }
+
+
+
+inline
+void
+arma_rng_ctr::set_seed(const arma_rng_ctr::seed_type val)
+  {
+  state_type& state = arma_rng_ctr::get_state();
+  
+  state.key      = val;
+  state.stream   = 0;
+  state.position = 0;
+  }
+
+
+
+//! select an independent stream for the current thread, and restart it from the beginning
+inline
+void
+arma_rng_ctr::set_stream(const u64 stream)
+  {
+  state_type& state = arma_rng_ctr::get_state();
+  
+  state.stream   = stream;
+  state.position = 0;
+  }
+
+
+
+//! advance the current stream by the given number of blocks; each block provides two real or one complex value
+inline
+void
+arma_rng_ctr::skip(const u64 n_blocks)
+  {
+  arma_rng_ctr::get_state().position += n_blocks;
+  }
+
+
+
+inline
+void
+arma_rng_ctr::philox(u32* out, const u64 ctr_lo, const u64 ctr_hi, const arma_rng_ctr::seed_type key)
+  {
+  const u64 M0 = u64(0xD2511F53u);
+  const u64 M1 = u64(0xCD9E8D57u);
+  
+  const u32 W0 = u32(0x9E3779B9u);
+  const u32 W1 = u32(0xBB67AE85u);
+  
+  u32 c0 = u32(ctr_lo      );
+  u32 c1 = u32(ctr_lo >> 32);
+  u32 c2 = u32(ctr_hi      );
+  u32 c3 = u32(ctr_hi >> 32);
+  
+  u32 k0 = u32(key      );
+  u32 k1 = u32(key >> 32);
+  
+  for(uword round=0; round < 10; ++round)
+    {
+    const u64 prod0 = M0 * u64(c0);
+    const u64 prod1 = M1 * u64(c2);
+    
+    const u32 hi0 = u32(prod0 >> 32);
+    const u32 lo0 = u32(prod0      );
+    const u32 hi1 = u32(prod1 >> 32);
+    const u32 lo1 = u32(prod1      );
+    
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    
+    k0 += W0;
+    k1 += W1;
+    }
+  
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+  }
+
+
+
+//! 53 random bits mapped to [0,1)
+arma_inline
+double
+arma_rng_ctr::to_unit_closed_open(const u32 hi, const u32 lo)
+  {
+  const u64 bits = ( (u64(hi) << 32) | u64(lo) ) >> 11;
+  
+  return double(bits) * double(1.1102230246251565404e-16);  // 2^-53
+  }
+
+
+
+//! 53 random bits mapped to (0,1]
+arma_inline
+double
+arma_rng_ctr::to_unit_open_closed(const u32 hi, const u32 lo)
+  {
+  const u64 bits = ( (u64(hi) << 32) | u64(lo) ) >> 11;
+  
+  return double(bits + 1) * double(1.1102230246251565404e-16);  // 2^-53
+  }
+
+
+
+//! basic form of the Box-Muller transformation; unlike the polar form it has no rejection loop,
+//! so each block of bits always gives exactly two normally distributed values
+arma_inline
+void
+arma_rng_ctr::box_muller(double& out1, double& out2, const u32* bits)
+  {
+  const double u1 = arma_rng_ctr::to_unit_open_closed(bits[0], bits[1]);
+  const double u2 = arma_rng_ctr::to_unit_closed_open(bits[2], bits[3]);
+  
+  const double r     = std::sqrt( double(-2) * std::log(u1) );
+  const double theta = double(6.28318530717958647692) * u2;
+  
+  out1 = r * std::cos(theta);
+  out2 = r * std::sin(theta);
+  }
+
+
+
+//! F(out, n_vals, bits) stores up to vals_per_block values derived from the given block of random bits
+template<typename eT, typename functor>
+inline
+void
+arma_rng_ctr::fill_blocks(eT* mem, const uword N, const uword vals_per_block, const functor& F)
+  {
+  if(N == 0)  { return; }
+  
+  state_type& state = arma_rng_ctr::get_state();
+  
+  const uword n_blocks = (N + vals_per_block - 1) / vals_per_block;
+  
+  const seed_type key    = state.key;
+  const u64       stream = state.stream;
+  const u64       start  = state.position.fetch_add(u64(n_blocks));
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (N >= (arma_config::mp_threshold * uword(4))) && mp_gate<eT>::eval(N) )
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword block=0; block < n_blocks; ++block)
+        {
+        u32 bits[4];
+        
+        arma_rng_ctr::philox(bits, start + u64(block), stream, key);
+        
+        const uword offset = block * vals_per_block;
+        
+        F( &(mem[offset]), (std::min)(vals_per_block, N - offset), bits );
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword block=0; block < n_blocks; ++block)
+    {
+    u32 bits[4];
+    
+    arma_rng_ctr::philox(bits, start + u64(block), stream, key);
+    
+    const uword offset = block * vals_per_block;
+    
+    F( &(mem[offset]), (std::min)(vals_per_block, N - offset), bits );
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+arma_rng_ctr::randu_fill(eT* mem, const uword N, const double a, const double b)
+  {
+  const double r = b - a;
+  
+  arma_rng_ctr::fill_blocks(mem, N, uword(2), [&](eT* out, const uword n_vals, const u32* bits)
+    {
+                    out[0] = eT( arma_rng_ctr::to_unit_closed_open(bits[0], bits[1]) * r + a );
+    if(n_vals > 1)  { out[1] = eT( arma_rng_ctr::to_unit_closed_open(bits[2], bits[3]) * r + a ); }
+    });
+  }
+
+
+
+template<typename eT>
+inline
+void
+arma_rng_ctr::randn_fill(eT* mem, const uword N, const double mu, const double sd)
+  {
+  arma_rng_ctr::fill_blocks(mem, N, uword(2), [&](eT* out, const uword n_vals, const u32* bits)
+    {
+    double val1 = double(0);
+    double val2 = double(0);
+    
+    arma_rng_ctr::box_muller(val1, val2, bits);
+                    
+                    out[0] = eT( (val1 * sd) + mu );
+    if(n_vals > 1)  { out[1] = eT( (val2 * sd) + mu ); }
+    });
+  }
+
+
+
+template<typename eT>
+inline
+void
+arma_rng_ctr::randi_fill(eT* mem, const uword N, const int a, const int b)
+  {
+  const double length = double(b) - double(a) + double(1);
+  
+  arma_rng_ctr::fill_blocks(mem, N, uword(2), [&](eT* out, const uword n_vals, const u32* bits)
+    {
+    const double val1 = std::floor( arma_rng_ctr::to_unit_closed_open(bits[0], bits[1]) * length ) + double(a);
+    const double val2 = std::floor( arma_rng_ctr::to_unit_closed_open(bits[2], bits[3]) * length ) + double(a);
+                    
+                    out[0] = eT( (std::min)(double(b), val1) );
+    if(n_vals > 1)  { out[1] = eT( (std::min)(double(b), val2) ); }
+    });
+  }
+
+
+
+template<typename T>
+inline
+void
+arma_rng_ctr::randu_fill(std::complex<T>* mem, const uword N, const double a, const double b)
+  {
+  const double r = b - a;
+  
+  arma_rng_ctr::fill_blocks(mem, N, uword(1), [&](std::complex<T>* out, const uword, const u32* bits)
+    {
+    const T tmp1 = T( arma_rng_ctr::to_unit_closed_open(bits[0], bits[1]) * r + a );
+    const T tmp2 = T( arma_rng_ctr::to_unit_closed_open(bits[2], bits[3]) * r + a );
+    
+    out[0] = std::complex<T>(tmp1, tmp2);
+    });
+  }
+
+
+
+template<typename T>
+inline
+void
+arma_rng_ctr::randn_fill(std::complex<T>* mem, const uword N, const double mu, const double sd)
+  {
+  arma_rng_ctr::fill_blocks(mem, N, uword(1), [&](std::complex<T>* out, const uword, const u32* bits)
+    {
+    double val1 = double(0);
+    double val2 = double(0);
+    
+    arma_rng_ctr::box_muller(val1, val2, bits);
+    
+    out[0] = std::complex<T>( T((val1 * sd) + mu), T((val2 * sd) + mu) );
+    });
+  }
+
+
+
+//! @}
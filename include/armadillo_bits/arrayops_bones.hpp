@@ -185,6 +185,15 @@ class arrayops
   inplace_div_base(eT* dest, const eT val, const uword n_elem);
   
   
+  // 
+  // array = cumsum(array)
+  
+  template<typename eT>
+  inline static
+  void
+  inplace_cumsum_mp(eT* mem, const uword n_elem);
+  
+  
   // 
   // scalar = op(array)
   
@@ -193,6 +202,21 @@ class arrayops
   eT
   accumulate(const eT* src, const uword n_elem);
   
+  template<typename eT, typename accessor_type>
+  arma_hot inline static
+  eT
+  accumulate_compensated(const accessor_type& X, const uword start, const uword endp1);
+  
+  template<typename eT>
+  arma_hot inline static
+  eT
+  accumulate_mp(const eT* src, const uword n_elem);
+  
+  template<typename eT>
+  arma_inline static
+  void
+  compensated_add(eT& sum, eT& comp, const eT val);
+  
   template<typename eT>
   arma_hot inline static
   eT
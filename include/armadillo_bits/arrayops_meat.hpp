@@ -898,6 +898,8 @@ inline
 eT
 arrayops::accumulate(const eT* src, const uword n_elem)
   {
+  if(arma_config::compensated_sum && is_real<eT>::value)  { return arrayops::accumulate_compensated<eT>(src, 0, n_elem); }
+  
   #if defined(__FAST_MATH__)
     {
     eT acc = eT(0);
@@ -939,6 +941,155 @@ arrayops::accumulate(const eT* src, const uword n_elem)
 
 
 
+//! Kahan-Babuska (Neumaier) compensated addition of val to sum
+template<typename eT>
+arma_inline
+void
+arrayops::compensated_add(eT& sum, eT& comp, const eT val)
+  {
+  const eT tmp = sum + val;
+  
+  comp += (eop_aux::arma_abs(sum) >= eop_aux::arma_abs(val)) ? ((sum - tmp) + val) : ((val - tmp) + sum);
+  
+  sum = tmp;
+  }
+
+
+
+//! compensated summation of X[i] for i in [start, endp1), where X is a pointer or an element accessor providing operator[]
+//! (eg. Proxy::ea_type); each block of elements is summed directly, and the block sums are added via compensated_add();
+//! the accuracy is close to fully compensated summation, at close to the speed of direct summation
+template<typename eT, typename accessor_type>
+inline
+eT
+arrayops::accumulate_compensated(const accessor_type& X, const uword start, const uword endp1)
+  {
+  const uword block_size = 128;
+  
+  eT sum  = eT(0);
+  eT comp = eT(0);
+  
+  uword i = start;
+  
+  for(; (i + block_size) <= endp1; i += block_size)
+    {
+    eT acc1 = eT(0);
+    eT acc2 = eT(0);
+    
+    for(uword j=i; j < (i + block_size); j+=2)  { acc1 += X[j]; acc2 += X[j+1]; }
+    
+    arrayops::compensated_add(sum, comp, acc1 + acc2);
+    }
+  
+  for(; i < endp1; ++i)  { arrayops::compensated_add(sum, comp, eT(X[i])); }
+  
+  return sum + comp;
+  }
+
+
+
+//! parallelised version of accumulate(), using one partial sum per thread;
+//! as the work is statically divided among threads, the result is deterministic for a given number of threads
+template<typename eT>
+inline
+eT
+arrayops::accumulate_mp(const eT* src, const uword n_elem)
+  {
+  #if defined(ARMA_USE_OPENMP)
+    {
+    // summation is memory bound, so each thread needs a sizeable amount of work to be worthwhile
+    
+    if( (n_elem >= (arma_config::mp_threshold * uword(32))) && mp_gate<eT>::eval(n_elem) )
+      {
+      const int   n_threads_max = mp_thread_limit::get();
+      const uword n_threads_use = (std::min)(uword(podarray_prealloc_n_elem::val), uword(n_threads_max));
+      const uword chunk_size    = n_elem / n_threads_use;
+      
+      podarray<eT> partial_accs(n_threads_use);
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = (thread_id+0) * chunk_size;
+        const uword endp1 = ((thread_id+1) == n_threads_use) ? n_elem : ((thread_id+1) * chunk_size);
+        
+        partial_accs[thread_id] = arrayops::accumulate(&(src[start]), endp1 - start);
+        }
+      
+      return arrayops::accumulate(partial_accs.memptr(), n_threads_use);
+      }
+    }
+  #endif
+  
+  return arrayops::accumulate(src, n_elem);
+  }
+
+
+
+//! in-place inclusive prefix sum;
+//! the parallelised version scans each chunk separately and then offsets each chunk by the totals of the preceding chunks
+template<typename eT>
+inline
+void
+arrayops::inplace_cumsum_mp(eT* mem, const uword n_elem)
+  {
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (n_elem >= (arma_config::mp_threshold * uword(32))) && mp_gate<eT>::eval(n_elem) )
+      {
+      const int   n_threads_max = mp_thread_limit::get();
+      const uword n_threads_use = (std::min)(uword(podarray_prealloc_n_elem::val), uword(n_threads_max));
+      const uword chunk_size    = n_elem / n_threads_use;
+      
+      podarray<eT> partial_sums(n_threads_use);
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = (thread_id+0) * chunk_size;
+        const uword endp1 = ((thread_id+1) == n_threads_use) ? n_elem : ((thread_id+1) * chunk_size);
+        
+        eT acc = eT(0);
+        
+        for(uword i=start; i < endp1; ++i)  { acc += mem[i]; mem[i] = acc; }
+        
+        partial_sums[thread_id] = acc;
+        }
+      
+      eT offset = eT(0);
+      
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const eT tmp = partial_sums[thread_id];
+        
+        partial_sums[thread_id] = offset;
+        
+        offset += tmp;
+        }
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=1; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = (thread_id+0) * chunk_size;
+        const uword endp1 = ((thread_id+1) == n_threads_use) ? n_elem : ((thread_id+1) * chunk_size);
+        
+        const eT chunk_offset = partial_sums[thread_id];
+        
+        for(uword i=start; i < endp1; ++i)  { mem[i] += chunk_offset; }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  eT acc = eT(0);
+  
+  for(uword i=0; i < n_elem; ++i)  { acc += mem[i]; mem[i] = acc; }
+  }
+
+
+
 template<typename eT>
 inline
 eT
@@ -185,6 +185,9 @@ class auxlib
   template<typename eT>
   inline static bool chol_pivot(Mat<eT>& X, Mat<uword>& P, const uword layout);
   
+  template<typename eT>
+  inline static bool chol_update(Mat<eT>& X, const Mat<eT>& V, const uword layout, const bool downdate);
+  
   
   //
   // hessenberg decomposition
@@ -208,6 +211,24 @@ class auxlib
   template<typename  T, typename T1>
   inline static bool qr_pivot(Mat< std::complex<T> >& Q, Mat< std::complex<T> >& R, Mat<uword>& P, const Base<std::complex<T>,T1>& X);
   
+  template<typename eT>
+  inline static void qr_insert_col(Mat<eT>& Q, Mat<eT>& R, const uword col, const Col<eT>& x);
+  
+  template<typename eT>
+  inline static void qr_delete_col(Mat<eT>& Q, Mat<eT>& R, const uword col);
+  
+  template<typename eT>
+  inline static void qr_insert_row(Mat<eT>& Q, Mat<eT>& R, const uword row, const Col<eT>& x);
+  
+  template<typename eT>
+  inline static void qr_delete_row(Mat<eT>& Q, Mat<eT>& R, const uword row);
+  
+  template<typename eT>
+  inline static typename get_pod_type<eT>::result qr_orth(Col<eT>& w, Col<eT>& coeffs, const Mat<eT>& Q);
+  
+  template<typename eT>
+  inline static void qr_orth_any(Col<eT>& w, const Mat<eT>& Q);
+  
   
   //
   // svd
@@ -289,6 +310,11 @@ class auxlib
   
   //
   
+  template<typename T1>
+  inline static bool solve_square_mixed(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr, const bool try_sympd);
+  
+  //
+  
   template<typename T1>
   inline static bool solve_rect_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr);
   
@@ -399,6 +425,12 @@ class auxlib
   template<typename  T>
   inline static  T rcond_trimat(const Mat< std::complex<T> >& A, const uword layout);
   
+  template<typename eT>
+  inline static eT rcond_trimat_packed(const Col<eT>& AP, const uword N, const uword layout);
+  
+  template<typename  T>
+  inline static  T rcond_trimat_packed(const Col< std::complex<T> >& AP, const uword N, const uword layout);
+  
   
   //
   // lu_rcond (rcond from pre-computed LU decomposition)
@@ -421,6 +453,18 @@ class auxlib
   template<typename  T>
   inline static  T lu_rcond_band(const Mat< std::complex<T> >& AB, const uword KL, const uword KU, const podarray<blas_int>& ipiv, const T norm_val);
   
+  template<typename eT>
+  inline static eT lu_rcond_sympd_band(const Mat<eT>& AB, const uword KD, const eT norm_val);
+  
+  template<typename  T>
+  inline static  T lu_rcond_sympd_band(const Mat< std::complex<T> >& AB, const uword KD, const T norm_val);
+  
+  template<typename eT>
+  inline static eT ldl_rcond(const Mat<eT>& A, const podarray<blas_int>& ipiv, const eT norm_val);
+  
+  template<typename  T>
+  inline static  T ldl_rcond(const Mat< std::complex<T> >& A, const podarray<blas_int>& ipiv, const T norm_val);
+  
   
   //
   // misc
@@ -442,6 +486,15 @@ class auxlib
   
   template<typename eT>
   inline static typename get_pod_type<eT>::result norm1_band(const Mat<eT>& A, const uword KL, const uword KU);
+  
+  template<typename eT>
+  inline static void givens_gen(typename get_pod_type<eT>::result& c, eT& s, eT& r, const eT a, const eT b);
+  
+  template<typename eT>
+  inline static void givens_rows(Mat<eT>& X, const uword p, const uword q, const uword start_col, const typename get_pod_type<eT>::result c, const eT s);
+  
+  template<typename eT>
+  inline static void givens_cols(Mat<eT>& X, const uword p, const uword q, const typename get_pod_type<eT>::result c, const eT s);
   };
 
 
@@ -464,4 +517,32 @@ namespace qz_helper
 
 
 
+//! holds a dense decomposition in LAPACK format, so that it can be reused for solving many systems
+template<typename eT>
+class dense_factoriser_worker
+  {
+  private:
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  uword              method_id = 0;  // 1 = LU, 2 = Cholesky, 3 = LDL^T, 4 = QR
+  Mat<eT>            F;              // factors as produced by getrf, potrf, sytrf/hetrf or geqrf
+  podarray<blas_int> ipiv;           // pivot indices for LU and LDL^T
+  podarray<eT>       tau;            // scalar factors of the elementary reflectors for QR
+  
+  
+  public:
+  
+  inline dense_factoriser_worker();
+  
+  inline bool factorise(T& out_rcond, Mat<eT>& A, const uword in_method_id);
+  
+  inline bool solve(Mat<eT>& X, const Mat<eT>& B);
+  
+  inline      dense_factoriser_worker(const dense_factoriser_worker&) = delete;
+  inline void operator=              (const dense_factoriser_worker&) = delete;
+  };
+
+
+
 //! @}
@@ -2544,6 +2544,110 @@ auxlib::chol_pivot(Mat<eT>& X, Mat<uword>& P, const uword layout)
 
 
 
+//! rank-k update (or downdate) of a Cholesky factor, using one column of V at a time;
+//! the factor of A + V*V.t() (or A - V*V.t()) is computed in O(n^2) operations per column of V;
+//! returns false if the downdated matrix is not positive definite, in which case X is in an undefined state
+template<typename eT>
+inline
+bool
+auxlib::chol_update(Mat<eT>& X, const Mat<eT>& V, const uword layout, const bool downdate)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = X.n_rows;
+  
+  const T sigma = (downdate) ? T(-1) : T(+1);
+  
+  // each step k is a (hyperbolic for downdates) rotation with parameters alpha, beta and r:
+  // new_L(:,k) = (alpha*L(:,k) + sigma*conj(beta)*x) / r  and  new_x = (alpha*x - beta*L(:,k)) / r
+  
+  podarray< T> alpha_vals(N);
+  podarray<eT>  beta_vals(N);
+  podarray< T>     r_vals(N);
+  
+  podarray<eT> x(N);
+  
+  eT* x_mem = x.memptr();
+  
+  for(uword v_col=0; v_col < V.n_cols; ++v_col)
+    {
+    arrayops::copy(x_mem, V.colptr(v_col), N);
+    
+    if(layout == 0)
+      {
+      // upper triangular factor: process column by column, applying the rotations found so far
+      
+      for(uword j=0; j < N; ++j)
+        {
+        eT* R_colmem = X.colptr(j);
+        
+        eT x_j = x_mem[j];
+        
+        for(uword k=0; k < j; ++k)
+          {
+          const T  alpha = alpha_vals[k];
+          const eT beta  =  beta_vals[k];
+          const T  r     =     r_vals[k];
+          
+          const eT R_kj = R_colmem[k];
+          
+          R_colmem[k] = (alpha * R_kj + sigma * beta * access::alt_conj(x_j)) / r;
+          x_j         = (alpha * x_j  -         beta * access::alt_conj(R_kj)) / r;
+          }
+        
+        const T alpha    = access::tmp_real(R_colmem[j]);
+        const T beta_abs = std::abs(x_j);
+        const T r2       = alpha*alpha + sigma*beta_abs*beta_abs;
+        
+        if( (alpha <= T(0)) || (r2 <= T(0)) || (arma_isfinite(r2) == false) )  { return false; }
+        
+        const T r = std::sqrt(r2);
+        
+        alpha_vals[j] = alpha;
+         beta_vals[j] = x_j;
+            r_vals[j] = r;
+        
+        R_colmem[j] = eT(r);
+        }
+      }
+    else
+      {
+      // lower triangular factor: each step updates one column
+      
+      for(uword k=0; k < N; ++k)
+        {
+        eT* L_colmem = X.colptr(k);
+        
+        const T  alpha    = access::tmp_real(L_colmem[k]);
+        const eT beta     = x_mem[k];
+        const T  beta_abs = std::abs(beta);
+        const T  r2       = alpha*alpha + sigma*beta_abs*beta_abs;
+        
+        if( (alpha <= T(0)) || (r2 <= T(0)) || (arma_isfinite(r2) == false) )  { return false; }
+        
+        const T r = std::sqrt(r2);
+        
+        L_colmem[k] = eT(r);
+        
+        for(uword j=k+1; j < N; ++j)
+          {
+          const eT L_jk = L_colmem[j];
+          const eT x_j  = x_mem[j];
+          
+          L_colmem[j] = (alpha * L_jk + sigma * access::alt_conj(beta) * x_j) / r;
+          x_mem[j]    = (alpha * x_j  -                         beta * L_jk) / r;
+          }
+        }
+      }
+    }
+  
+  return true;
+  }
+
+
+
 //
 // hessenberg decomposition
 template<typename eT, typename T1>
@@ -2963,6 +3067,318 @@ auxlib::qr_pivot(Mat< std::complex<T> >& Q, Mat< std::complex<T> >& R, Mat<uword
 
 
 
+//! update the QR decomposition of A (obtained via qr() or qr_econ()) after inserting x as column 'col' of A;
+//! uses O(m^2) operations for full decompositions and O(m*n) operations for economical decompositions
+template<typename eT>
+inline
+void
+auxlib::qr_insert_col(Mat<eT>& Q, Mat<eT>& R, const uword col, const Col<eT>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  if(Q.n_cols < Q.n_rows)
+    {
+    // economical decomposition: extend Q with the component of x orthogonal to Q
+    
+    Col<eT> w = x;
+    Col<eT> r;
+    
+    const T rho = auxlib::qr_orth(w, r, Q);
+    
+    if(rho > T(0))  { w /= rho; } else { auxlib::qr_orth_any(w, Q); }
+    
+    const uword K = Q.n_cols;
+    
+    Q.insert_cols(K, w);
+    R.insert_rows(K, 1);
+    
+    r.resize(K+1);
+    
+    r[K] = eT(rho);
+    
+    R.insert_cols(col, r);
+    }
+  else
+    {
+    const Col<eT> r = Q.t() * x;
+    
+    R.insert_cols(col, r);
+    }
+  
+  // zero the new column below the diagonal, from the bottom up
+  
+  T  c  = T(0);
+  eT s  = eT(0);
+  eT rr = eT(0);
+  
+  for(uword i = (R.n_rows > 0) ? (R.n_rows-1) : uword(0); i > col; --i)
+    {
+    auxlib::givens_gen(c, s, rr, R.at(i-1,col), R.at(i,col));
+    
+    R.at(i-1,col) = rr;
+    R.at(i,  col) = eT(0);
+    
+    auxlib::givens_rows(R, i-1, i, col+1, c, s);
+    auxlib::givens_cols(Q, i-1, i, c, s);
+    }
+  }
+
+
+
+//! update the QR decomposition of A (obtained via qr() or qr_econ()) after deleting column 'col' of A
+template<typename eT>
+inline
+void
+auxlib::qr_delete_col(Mat<eT>& Q, Mat<eT>& R, const uword col)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  R.shed_col(col);
+  
+  // R is now upper Hessenberg from column 'col' onwards
+  
+  const uword N = (std::min)(R.n_rows, R.n_cols + 1);
+  
+  T  c  = T(0);
+  eT s  = eT(0);
+  eT rr = eT(0);
+  
+  for(uword i=col; (i+1) < N; ++i)
+    {
+    auxlib::givens_gen(c, s, rr, R.at(i,i), R.at(i+1,i));
+    
+    R.at(i,  i) = rr;
+    R.at(i+1,i) = eT(0);
+    
+    auxlib::givens_rows(R, i, i+1, i+1, c, s);
+    auxlib::givens_cols(Q, i, i+1, c, s);
+    }
+  
+  if( (Q.n_cols < Q.n_rows) && (R.n_rows > R.n_cols) )
+    {
+    // economical decomposition: the last row of R is now zero
+    
+    Q.shed_col(Q.n_cols-1);
+    R.shed_row(R.n_rows-1);
+    }
+  }
+
+
+
+//! update the QR decomposition of A (obtained via qr() or qr_econ()) after inserting x as row 'row' of A
+template<typename eT>
+inline
+void
+auxlib::qr_insert_row(Mat<eT>& Q, Mat<eT>& R, const uword row, const Col<eT>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword K = Q.n_cols;
+  
+  const bool is_econ = (Q.n_cols < Q.n_rows);
+  
+  // [A_top; x.st(); A_bottom] = [Q_top 0; 0 1; Q_bottom 0] * [R; x.st()]
+  
+  Q.insert_rows(row, 1);
+  Q.insert_cols(K,   1);
+  
+  Q.at(row,K) = eT(1);
+  
+  R.insert_rows(K, 1);
+  
+  const eT* x_mem = x.memptr();
+  
+  for(uword j=0; j < R.n_cols; ++j)  { R.at(K,j) = x_mem[j]; }
+  
+  // zero the new row of R
+  
+  T  c  = T(0);
+  eT s  = eT(0);
+  eT rr = eT(0);
+  
+  const uword N = (std::min)(K, R.n_cols);
+  
+  for(uword j=0; j < N; ++j)
+    {
+    auxlib::givens_gen(c, s, rr, R.at(j,j), R.at(K,j));
+    
+    R.at(j,j) = rr;
+    R.at(K,j) = eT(0);
+    
+    auxlib::givens_rows(R, j, K, j+1, c, s);
+    auxlib::givens_cols(Q, j, K, c, s);
+    }
+  
+  if( is_econ && (K >= R.n_cols) )
+    {
+    Q.shed_col(K);
+    R.shed_row(K);
+    }
+  }
+
+
+
+//! update the QR decomposition of A (obtained via qr() or qr_econ()) after deleting row 'row' of A
+template<typename eT>
+inline
+void
+auxlib::qr_delete_row(Mat<eT>& Q, Mat<eT>& R, const uword row)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const bool is_econ = (Q.n_cols < Q.n_rows);
+  
+  bool extend = false;
+  
+  if(is_econ)
+    {
+    // temporarily extend Q so that e_row is in the span of its columns
+    
+    Col<eT> w(Q.n_rows, fill::zeros);
+    Col<eT> coeffs;
+    
+    w[row] = eT(1);
+    
+    const T rho = auxlib::qr_orth(w, coeffs, Q);
+    
+    if(rho > T(0))
+      {
+      w /= rho;
+      
+      Q.insert_cols(Q.n_cols, w);
+      R.insert_rows(R.n_rows, 1);
+      }
+    else
+      {
+      // e_row is already in the span of Q; the reduced Q will need an extra column
+      
+      extend = true;
+      }
+    }
+  
+  // rotate row 'row' of Q into a multiple of e_0, from the right
+  
+  T  c  = T(0);
+  eT s  = eT(0);
+  eT rr = eT(0);
+  
+  for(uword j = (Q.n_cols > 0) ? (Q.n_cols-1) : uword(0); j > 0; --j)
+    {
+    auxlib::givens_gen(c, s, rr, access::alt_conj(Q.at(row,j-1)), access::alt_conj(Q.at(row,j)));
+    
+    auxlib::givens_cols(Q, j-1, j, c, s);
+    auxlib::givens_rows(R, j-1, j, j-1, c, s);
+    }
+  
+  Q.shed_row(row);
+  Q.shed_col(0);
+  R.shed_row(0);
+  
+  if(extend && (Q.n_cols < Q.n_rows))
+    {
+    Col<eT> w;
+    
+    auxlib::qr_orth_any(w, Q);
+    
+    Q.insert_cols(Q.n_cols, w);
+    R.insert_rows(R.n_rows, 1);
+    }
+  }
+
+
+
+//! orthogonalise w against the columns of Q, using one reorthogonalisation step if required (DGKS criterion);
+//! coeffs is set to Q.t()*w (before orthogonalisation); returns the norm of the orthogonalised w,
+//! or zero if w is numerically in the span of Q
+template<typename eT>
+inline
+typename get_pod_type<eT>::result
+auxlib::qr_orth(Col<eT>& w, Col<eT>& coeffs, const Mat<eT>& Q)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const T w_norm = norm(w);
+  
+  coeffs = Q.t() * w;
+  
+  w -= Q * coeffs;
+  
+  T new_norm = norm(w);
+  
+  if(new_norm < (T(0.7071) * w_norm))
+    {
+    const Col<eT> extra = Q.t() * w;
+    
+    w -= Q * extra;
+    
+    coeffs += extra;
+    
+    const T old_norm = new_norm;
+    
+    new_norm = norm(w);
+    
+    if(new_norm < (T(0.7071) * old_norm))  { new_norm = T(0); }
+    }
+  
+  return new_norm;
+  }
+
+
+
+//! generate a unit vector orthogonal to the columns of Q, which must have fewer columns than rows
+template<typename eT>
+inline
+void
+auxlib::qr_orth_any(Col<eT>& w, const Mat<eT>& Q)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  // the unit vector e_i with smallest projection onto Q is furthest from the span of Q
+  
+  const uword N = Q.n_rows;
+  
+  podarray<T> proj(N);
+  
+  proj.zeros();
+  
+  for(uword col=0; col < Q.n_cols; ++col)
+    {
+    const eT* Q_colmem = Q.colptr(col);
+    
+    for(uword row=0; row < N; ++row)  { const T tmp = std::abs(Q_colmem[row]); proj[row] += tmp*tmp; }
+    }
+  
+  uword index = 0;
+  
+  for(uword row=1; row < N; ++row)  { if(proj[row] < proj[index])  { index = row; } }
+  
+  Col<eT> coeffs;
+  
+  w.zeros(N);
+  
+  w[index] = eT(1);
+  
+  T w_norm = auxlib::qr_orth(w, coeffs, Q);
+  
+  if(w_norm <= T(0))  { w_norm = norm(w); }  // only possible through severe loss of orthogonality in Q
+  
+  w /= w_norm;
+  }
+
+
+
 template<typename eT>
 inline
 bool
@@ -4642,20 +5058,28 @@ auxlib::solve_sympd_refine(Mat< std::complex<typename T1::pod_type> >& out, type
 
 
 
-//! solve a non-square full-rank system via QR or LQ decomposition
+//! solve a system of linear equations via LU or Cholesky decomposition computed in single precision,
+//! followed by iterative refinement in the precision of A (approach used by LAPACK's dsgesv and dsposv);
+//! returns false if the refinement does not converge, in which case the caller is expected to fall back to a full precision solver
 template<typename T1>
 inline
 bool
-auxlib::solve_rect_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr)
+auxlib::solve_square_mixed(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr, const bool try_sympd)
   {
   arma_extra_debug_sigprint();
   
   #if defined(ARMA_USE_LAPACK)
     {
     typedef typename T1::elem_type eT;
+    typedef typename T1::pod_type   T;
     
-    const unwrap<T1>   U(B_expr.get_ref());
-    const Mat<eT>& B = U.M;
+    typedef typename std::conditional< is_double<T>::value, float, T >::type  low_T;
+    typedef typename std::conditional< is_cx<eT>::yes, std::complex<low_T>, low_T >::type  low_eT;
+    
+    out_rcond = T(0);
+    
+    const quasi_unwrap<T1> UB(B_expr.get_ref());
+    const Mat<eT>& B     = UB.M;
     
     arma_debug_check( (A.n_rows != B.n_rows), "solve(): number of rows in given matrices must be the same" );
     
@@ -4663,39 +5087,199 @@ auxlib::solve_rect_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::elem_
     
     arma_debug_assert_blas_size(A,B);
     
-    Mat<eT> tmp( (std::max)(A.n_rows, A.n_cols), B.n_cols, arma_nozeros_indicator() );
+    // the single precision copies must not overflow
     
-    if(arma::size(tmp) == arma::size(B))
-      {
-      tmp = B;
-      }
-    else
-      {
-      tmp.zeros();
-      tmp(0,0, arma::size(B)) = B;
-      }
+    const T low_max = T( std::numeric_limits<low_T>::max() );
     
-    char      trans     = 'N';
-    blas_int  m         = blas_int(A.n_rows);
-    blas_int  n         = blas_int(A.n_cols);
-    blas_int  lda       = blas_int(A.n_rows);
-    blas_int  ldb       = blas_int(tmp.n_rows);
-    blas_int  nrhs      = blas_int(B.n_cols);
-    blas_int  min_mn    = (std::min)(m,n);
-    blas_int  lwork_min = (std::max)(blas_int(1), min_mn + (std::max)(min_mn, nrhs));
-    blas_int  info      = 0;
+    const eT* A_mem = A.memptr();
+    const eT* B_mem = B.memptr();
     
-    blas_int lwork_proposed = 0;
+    for(uword i=0; i < A.n_elem; ++i)  { if( (std::abs(A_mem[i]) <= low_max) == false )  { return false; } }
+    for(uword i=0; i < B.n_elem; ++i)  { if( (std::abs(B_mem[i]) <= low_max) == false )  { return false; } }
     
-    if(A.n_elem >= ((is_cx<eT>::yes) ? uword(256) : uword(1024)))
+    Mat<low_eT> AF = conv_to< Mat<low_eT> >::from(A);
+    
+    char     uplo  = 'L';
+    char     trans = 'N';
+    blas_int n     = blas_int(A.n_rows);
+    blas_int nrhs  = blas_int(B.n_cols);
+    blas_int info  = blas_int(0);
+    
+    podarray<blas_int> ipiv;
+    
+    bool use_chol = false;
+    
+    if(try_sympd)
       {
-      eT        work_query[2] = {};
-      blas_int lwork_query    = -1;
+      const low_T norm_val = auxlib::norm1_sym(AF);
       
-      arma_extra_debug_print("lapack::gels()");
-      lapack::gels<eT>( &trans, &m, &n, &nrhs, A.memptr(), &lda, tmp.memptr(), &ldb, &work_query[0], &lwork_query, &info );
-      
-      if(info != 0)  { return false; }
+      arma_extra_debug_print("lapack::potrf()");
+      lapack::potrf<low_eT>(&uplo, &n, AF.memptr(), &n, &info);
+      
+      if(info == 0)
+        {
+        use_chol  = true;
+        out_rcond = T( auxlib::lu_rcond_sympd<low_T>(AF, norm_val) );
+        }
+      else
+        {
+        arma_extra_debug_print("auxlib::solve_square_mixed(): lapack::potrf() failed; using lapack::getrf()");
+        
+        AF = conv_to< Mat<low_eT> >::from(A);
+        }
+      }
+    
+    if(use_chol == false)
+      {
+      const low_T norm_val = auxlib::norm1_gen(AF);
+      
+      ipiv.set_size(A.n_rows + 2);  // +2 for paranoia
+      
+      arma_extra_debug_print("lapack::getrf()");
+      lapack::getrf<low_eT>(&n, &n, AF.memptr(), &n, ipiv.memptr(), &info);
+      
+      if(info != 0)  { return false; }
+      
+      out_rcond = T( auxlib::lu_rcond<low_T>(AF, norm_val) );
+      }
+    
+    // refinement stops when each column satisfies  ||r||_inf <= sqrt(n) * eps * ||A||_inf * ||x||_inf
+    
+    const T A_norm = op_norm::mat_norm_inf(A);
+    const T tol    = std::sqrt(T(A.n_rows)) * std::numeric_limits<T>::epsilon() * A_norm;
+    
+    const uword max_iter = 30;
+    
+    Mat<low_eT> CF = conv_to< Mat<low_eT> >::from(B);
+    Mat<eT>     R;
+    
+    out.zeros(A.n_cols, B.n_cols);
+    
+    for(uword iter=0; iter <= max_iter; ++iter)
+      {
+      // CF holds the current right-hand side (B for the first pass, the residual afterwards); overwritten with the correction
+      
+      if(use_chol)
+        {
+        arma_extra_debug_print("lapack::potrs()");
+        lapack::potrs<low_eT>(&uplo, &n, &nrhs, AF.memptr(), &n, CF.memptr(), &n, &info);
+        }
+      else
+        {
+        arma_extra_debug_print("lapack::getrs()");
+        lapack::getrs<low_eT>(&trans, &n, &nrhs, AF.memptr(), &n, ipiv.memptr(), CF.memptr(), &n, &info);
+        }
+      
+      if(info != 0)  { return false; }
+      
+      out += conv_to< Mat<eT> >::from(CF);
+      
+      if(out.internal_has_nonfinite())  { return false; }
+      
+      R = B - A*out;
+      
+      bool converged = true;
+      
+      for(uword col=0; col < B.n_cols; ++col)
+        {
+        const eT* R_colmem =   R.colptr(col);
+        const eT* X_colmem = out.colptr(col);
+        
+        T R_norm = T(0);
+        T X_norm = T(0);
+        
+        for(uword row=0; row < A.n_rows; ++row)
+          {
+          R_norm = (std::max)(R_norm, std::abs(R_colmem[row]));
+          X_norm = (std::max)(X_norm, std::abs(X_colmem[row]));
+          }
+        
+        if(R_norm > (tol * X_norm))  { converged = false; break; }
+        }
+      
+      if(converged)
+        {
+        arma_extra_debug_print("auxlib::solve_square_mixed(): converged after iterations: ", iter);
+        
+        return true;
+        }
+      
+      if(iter < max_iter)  { CF = conv_to< Mat<low_eT> >::from(R); }
+      }
+    
+    arma_extra_debug_print("auxlib::solve_square_mixed(): refinement did not converge");
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(out_rcond);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_ignore(try_sympd);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! solve a non-square full-rank system via QR or LQ decomposition
+template<typename T1>
+inline
+bool
+auxlib::solve_rect_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::elem_type eT;
+    
+    const unwrap<T1>   U(B_expr.get_ref());
+    const Mat<eT>& B = U.M;
+    
+    arma_debug_check( (A.n_rows != B.n_rows), "solve(): number of rows in given matrices must be the same" );
+    
+    if(A.is_empty() || B.is_empty())  { out.zeros(A.n_cols, B.n_cols); return true; }
+    
+    arma_debug_assert_blas_size(A,B);
+    
+    Mat<eT> tmp( (std::max)(A.n_rows, A.n_cols), B.n_cols, arma_nozeros_indicator() );
+    
+    if(arma::size(tmp) == arma::size(B))
+      {
+      tmp = B;
+      }
+    else
+      {
+      tmp.zeros();
+      tmp(0,0, arma::size(B)) = B;
+      }
+    
+    char      trans     = 'N';
+    blas_int  m         = blas_int(A.n_rows);
+    blas_int  n         = blas_int(A.n_cols);
+    blas_int  lda       = blas_int(A.n_rows);
+    blas_int  ldb       = blas_int(tmp.n_rows);
+    blas_int  nrhs      = blas_int(B.n_cols);
+    blas_int  min_mn    = (std::min)(m,n);
+    blas_int  lwork_min = (std::max)(blas_int(1), min_mn + (std::max)(min_mn, nrhs));
+    blas_int  info      = 0;
+    
+    blas_int lwork_proposed = 0;
+    
+    if(A.n_elem >= ((is_cx<eT>::yes) ? uword(256) : uword(1024)))
+      {
+      eT        work_query[2] = {};
+      blas_int lwork_query    = -1;
+      
+      arma_extra_debug_print("lapack::gels()");
+      lapack::gels<eT>( &trans, &m, &n, &nrhs, A.memptr(), &lda, tmp.memptr(), &ldb, &work_query[0], &lwork_query, &info );
+      
+      if(info != 0)  { return false; }
       
       lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
       }
@@ -6366,6 +6950,82 @@ auxlib::rcond_trimat(const Mat< std::complex<T> >& A, const uword layout)
 
 
 
+template<typename eT>
+inline
+eT
+auxlib::rcond_trimat_packed(const Col<eT>& AP, const uword N, const uword layout)
+  {
+  #if defined(ARMA_USE_LAPACK)
+    {
+    char     norm_id = '1';
+    char     uplo    = (layout == 0) ? 'U' : 'L';
+    char     diag    = 'N';
+    blas_int n       = blas_int(N);
+    eT       rcond   = eT(0);
+    blas_int info    = blas_int(0);
+    
+    podarray<eT>        work(3*N);
+    podarray<blas_int> iwork(  N);
+    
+    arma_extra_debug_print("lapack::tpcon()");
+    lapack::tpcon(&norm_id, &uplo, &diag, &n, AP.memptr(), &rcond, work.memptr(), iwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return eT(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(AP);
+    arma_ignore(N);
+    arma_ignore(layout);
+    arma_stop_logic_error("rcond(): use of LAPACK must be enabled");
+    return eT(0);
+    }
+  #endif
+  }
+
+
+
+template<typename T>
+inline
+T
+auxlib::rcond_trimat_packed(const Col< std::complex<T> >& AP, const uword N, const uword layout)
+  {
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename std::complex<T> eT;
+    
+    char     norm_id = '1';
+    char     uplo    = (layout == 0) ? 'U' : 'L';
+    char     diag    = 'N';
+    blas_int n       = blas_int(N);
+    T        rcond   = T(0);
+    blas_int info    = blas_int(0);
+    
+    podarray<eT>  work(2*N);
+    podarray< T> rwork(  N);
+    
+    arma_extra_debug_print("lapack::cx_tpcon()");
+    lapack::cx_tpcon(&norm_id, &uplo, &diag, &n, AP.memptr(), &rcond, work.memptr(), rwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return T(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(AP);
+    arma_ignore(N);
+    arma_ignore(layout);
+    arma_stop_logic_error("rcond(): use of LAPACK must be enabled");
+    return T(0);
+    }
+  #endif
+  }
+
+
+
 template<typename eT>
 inline
 eT
@@ -6603,20 +7263,85 @@ auxlib::lu_rcond_band(const Mat< std::complex<T> >& AB, const uword KL, const uw
 
 
 
-template<typename T1>
+template<typename eT>
 inline
-bool
-auxlib::crippled_lapack(const Base<typename T1::elem_type, T1>&)
+eT
+auxlib::lu_rcond_sympd_band(const Mat<eT>& AB, const uword KD, const eT norm_val)
+  {
+  #if defined(ARMA_USE_LAPACK)
+    {
+    const uword N = AB.n_cols;  // order of the original square matrix A
+    
+    char     uplo  = 'L';
+    blas_int n     = blas_int(N);
+    blas_int kd    = blas_int(KD);
+    blas_int ldab  = blas_int(AB.n_rows);
+    eT       rcond = eT(0);
+    blas_int info  = blas_int(0);
+    
+    podarray<eT>        work(3*N);
+    podarray<blas_int> iwork(  N);
+    
+    arma_extra_debug_print("lapack::pbcon()");
+    lapack::pbcon<eT>(&uplo, &n, &kd, AB.memptr(), &ldab, &norm_val, &rcond, work.memptr(), iwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return eT(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(AB);
+    arma_ignore(KD);
+    arma_ignore(norm_val);
+    return eT(0);
+    }
+  #endif
+  }
+
+
+
+template<typename T>
+inline
+T
+auxlib::lu_rcond_sympd_band(const Mat< std::complex<T> >& AB, const uword KD, const T norm_val)
   {
   #if defined(ARMA_CRIPPLED_LAPACK)
     {
-    arma_extra_debug_print("auxlib::crippled_lapack(): true");
+    arma_ignore(AB);
+    arma_ignore(KD);
+    arma_ignore(norm_val);
+    return T(0);
+    }
+  #elif defined(ARMA_USE_LAPACK)
+    {
+    typedef typename std::complex<T> eT;
     
-    return (is_cx<typename T1::elem_type>::yes);
+    const uword N = AB.n_cols;  // order of the original square matrix A
+    
+    char     uplo  = 'L';
+    blas_int n     = blas_int(N);
+    blas_int kd    = blas_int(KD);
+    blas_int ldab  = blas_int(AB.n_rows);
+    T        rcond = T(0);
+    blas_int info  = blas_int(0);
+    
+    podarray<eT>  work(2*N);
+    podarray< T> rwork(  N);
+    
+    arma_extra_debug_print("lapack::cx_pbcon()");
+    lapack::cx_pbcon<T>(&uplo, &n, &kd, AB.memptr(), &ldab, &norm_val, &rcond, work.memptr(), rwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return T(0); }
+    
+    return rcond;
     }
   #else
     {
-    return false;
+    arma_ignore(AB);
+    arma_ignore(KD);
+    arma_ignore(norm_val);
+    return T(0);
     }
   #endif
   }
@@ -6625,11 +7350,107 @@ auxlib::crippled_lapack(const Base<typename T1::elem_type, T1>&)
 
 template<typename eT>
 inline
-bool
-auxlib::rudimentary_sym_check(const Mat<eT>& X)
+eT
+auxlib::ldl_rcond(const Mat<eT>& A, const podarray<blas_int>& ipiv, const eT norm_val)
   {
-  arma_extra_debug_sigprint();
-  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    char     uplo  = 'L';
+    blas_int n     = blas_int(A.n_rows);  // assuming square matrix
+    eT       rcond = eT(0);
+    blas_int info  = blas_int(0);
+    
+    podarray<eT>        work(2*A.n_rows);
+    podarray<blas_int> iwork(  A.n_rows);
+    
+    arma_extra_debug_print("lapack::sycon()");
+    lapack::sycon<eT>(&uplo, &n, A.memptr(), &n, ipiv.memptr(), &norm_val, &rcond, work.memptr(), iwork.memptr(), &info);
+    
+    if(info != blas_int(0))  { return eT(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(A);
+    arma_ignore(ipiv);
+    arma_ignore(norm_val);
+    return eT(0);
+    }
+  #endif
+  }
+
+
+
+template<typename T>
+inline
+T
+auxlib::ldl_rcond(const Mat< std::complex<T> >& A, const podarray<blas_int>& ipiv, const T norm_val)
+  {
+  #if defined(ARMA_CRIPPLED_LAPACK)
+    {
+    arma_ignore(A);
+    arma_ignore(ipiv);
+    arma_ignore(norm_val);
+    return T(0);
+    }
+  #elif defined(ARMA_USE_LAPACK)
+    {
+    typedef typename std::complex<T> eT;
+    
+    char     uplo  = 'L';
+    blas_int n     = blas_int(A.n_rows);  // assuming square matrix
+    T        rcond = T(0);
+    blas_int info  = blas_int(0);
+    
+    podarray<eT> work(2*A.n_rows);
+    
+    arma_extra_debug_print("lapack::cx_hecon()");
+    lapack::cx_hecon<T>(&uplo, &n, A.memptr(), &n, ipiv.memptr(), &norm_val, &rcond, work.memptr(), &info);
+    
+    if(info != blas_int(0))  { return T(0); }
+    
+    return rcond;
+    }
+  #else
+    {
+    arma_ignore(A);
+    arma_ignore(ipiv);
+    arma_ignore(norm_val);
+    return T(0);
+    }
+  #endif
+  }
+
+
+
+template<typename T1>
+inline
+bool
+auxlib::crippled_lapack(const Base<typename T1::elem_type, T1>&)
+  {
+  #if defined(ARMA_CRIPPLED_LAPACK)
+    {
+    arma_extra_debug_print("auxlib::crippled_lapack(): true");
+    
+    return (is_cx<typename T1::elem_type>::yes);
+    }
+  #else
+    {
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+auxlib::rudimentary_sym_check(const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
   const uword N   = X.n_rows;
   const uword Nm2 = N-2;
   
@@ -6803,6 +7624,83 @@ auxlib::norm1_band(const Mat<eT>& A, const uword KL, const uword KU)
 
 
 
+//! generate a Givens rotation G = [c s; -conj(s) c] such that G*[a; b] = [r; 0], with c real
+template<typename eT>
+inline
+void
+auxlib::givens_gen(typename get_pod_type<eT>::result& c, eT& s, eT& r, const eT a, const eT b)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  const T a_abs = std::abs(a);
+  const T b_abs = std::abs(b);
+  
+  if(b_abs == T(0))  { c = T(1); s = eT(0); r = a; return; }
+  
+  if(a_abs == T(0))  { c = T(0); s = access::alt_conj(b) / b_abs; r = eT(b_abs); return; }
+  
+  const T scale = (std::max)(a_abs, b_abs);
+  const T a_tmp = a_abs / scale;
+  const T b_tmp = b_abs / scale;
+  const T t     = scale * std::sqrt(a_tmp*a_tmp + b_tmp*b_tmp);
+  
+  const eT phase = a / a_abs;
+  
+  c = a_abs / t;
+  s = phase * access::alt_conj(b) / t;
+  r = phase * t;
+  }
+
+
+
+//! apply Givens rotation G to rows p and q of X, starting at column start_col
+template<typename eT>
+inline
+void
+auxlib::givens_rows(Mat<eT>& X, const uword p, const uword q, const uword start_col, const typename get_pod_type<eT>::result c, const eT s)
+  {
+  const eT s_conj = access::alt_conj(s);
+  
+  for(uword col=start_col; col < X.n_cols; ++col)
+    {
+    eT& X_p = X.at(p,col);
+    eT& X_q = X.at(q,col);
+    
+    const eT tmp_p = X_p;
+    const eT tmp_q = X_q;
+    
+    X_p =  c*tmp_p + s*tmp_q;
+    X_q = -s_conj*tmp_p + c*tmp_q;
+    }
+  }
+
+
+
+//! apply the conjugate transpose of Givens rotation G to columns p and q of X
+template<typename eT>
+inline
+void
+auxlib::givens_cols(Mat<eT>& X, const uword p, const uword q, const typename get_pod_type<eT>::result c, const eT s)
+  {
+  const eT s_conj = access::alt_conj(s);
+  
+  eT* X_p = X.colptr(p);
+  eT* X_q = X.colptr(q);
+  
+  const uword N = X.n_rows;
+  
+  for(uword row=0; row < N; ++row)
+    {
+    const eT tmp_p = X_p[row];
+    const eT tmp_q = X_q[row];
+    
+    X_p[row] =  c*tmp_p + s_conj*tmp_q;
+    X_q[row] = -s*tmp_p + c*tmp_q;
+    }
+  }
+
+
+
 //
 
 
@@ -7047,4 +7945,250 @@ ptr_cast(blas_int (*function)(const std::complex<T>*, const std::complex<T>*))
 }  // end of namespace qz_helper
 
 
+
+//
+
+
+
+template<typename eT>
+inline
+dense_factoriser_worker<eT>::dense_factoriser_worker()
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::factorise(typename dense_factoriser_worker<eT>::T& out_rcond, Mat<eT>& A, const uword in_method_id)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    out_rcond = T(0);
+    method_id = in_method_id;
+    
+    F.steal_mem(A);
+    
+    if(F.is_empty())  { out_rcond = Datum<T>::inf; return true; }
+    
+    arma_debug_assert_blas_size(F);
+    
+    blas_int m    = blas_int(F.n_rows);
+    blas_int n    = blas_int(F.n_cols);
+    blas_int info = blas_int(0);
+    
+    if(method_id == 1)
+      {
+      const T norm_val = auxlib::norm1_gen(F);
+      
+      ipiv.set_size(F.n_rows + 2);  // +2 for paranoia
+      
+      arma_extra_debug_print("lapack::getrf()");
+      lapack::getrf<eT>(&n, &n, F.memptr(), &n, ipiv.memptr(), &info);
+      
+      if(info != blas_int(0))  { return false; }
+      
+      out_rcond = auxlib::lu_rcond<T>(F, norm_val);
+      
+      return true;
+      }
+    
+    if(method_id == 2)
+      {
+      const T norm_val = auxlib::norm1_sym(F);
+      
+      char uplo = 'L';
+      
+      arma_extra_debug_print("lapack::potrf()");
+      lapack::potrf<eT>(&uplo, &n, F.memptr(), &n, &info);
+      
+      if(info != blas_int(0))  { return false; }
+      
+      out_rcond = auxlib::lu_rcond_sympd<T>(F, norm_val);
+      
+      return true;
+      }
+    
+    if(method_id == 3)
+      {
+      const T norm_val = auxlib::norm1_sym(F);
+      
+      char uplo = 'L';
+      
+      ipiv.set_size(F.n_rows + 2);  // +2 for paranoia
+      
+      eT        work_query[2] = {};
+      blas_int lwork_query    = blas_int(-1);
+      
+      if(is_cx<eT>::no )  { arma_extra_debug_print("lapack::sytrf()"); lapack::sytrf<eT>(&uplo, &n, F.memptr(), &n, ipiv.memptr(), &work_query[0], &lwork_query, &info); }
+      if(is_cx<eT>::yes)  { arma_extra_debug_print("lapack::hetrf()"); lapack::hetrf<eT>(&uplo, &n, F.memptr(), &n, ipiv.memptr(), &work_query[0], &lwork_query, &info); }
+      
+      if(info != blas_int(0))  { return false; }
+      
+      blas_int lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+      blas_int lwork_final    = (std::max)(lwork_proposed, blas_int(1));
+      
+      podarray<eT> work( static_cast<uword>(lwork_final) );
+      
+      if(is_cx<eT>::no )  { arma_extra_debug_print("lapack::sytrf()"); lapack::sytrf<eT>(&uplo, &n, F.memptr(), &n, ipiv.memptr(), work.memptr(), &lwork_final, &info); }
+      if(is_cx<eT>::yes)  { arma_extra_debug_print("lapack::hetrf()"); lapack::hetrf<eT>(&uplo, &n, F.memptr(), &n, ipiv.memptr(), work.memptr(), &lwork_final, &info); }
+      
+      if(info != blas_int(0))  { return false; }
+      
+      out_rcond = auxlib::ldl_rcond(F, ipiv, norm_val);
+      
+      return true;
+      }
+    
+    if(method_id == 4)
+      {
+      tau.set_size(F.n_cols);
+      
+      eT        work_query[2] = {};
+      blas_int lwork_query    = blas_int(-1);
+      
+      arma_extra_debug_print("lapack::geqrf()");
+      lapack::geqrf<eT>(&m, &n, F.memptr(), &m, tau.memptr(), &work_query[0], &lwork_query, &info);
+      
+      if(info != blas_int(0))  { return false; }
+      
+      blas_int lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+      blas_int lwork_final    = (std::max)(lwork_proposed, (std::max)(blas_int(1), n));
+      
+      podarray<eT> work( static_cast<uword>(lwork_final) );
+      
+      arma_extra_debug_print("lapack::geqrf()");
+      lapack::geqrf<eT>(&m, &n, F.memptr(), &m, tau.memptr(), work.memptr(), &lwork_final, &info);
+      
+      if(info != blas_int(0))  { return false; }
+      
+      // the condition of A in the least-squares sense is the condition of R
+      
+      const Mat<eT> R = trimatu( F.head_rows(F.n_cols) );
+      
+      out_rcond = auxlib::rcond_trimat(R, uword(0));
+      
+      return true;
+      }
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(out_rcond);
+    arma_ignore(A);
+    arma_ignore(in_method_id);
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::solve(Mat<eT>& X, const Mat<eT>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    if(F.is_empty() || B.is_empty())  { X.zeros(F.n_cols, B.n_cols); return true; }
+    
+    X = B;
+    
+    arma_debug_assert_blas_size(F, X);
+    
+    blas_int m    = blas_int(F.n_rows);
+    blas_int n    = blas_int(F.n_cols);
+    blas_int nrhs = blas_int(X.n_cols);
+    blas_int ldx  = blas_int(X.n_rows);
+    blas_int info = blas_int(0);
+    
+    if(method_id == 1)
+      {
+      char trans = 'N';
+      
+      arma_extra_debug_print("lapack::getrs()");
+      lapack::getrs<eT>(&trans, &n, &nrhs, F.memptr(), &n, ipiv.memptr(), X.memptr(), &ldx, &info);
+      
+      return (info == blas_int(0));
+      }
+    
+    if(method_id == 2)
+      {
+      char uplo = 'L';
+      
+      arma_extra_debug_print("lapack::potrs()");
+      lapack::potrs<eT>(&uplo, &n, &nrhs, F.memptr(), &n, X.memptr(), &ldx, &info);
+      
+      return (info == blas_int(0));
+      }
+    
+    if(method_id == 3)
+      {
+      char uplo = 'L';
+      
+      if(is_cx<eT>::no )  { arma_extra_debug_print("lapack::sytrs()"); lapack::sytrs<eT>(&uplo, &n, &nrhs, F.memptr(), &n, ipiv.memptr(), X.memptr(), &ldx, &info); }
+      if(is_cx<eT>::yes)  { arma_extra_debug_print("lapack::hetrs()"); lapack::hetrs<eT>(&uplo, &n, &nrhs, F.memptr(), &n, ipiv.memptr(), X.memptr(), &ldx, &info); }
+      
+      return (info == blas_int(0));
+      }
+    
+    if(method_id == 4)
+      {
+      // X = Q^H * B, followed by solving R * X = X
+      
+      char side  = 'L';
+      char trans = (is_cx<eT>::yes) ? 'C' : 'T';
+      
+      eT        work_query[2] = {};
+      blas_int lwork_query    = blas_int(-1);
+      
+      if(is_cx<eT>::no )  { arma_extra_debug_print("lapack::ormqr()"); lapack::ormqr<eT>(&side, &trans, &m, &nrhs, &n, F.memptr(), &m, tau.memptr(), X.memptr(), &ldx, &work_query[0], &lwork_query, &info); }
+      if(is_cx<eT>::yes)  { arma_extra_debug_print("lapack::unmqr()"); lapack::unmqr<eT>(&side, &trans, &m, &nrhs, &n, F.memptr(), &m, tau.memptr(), X.memptr(), &ldx, &work_query[0], &lwork_query, &info); }
+      
+      if(info != blas_int(0))  { return false; }
+      
+      blas_int lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+      blas_int lwork_final    = (std::max)(lwork_proposed, (std::max)(blas_int(1), nrhs));
+      
+      podarray<eT> work( static_cast<uword>(lwork_final) );
+      
+      if(is_cx<eT>::no )  { arma_extra_debug_print("lapack::ormqr()"); lapack::ormqr<eT>(&side, &trans, &m, &nrhs, &n, F.memptr(), &m, tau.memptr(), X.memptr(), &ldx, work.memptr(), &lwork_final, &info); }
+      if(is_cx<eT>::yes)  { arma_extra_debug_print("lapack::unmqr()"); lapack::unmqr<eT>(&side, &trans, &m, &nrhs, &n, F.memptr(), &m, tau.memptr(), X.memptr(), &ldx, work.memptr(), &lwork_final, &info); }
+      
+      if(info != blas_int(0))  { return false; }
+      
+      char uplo    = 'U';
+      char trans_R = 'N';
+      char diag    = 'N';
+      
+      arma_extra_debug_print("lapack::trtrs()");
+      lapack::trtrs<eT>(&uplo, &trans_R, &diag, &n, &nrhs, F.memptr(), &m, X.memptr(), &ldx, &info);
+      
+      if(info != blas_int(0))  { return false; }
+      
+      if(F.n_rows > F.n_cols)  { X.shed_rows(F.n_cols, F.n_rows-1); }
+      
+      return true;
+      }
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(B);
+    return false;
+    }
+  #endif
+  }
+
+
 //! @}
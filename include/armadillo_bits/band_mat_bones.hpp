@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup band_mat
+//! @{
+
+
+//! Dense square band matrix with kl subdiagonals and ku superdiagonals, in LAPACK band storage:
+//! element A(i,j) is held at row (ku+i-j) and column j of a (kl+ku+1) x n_cols matrix,
+//! so that memory scales with the bandwidth rather than with the square of the size.
+template<typename eT>
+class band_mat
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  const uword n_rows;  //!< number of rows (same as n_cols)
+  const uword n_cols;  //!< number of columns
+  const uword kl;      //!< number of subdiagonals
+  const uword ku;      //!< number of superdiagonals
+  
+  inline band_mat();
+  inline band_mat(const band_mat& x);
+  inline band_mat& operator=(const band_mat& x);
+  
+  inline band_mat(const uword in_n, const uword in_kl, const uword in_ku);
+  
+  template<typename T1> inline explicit band_mat(const Base<eT,T1>& expr);
+  template<typename T1> inline          band_mat(const Base<eT,T1>& expr, const uword in_kl, const uword in_ku);
+  
+  arma_inline       eT& at(const uword in_row, const uword in_col);
+  arma_inline const eT& at(const uword in_row, const uword in_col) const;
+  
+  inline StructValProxy< band_mat<eT> > operator()(const uword in_row, const uword in_col);
+  inline eT                             operator()(const uword in_row, const uword in_col) const;
+  
+  inline       subview_row<eT> diag(const sword in_id = 0);
+  inline const subview_row<eT> diag(const sword in_id = 0) const;
+  
+  inline bool in_band(const uword in_row, const uword in_col) const;
+  
+  inline       eT* memptr();
+  inline const eT* memptr() const;
+  
+  inline Mat<eT> as_dense() const;
+  
+  template<typename T1> inline void mul(Mat<eT>& out, const Base<eT,T1>& X) const;
+  
+  template<typename T1> inline bool solve(Mat<eT>& X, const Base<eT,T1>& B, const uword flags = uword(0)) const;
+  
+  
+  private:
+  
+  friend class StructValProxy< band_mat<eT> >;
+  
+  inline eT   get_elem(const uword in_row, const uword in_col) const;
+  inline void set_elem(const uword in_row, const uword in_col, const eT val);
+  
+  arma_aligned Mat<eT> AB;  //!< band storage, with kl+ku+1 rows
+  
+  inline void init(const Mat<eT>& A, const uword in_kl, const uword in_ku);
+  };
+
+
+
+//! @}
@@ -0,0 +1,544 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup band_mat
+//! @{
+
+
+
+template<typename eT>
+inline
+band_mat<eT>::band_mat()
+  : n_rows(0)
+  , n_cols(0)
+  , kl    (0)
+  , ku    (0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  AB.set_size(1,0);
+  }
+
+
+
+template<typename eT>
+inline
+band_mat<eT>::band_mat(const band_mat<eT>& x)
+  : n_rows(x.n_rows)
+  , n_cols(x.n_cols)
+  , kl    (x.kl    )
+  , ku    (x.ku    )
+  , AB    (x.AB    )
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+band_mat<eT>&
+band_mat<eT>::operator=(const band_mat<eT>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(this != &x)
+    {
+    access::rw(n_rows) = x.n_rows;
+    access::rw(n_cols) = x.n_cols;
+    access::rw(kl)     = x.kl;
+    access::rw(ku)     = x.ku;
+    
+    AB = x.AB;
+    }
+  
+  return *this;
+  }
+
+
+
+//! n x n band matrix with all elements in the band set to zero
+template<typename eT>
+inline
+band_mat<eT>::band_mat(const uword in_n, const uword in_kl, const uword in_ku)
+  : n_rows(in_n )
+  , n_cols(in_n )
+  , kl    (in_kl)
+  , ku    (in_ku)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_debug_check( ( (in_kl > 0) && (in_kl >= in_n) ) || ( (in_ku > 0) && (in_ku >= in_n) ), "band_mat(): number of subdiagonals and superdiagonals must be less than the matrix size" );
+  
+  AB.zeros(in_kl + in_ku + 1, in_n);
+  }
+
+
+
+//! copy of a square dense matrix; the number of subdiagonals and superdiagonals is the smallest that holds all non-zero elements
+template<typename eT>
+template<typename T1>
+inline
+band_mat<eT>::band_mat(const Base<eT,T1>& expr)
+  : n_rows(0)
+  , n_cols(0)
+  , kl    (0)
+  , ku    (0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const quasi_unwrap<T1> U(expr.get_ref());
+  
+  const Mat<eT>& A = U.M;
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "band_mat(): given matrix must be square sized" );
+  
+  const uword N = A.n_rows;
+  
+  uword A_kl = 0;
+  uword A_ku = 0;
+  
+  for(uword col=0; col < N; ++col)
+    {
+    const eT* A_colptr = A.colptr(col);
+    
+    for(uword row=0; row < col; ++row)
+      {
+      if(A_colptr[row] != eT(0))  { A_ku = (std::max)(A_ku, col - row); break; }
+      }
+    
+    for(uword row=(N-1); row > col; --row)
+      {
+      if(A_colptr[row] != eT(0))  { A_kl = (std::max)(A_kl, row - col); break; }
+      }
+    }
+  
+  (*this).init(A, A_kl, A_ku);
+  }
+
+
+
+//! copy of the band of a square dense matrix; elements outside of the band are ignored
+template<typename eT>
+template<typename T1>
+inline
+band_mat<eT>::band_mat(const Base<eT,T1>& expr, const uword in_kl, const uword in_ku)
+  : n_rows(0)
+  , n_cols(0)
+  , kl    (0)
+  , ku    (0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const quasi_unwrap<T1> U(expr.get_ref());
+  
+  (*this).init(U.M, in_kl, in_ku);
+  }
+
+
+
+template<typename eT>
+inline
+void
+band_mat<eT>::init(const Mat<eT>& A, const uword in_kl, const uword in_ku)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "band_mat(): given matrix must be square sized" );
+  
+  const uword N = A.n_rows;
+  
+  arma_debug_check( ( (in_kl > 0) && (in_kl >= N) ) || ( (in_ku > 0) && (in_ku >= N) ), "band_mat(): number of subdiagonals and superdiagonals must be less than the matrix size" );
+  
+  band_helper::compress(AB, A, in_kl, in_ku, false);
+  
+  access::rw(n_rows) = N;
+  access::rw(n_cols) = N;
+  access::rw(kl)     = in_kl;
+  access::rw(ku)     = in_ku;
+  }
+
+
+
+//! element A(in_row,in_col), without bounds checks; the element must be within the band
+template<typename eT>
+arma_inline
+eT&
+band_mat<eT>::at(const uword in_row, const uword in_col)
+  {
+  return AB.at((ku + in_row) - in_col, in_col);
+  }
+
+
+
+template<typename eT>
+arma_inline
+const eT&
+band_mat<eT>::at(const uword in_row, const uword in_col) const
+  {
+  return AB.at((ku + in_row) - in_col, in_col);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+band_mat<eT>::in_band(const uword in_row, const uword in_col) const
+  {
+  return (in_row < n_rows) && (in_col < n_cols) && (in_row <= (in_col + kl)) && (in_col <= (in_row + ku));
+  }
+
+
+
+template<typename eT>
+inline
+StructValProxy< band_mat<eT> >
+band_mat<eT>::operator()(const uword in_row, const uword in_col)
+  {
+  arma_debug_check_bounds( ((in_row >= n_rows) || (in_col >= n_cols)), "band_mat::operator(): index out of bounds" );
+  
+  return StructValProxy< band_mat<eT> >(in_row, in_col, *this);
+  }
+
+
+
+template<typename eT>
+inline
+eT
+band_mat<eT>::operator()(const uword in_row, const uword in_col) const
+  {
+  arma_debug_check_bounds( ((in_row >= n_rows) || (in_col >= n_cols)), "band_mat::operator(): index out of bounds" );
+  
+  return (*this).get_elem(in_row, in_col);
+  }
+
+
+
+//! element A(in_row,in_col); elements outside of the band are zero
+template<typename eT>
+inline
+eT
+band_mat<eT>::get_elem(const uword in_row, const uword in_col) const
+  {
+  return ((*this).in_band(in_row, in_col)) ? (*this).at(in_row, in_col) : eT(0);
+  }
+
+
+
+//! set element A(in_row,in_col); only zero can be written to elements outside of the band
+template<typename eT>
+inline
+void
+band_mat<eT>::set_elem(const uword in_row, const uword in_col, const eT val)
+  {
+  if((*this).in_band(in_row, in_col))
+    {
+    (*this).at(in_row, in_col) = val;
+    }
+  else
+    {
+    arma_debug_check( (val != eT(0)), "band_mat::operator(): element is outside of the band" );
+    }
+  }
+
+
+
+//! diagonal in_id, where 0 is the main diagonal, positive values are superdiagonals and negative values are subdiagonals;
+//! each diagonal is a contiguous part of one row of the band storage
+template<typename eT>
+inline
+subview_row<eT>
+band_mat<eT>::diag(const sword in_id)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword id = (in_id < 0) ? uword(-in_id) : uword(in_id);
+  
+  arma_debug_check_bounds( ((in_id < 0) && (id > kl)) || ((in_id > 0) && (id > ku)), "band_mat::diag(): requested diagonal is outside of the band" );
+  
+  const uword row = (in_id < 0) ? (ku + id) : (ku - id);
+  
+  return (in_id < 0) ? AB.row(row).head(n_cols - id) : AB.row(row).tail(n_cols - id);
+  }
+
+
+
+template<typename eT>
+inline
+const subview_row<eT>
+band_mat<eT>::diag(const sword in_id) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword id = (in_id < 0) ? uword(-in_id) : uword(in_id);
+  
+  arma_debug_check_bounds( ((in_id < 0) && (id > kl)) || ((in_id > 0) && (id > ku)), "band_mat::diag(): requested diagonal is outside of the band" );
+  
+  const uword row = (in_id < 0) ? (ku + id) : (ku - id);
+  
+  return (in_id < 0) ? AB.row(row).head(n_cols - id) : AB.row(row).tail(n_cols - id);
+  }
+
+
+
+//! band storage, as used by LAPACK; kl+ku+1 rows and n_cols columns
+template<typename eT>
+inline
+eT*
+band_mat<eT>::memptr()
+  {
+  return AB.memptr();
+  }
+
+
+
+template<typename eT>
+inline
+const eT*
+band_mat<eT>::memptr() const
+  {
+  return AB.memptr();
+  }
+
+
+
+template<typename eT>
+inline
+Mat<eT>
+band_mat<eT>::as_dense() const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  band_helper::uncompress(out, AB, kl, ku, false);
+  
+  return out;
+  }
+
+
+
+//! out = A * X; each row of the result only uses the kl+ku+1 elements of X within the band
+template<typename eT>
+template<typename T1>
+inline
+void
+band_mat<eT>::mul(Mat<eT>& out, const Base<eT,T1>& X_expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X_expr.get_ref());
+  
+  const Mat<eT>& X = U.M;
+  
+  arma_debug_assert_mul_size(n_rows, n_cols, X.n_rows, X.n_cols, "matrix multiplication");
+  
+  if(U.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    (*this).mul(tmp, X);
+    
+    out.steal_mem(tmp);
+    
+    return;
+    }
+  
+  out.set_size(n_rows, X.n_cols);
+  
+  const uword N      = n_rows;
+  const uword X_cols = X.n_cols;
+  const uword stride = AB.n_rows - 1;  // distance between A(i,j) and A(i,j+1) in the band storage
+  
+  const eT* AB_mem = AB.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<eT>::eval(AB.n_elem * X_cols);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword row=0; row < N; ++row)
+    {
+    const uword col_start = (row > kl) ? (row - kl) : uword(0);
+    const uword col_endp1 = (std::min)(N, row + ku + 1);
+    
+    const eT* AB_row = &(AB_mem[ (ku + row) - col_start + col_start*AB.n_rows ]);
+    
+    for(uword c=0; c < X_cols; ++c)
+      {
+      const eT* X_col = X.colptr(c);
+      
+      eT acc = eT(0);
+      
+      for(uword col=col_start, k=0; col < col_endp1; ++col, k += stride)
+        {
+        acc += AB_row[k] * X_col[col];
+        }
+      
+      out.at(row, c) = acc;
+      }
+    }
+  }
+
+
+
+//! solve A*X = B via LU decomposition with partial pivoting (gbtrf and gbtrs);
+//! with solve_opts::flag_likely_sympd and kl == ku, the Cholesky decomposition is tried first (pbtrf and pbtrs),
+//! using the subdiagonals only.
+//! unless solve_opts::flag_fast is given, the reciprocal condition number is estimated (gbcon or pbcon);
+//! systems with rcond below machine epsilon are rejected, unless solve_opts::flag_allow_ugly is given.
+//! no approximate solution is attempted for rejected systems.
+template<typename eT>
+template<typename T1>
+inline
+bool
+band_mat<eT>::solve(Mat<eT>& X, const Base<eT,T1>& B_expr, const uword flags) const
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename get_pod_type<eT>::result T;
+    
+    const bool fast         = bool(flags & solve_opts::flag_fast        );
+    const bool allow_ugly   = bool(flags & solve_opts::flag_allow_ugly  );
+    const bool likely_sympd = bool(flags & solve_opts::flag_likely_sympd);
+    const bool no_sympd     = bool(flags & solve_opts::flag_no_sympd    );
+    
+    if(flags & solve_opts::flag_equilibrate )  { arma_debug_warn_level(2, "solve(): option 'equilibrate' ignored for band matrix" ); }
+    if(flags & solve_opts::flag_refine      )  { arma_debug_warn_level(2, "solve(): option 'refine' ignored for band matrix"      ); }
+    if(flags & solve_opts::flag_force_approx)  { arma_debug_warn_level(2, "solve(): option 'force_approx' ignored for band matrix"); }
+    if(flags & solve_opts::flag_mixed       )  { arma_debug_warn_level(2, "solve(): option 'mixed' ignored for band matrix"       ); }
+    if(flags & solve_opts::flag_no_band     )  { arma_debug_warn_level(2, "solve(): option 'no_band' ignored for band matrix"     ); }
+    
+    X = B_expr.get_ref();
+    
+    arma_debug_check( (X.n_rows != n_rows), "solve(): number of rows in given matrices must be the same", [&](){ X.soft_reset(); } );
+    
+    if( (n_rows == 0) || X.is_empty() )  { X.zeros(n_rows, X.n_cols); return true; }
+    
+    arma_debug_assert_blas_size(AB, X);
+    
+    blas_int n    = blas_int(n_rows);
+    blas_int nrhs = blas_int(X.n_cols);
+    blas_int ldb  = blas_int(X.n_rows);
+    blas_int info = blas_int(0);
+    
+    // the band storage holds zeros outside of the matrix, so its 1-norm is the 1-norm of A
+    const T norm_val = (fast) ? T(0) : op_norm::mat_norm_1(AB);
+    
+    T    rcond     = T(0);
+    bool have_soln = false;
+    
+    if( likely_sympd && (no_sympd == false) && (kl == ku) )
+      {
+      Mat<eT> ABL = AB.rows(ku, ku + kl);  // lower band storage: A(i,j) at row (i-j) and column j
+      
+      char     uplo = 'L';
+      blas_int kd   = blas_int(kl);
+      blas_int ldab = blas_int(ABL.n_rows);
+      
+      arma_extra_debug_print("lapack::pbtrf()");
+      lapack::pbtrf(&uplo, &n, &kd, ABL.memptr(), &ldab, &info);
+      
+      if(info == 0)
+        {
+        if(fast == false)  { rcond = auxlib::lu_rcond_sympd_band<T>(ABL, kl, norm_val); }
+        
+        arma_extra_debug_print("lapack::pbtrs()");
+        lapack::pbtrs(&uplo, &n, &kd, &nrhs, ABL.memptr(), &ldab, X.memptr(), &ldb, &info);
+        
+        if(info != 0)  { return false; }
+        
+        have_soln = true;
+        }
+      else
+        {
+        arma_extra_debug_print("band_mat::solve(): matrix is not positive definite; using LU decomposition");
+        }
+      }
+    
+    if(have_soln == false)
+      {
+      // for gbtrf, the band is stored in rows kl to 2*kl+ku, with the first kl rows used as workspace
+      
+      Mat<eT> ABG(2*kl + ku + 1, n_rows);
+      
+      if(kl > 0)  { ABG.rows(0, kl-1).zeros(); }
+      
+      ABG.rows(kl, 2*kl + ku) = AB;
+      
+      blas_int kl_b = blas_int(kl);
+      blas_int ku_b = blas_int(ku);
+      blas_int ldab = blas_int(ABG.n_rows);
+      char     trans = 'N';
+      
+      podarray<blas_int> ipiv(n_rows + 2);  // +2 for paranoia
+      
+      arma_extra_debug_print("lapack::gbtrf()");
+      lapack::gbtrf(&n, &n, &kl_b, &ku_b, ABG.memptr(), &ldab, ipiv.memptr(), &info);
+      
+      if(info != 0)
+        {
+        arma_debug_warn_level(2, "solve(): system is singular");
+        return false;
+        }
+      
+      if(fast == false)  { rcond = auxlib::lu_rcond_band<T>(ABG, kl, ku, ipiv, norm_val); }
+      
+      arma_extra_debug_print("lapack::gbtrs()");
+      lapack::gbtrs(&trans, &n, &kl_b, &ku_b, &nrhs, ABG.memptr(), &ldab, ipiv.memptr(), X.memptr(), &ldb, &info);
+      
+      if(info != 0)  { return false; }
+      }
+    
+    if( (fast == false) && (allow_ugly == false) && ((rcond < std::numeric_limits<T>::epsilon()) || arma_isnan(rcond)) )
+      {
+      if(rcond == T(0))
+        {
+        arma_debug_warn_level(2, "solve(): system is singular");
+        }
+      else
+        {
+        arma_debug_warn_level(2, "solve(): system is singular (rcond: ", rcond, ")");
+        }
+      
+      return false;
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(B_expr);
+    arma_ignore(flags);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! @}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup batch_linalg
+//! @{
+
+
+//! slice-wise decompositions and solvers for cubes holding many small matrices;
+//! the slices are processed in parallel, with workspace allocated once per thread;
+//! small matrices are handled by unblocked kernels which avoid the call overhead of LAPACK;
+//! failed slices are filled with NaN, while the other slices still hold valid results
+class batch_linalg
+  {
+  public:
+  
+  // largest sizes handled by the unblocked kernels; beyond these, LAPACK is faster despite its call overhead
+  static constexpr uword chol_size      = 10;
+  static constexpr uword inv_sympd_size = 12;
+  static constexpr uword solve_size     = 10;
+  static constexpr uword jacobi_size    =  6;  //!< Jacobi eigen-solver, real matrices only
+  
+  template<typename eT> inline static bool chol(Cube<eT>& A, const uword layout);
+  template<typename eT> inline static bool inv_sympd(Cube<eT>& A);
+  template<typename eT> inline static bool solve(Cube<eT>& B, const Cube<eT>& A);
+  
+  template<typename eT> inline static bool eig_sym(Mat<typename get_pod_type<eT>::result>& eigval, Cube<eT>& eigvec, const Cube<eT>& X, const bool calc_vec);
+  
+  
+  private:
+  
+  template<typename eT>
+  struct workspace
+    {
+    podarray<eT>                                  work;
+    podarray<typename get_pod_type<eT>::result>  rwork;
+    podarray<blas_int>                           iwork;
+    };
+  
+  template<typename eT, typename functor>
+  inline static bool for_each_slice(const uword n_slices, const uword N, const uword n_work, const uword n_rwork, const uword n_iwork, const functor& F);
+  
+  template<typename eT> arma_inline static typename get_pod_type<eT>::result abs1(const eT& x);
+  
+  template<typename eT> inline static bool chol_upper_small(eT* A, const uword N);
+  template<typename eT> inline static bool chol_lower_small(eT* A, const uword N);
+  template<typename eT> inline static bool chol_lapack(eT* A, const uword N, const uword layout);
+  
+  template<typename eT> inline static bool inv_sympd_small(eT* A, eT* W, const uword N);
+  template<typename eT> inline static bool inv_sympd_lapack(eT* A, const uword N);
+  
+  template<typename eT> inline static bool solve_small(eT* B, eT* LU, const uword N, const uword n_rhs);
+  template<typename eT> inline static bool solve_lapack(eT* B, eT* LU, const uword N, const uword n_rhs, workspace<eT>& ws);
+  
+  template<typename eT> inline static void gecon(char* norm_id, blas_int* n, const eT* LU, const eT* norm_val, eT* rcond, workspace<eT>& ws, blas_int* info);
+  template<typename  T> inline static void gecon(char* norm_id, blas_int* n, const std::complex<T>* LU, const T* norm_val, T* rcond, workspace< std::complex<T> >& ws, blas_int* info);
+  
+  template<typename eT> inline static bool eig_sym_jacobi(eT* eigval, eT* A, eT* V, const uword N, const bool calc_vec);
+  
+  template<typename eT> inline static bool eig_sym_slice(eT* eigval, eT* A, eT* V, const uword N, const bool calc_vec, workspace<eT>& ws);
+  template<typename  T> inline static bool eig_sym_slice(T* eigval, std::complex<T>* A, std::complex<T>* V, const uword N, const bool calc_vec, workspace< std::complex<T> >& ws);
+  
+  template<typename eT> inline static void fill_upper(eT* A, const uword N);
+  template<typename eT> inline static void fill_lower(eT* A, const uword N);
+  };
+
+
+
+//! @}
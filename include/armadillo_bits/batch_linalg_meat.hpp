@@ -0,0 +1,965 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup batch_linalg
+//! @{
+
+
+
+//! Cholesky decomposition of each slice, in place;
+//! layout = 0: upper triangle is used and R'*R = X;  layout = 1: lower triangle is used and L*L' = X
+template<typename eT>
+inline
+bool
+batch_linalg::chol(Cube<eT>& A, const uword layout)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "chol(): given slices must be square sized" );
+  
+  if(A.is_empty())  { return true; }
+  
+  const uword N = A.n_rows;
+  
+  if(N > chol_size)
+    {
+    #if !defined(ARMA_USE_LAPACK)
+      arma_stop_logic_error("chol(): use of LAPACK must be enabled");
+      return false;
+    #endif
+  
+    arma_debug_assert_blas_size(A);
+    }
+  
+  return batch_linalg::for_each_slice<eT>(A.n_slices, N, 0, 0, 0, [&](const uword slice_id, workspace<eT>&)
+    {
+    eT* mem = A.slice_memptr(slice_id);
+  
+    bool status = false;
+  
+    if(N <= chol_size)
+      {
+      status = (layout == 0) ? batch_linalg::chol_upper_small(mem, N) : batch_linalg::chol_lower_small(mem, N);
+      }
+    else
+      {
+      status = batch_linalg::chol_lapack(mem, N, layout);
+      }
+  
+    if(status == false)  { arrayops::inplace_set(mem, Datum<eT>::nan, N*N); }
+  
+    return status;
+    });
+  }
+
+
+
+//! inverse of each symmetric/hermitian positive definite slice, in place; only the lower triangle of each slice is used
+template<typename eT>
+inline
+bool
+batch_linalg::inv_sympd(Cube<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "inv_sympd(): given slices must be square sized" );
+  
+  if(A.is_empty())  { return true; }
+  
+  const uword N = A.n_rows;
+  
+  if(N > inv_sympd_size)
+    {
+    #if !defined(ARMA_USE_LAPACK)
+      arma_stop_logic_error("inv_sympd(): use of LAPACK must be enabled");
+      return false;
+    #endif
+  
+    arma_debug_assert_blas_size(A);
+    }
+  
+  const uword n_work = (N <= inv_sympd_size) ? (N*N) : uword(0);
+  
+  return batch_linalg::for_each_slice<eT>(A.n_slices, N, n_work, 0, 0, [&](const uword slice_id, workspace<eT>& ws)
+    {
+    eT* mem = A.slice_memptr(slice_id);
+  
+    const bool status = (N <= inv_sympd_size) ? batch_linalg::inv_sympd_small(mem, ws.work.memptr(), N) : batch_linalg::inv_sympd_lapack(mem, N);
+  
+    if(status == false)  { arrayops::inplace_set(mem, Datum<eT>::nan, N*N); }
+  
+    return status;
+    });
+  }
+
+
+
+//! solve A.slice(i) * X.slice(i) = B.slice(i) for each slice;
+//! B is overwritten with the solutions;
+//! slices with a reciprocal condition number below machine epsilon are treated as failed
+template<typename eT>
+inline
+bool
+batch_linalg::solve(Cube<eT>& B, const Cube<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols),     "solve(): given slices of A must be square sized"          );
+  arma_debug_check( (A.n_rows != B.n_rows),     "solve(): number of rows in given objects must be the same" );
+  arma_debug_check( (A.n_slices != B.n_slices), "solve(): number of slices in given objects must be the same" );
+  
+  if(B.is_empty())  { return true; }
+  
+  const uword N     = A.n_rows;
+  const uword n_rhs = B.n_cols;
+  
+  if(N > solve_size)
+    {
+    #if !defined(ARMA_USE_LAPACK)
+      arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+      return false;
+    #endif
+  
+    arma_debug_assert_blas_size(A,B);
+    }
+  
+  // the LAPACK path keeps the workspace for gecon after the N*N elements holding the LU factors,
+  // and the workspace for gecon after the N pivot indices
+  const bool  use_small = (N <= solve_size);
+  const uword n_work    = (use_small) ? (N*N) : (N*N + 4*N);
+  const uword n_rwork   = ( (use_small == false) && is_cx<eT>::yes ) ? (2*N) : uword(0);
+  const uword n_iwork   = (use_small) ? uword(0) : (2*N);
+  
+  return batch_linalg::for_each_slice<eT>(A.n_slices, N, n_work, n_rwork, n_iwork, [&](const uword slice_id, workspace<eT>& ws)
+    {
+    eT* B_mem  = B.slice_memptr(slice_id);
+    eT* LU_mem = ws.work.memptr();
+  
+    arrayops::copy(LU_mem, A.slice_memptr(slice_id), N*N);
+  
+    bool status = false;
+  
+    if(use_small)
+      {
+      status = batch_linalg::solve_small(B_mem, LU_mem, N, n_rhs);
+      }
+    else
+      {
+      status = batch_linalg::solve_lapack(B_mem, LU_mem, N, n_rhs, ws);
+      }
+  
+    status = status && arrayops::is_finite(B_mem, N*n_rhs);
+  
+    if(status == false)  { arrayops::inplace_set(B_mem, Datum<eT>::nan, N*n_rhs); }
+  
+    return status;
+    });
+  }
+
+
+
+//! eigen decomposition of each symmetric/hermitian slice; only the upper triangle of each slice is used;
+//! eigenvalues of slice i are stored in ascending order in column i of eigval
+template<typename eT>
+inline
+bool
+batch_linalg::eig_sym(Mat<typename get_pod_type<eT>::result>& eigval, Cube<eT>& eigvec, const Cube<eT>& X, const bool calc_vec)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  arma_debug_check( (X.n_rows != X.n_cols), "eig_sym(): given slices must be square sized" );
+  
+  const uword N = X.n_rows;
+  
+  eigval.set_size(N, X.n_slices);
+  
+  if(calc_vec)  { eigvec.set_size(N, N, X.n_slices); }
+  
+  if(X.is_empty())  { return true; }
+  
+  const bool use_jacobi = (is_cx<eT>::no) && (N <= jacobi_size);
+  
+  if(use_jacobi == false)
+    {
+    #if !defined(ARMA_USE_LAPACK)
+      arma_stop_logic_error("eig_sym(): use of LAPACK must be enabled");
+      return false;
+    #endif
+  
+    arma_debug_assert_blas_size(X);
+    }
+  
+  // the LAPACK routines get their workspace after the N*N elements holding the copy of the slice
+  const uword n_work  = (use_jacobi) ? (N*N) : (N*N + (64+2)*N);
+  const uword n_rwork = (is_cx<eT>::yes) ? (std::max)(uword(1), 3*N) : uword(0);
+  
+  T* eigval_mem = eigval.memptr();
+  
+  return batch_linalg::for_each_slice<eT>(X.n_slices, N, n_work, n_rwork, 0, [&](const uword slice_id, workspace<eT>& ws)
+    {
+    eT* A_mem = ws.work.memptr();
+    eT* V_mem = (calc_vec) ? eigvec.slice_memptr(slice_id) : nullptr;
+    T*  e_mem = &(eigval_mem[slice_id * N]);
+  
+    const eT* X_mem = X.slice_memptr(slice_id);
+  
+    // a non-finite element may cause some LAPACK implementations to hang
+    bool status = true;
+  
+    for(uword j=0; (j < N) && status; ++j)  { status = arrayops::is_finite(&(X_mem[j*N]), j+1); }
+  
+    if(status)
+      {
+      arrayops::copy(A_mem, X_mem, N*N);
+  
+      status = batch_linalg::eig_sym_slice(e_mem, A_mem, V_mem, N, calc_vec, ws);
+      }
+  
+    if(status == false)
+      {
+      arrayops::inplace_set(e_mem, Datum<T>::nan, N);
+  
+      if(calc_vec)  { arrayops::inplace_set(V_mem, Datum<eT>::nan, N*N); }
+      }
+  
+    return status;
+    });
+  }
+
+
+
+//! F(slice_id, ws) processes one slice and returns false on failure; F must not throw;
+//! each thread gets its own workspace, so the workspace is allocated once per thread rather than once per slice.
+//! the workspaces are allocated before the parallel region, as an exception can't propagate out of it
+template<typename eT, typename functor>
+inline
+bool
+batch_linalg::for_each_slice(const uword n_slices, const uword N, const uword n_work, const uword n_rwork, const uword n_iwork, const functor& F)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword n_failed = 0;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (n_slices > 1) && mp_gate<eT>::eval(n_slices * N * N) )
+      {
+      const uword n_threads = uword( (std::min)( mp_thread_limit::get(), int(n_slices) ) );
+  
+      std::vector< workspace<eT> > ws_all(n_threads);
+  
+      for(uword t=0; t < n_threads; ++t)
+        {
+        ws_all[t].work.set_size(n_work);
+        ws_all[t].rwork.set_size(n_rwork);
+        ws_all[t].iwork.set_size(n_iwork);
+        }
+  
+      // each thread processes a contiguous chunk of slices with its own workspace
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads)) reduction(+:n_failed)
+      for(uword t=0; t < n_threads; ++t)
+        {
+        workspace<eT>& ws = ws_all[t];
+  
+        const uword slice_start = (n_slices *  t     ) / n_threads;
+        const uword slice_endp1 = (n_slices * (t + 1)) / n_threads;
+  
+        for(uword slice_id=slice_start; slice_id < slice_endp1; ++slice_id)
+          {
+          if(F(slice_id, ws) == false)  { ++n_failed; }
+          }
+        }
+  
+      return (n_failed == 0);
+      }
+    }
+  #endif
+  
+  workspace<eT> ws;
+  
+  ws.work.set_size(n_work);
+  ws.rwork.set_size(n_rwork);
+  ws.iwork.set_size(n_iwork);
+  
+  for(uword slice_id=0; slice_id < n_slices; ++slice_id)
+    {
+    if(F(slice_id, ws) == false)  { ++n_failed; }
+    }
+  
+  return (n_failed == 0);
+  }
+
+
+
+//! |real(x)| + |imag(x)|, as used by LAPACK for pivot selection; avoids the square root of std::abs() for complex numbers
+template<typename eT>
+arma_inline
+typename get_pod_type<eT>::result
+batch_linalg::abs1(const eT& x)
+  {
+  return std::abs(std::real(x)) + std::abs(std::imag(x));
+  }
+
+
+
+//! Cholesky decomposition using the upper triangle, done as L*L' = X on the mirrored matrix followed by R = L';
+//! the right-looking lower kernel has contiguous inner loops, while a direct upper kernel is made of dot products which don't vectorise
+template<typename eT>
+inline
+bool
+batch_linalg::chol_upper_small(eT* A, const uword N)
+  {
+  batch_linalg::fill_lower(A, N);
+  
+  if(batch_linalg::chol_lower_small(A, N) == false)  { return false; }
+  
+  batch_linalg::fill_upper(A, N);
+  
+  for(uword j=0; j < N; ++j)  { arrayops::fill_zeros(&(A[j*N + j+1]), N-j-1); }
+  
+  return true;
+  }
+
+
+
+//! unblocked right-looking Cholesky decomposition using the lower triangle
+template<typename eT>
+inline
+bool
+batch_linalg::chol_lower_small(eT* A, const uword N)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  for(uword j=0; j < N; ++j)
+    {
+    eT* colj = &(A[j*N]);
+  
+    const T d = std::real(colj[j]);
+  
+    if( (d > T(0)) == false )  { return false; }  // also catches NaN
+  
+    const T L_jj = std::sqrt(d);
+    const T scale = T(1) / L_jj;
+  
+    colj[j] = eT(L_jj);
+  
+    for(uword i=j+1; i < N; ++i)  { colj[i] *= scale; }
+  
+    for(uword k=j+1; k < N; ++k)
+      {
+      eT* colk = &(A[k*N]);
+  
+      const eT val = access::alt_conj(colj[k]);
+  
+      for(uword i=k; i < N; ++i)  { colk[i] -= colj[i] * val; }
+      }
+  
+    for(uword i=0; i < j; ++i)  { colj[i] = eT(0); }
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::chol_lapack(eT* A, const uword N, const uword layout)
+  {
+  #if defined(ARMA_USE_LAPACK)
+    {
+    char      uplo = (layout == 0) ? 'U' : 'L';
+    blas_int  n    = blas_int(N);
+    blas_int  info = 0;
+  
+    arma_extra_debug_print("lapack::potrf()");
+    lapack::potrf(&uplo, &n, A, &n, &info);
+  
+    if(info != 0)  { return false; }
+  
+    if(layout == 0)
+      {
+      for(uword j=0; j < N; ++j)  { arrayops::fill_zeros(&(A[j*N + j+1]), N-j-1); }
+      }
+    else
+      {
+      for(uword j=0; j < N; ++j)  { arrayops::fill_zeros(&(A[j*N]), j); }
+      }
+  
+    return true;
+    }
+  #else
+    {
+    arma_ignore(A);
+    arma_ignore(N);
+    arma_ignore(layout);
+  
+    return false;  // use of LAPACK is checked before the slices are processed
+    }
+  #endif
+  }
+
+
+
+//! inverse via X = L*L', M = inv(L) and inv(X) = M'*M; W is N*N workspace
+template<typename eT>
+inline
+bool
+batch_linalg::inv_sympd_small(eT* A, eT* W, const uword N)
+  {
+  if(batch_linalg::chol_lower_small(A, N) == false)  { return false; }
+  
+  // in-place inverse of L, last column first (as in LAPACK's trti2),
+  // so that the trailing part of M needed by column j is already computed
+  
+  for(uword j=N; j-- > 0;)
+    {
+    eT* colj = &(A[j*N]);
+  
+    colj[j] = eT(1) / colj[j];
+  
+    const eT neg_M_jj = -colj[j];
+  
+    // colj(j+1:N-1) = M(j+1:N-1, j+1:N-1) * colj(j+1:N-1), with columns of M taken from the last one,
+    // so that each element of colj is used before it's overwritten
+  
+    for(uword k=N; k-- > (j+1);)
+      {
+      const eT* colk = &(A[k*N]);
+  
+      const eT val = colj[k];
+  
+      colj[k] = colk[k] * val;
+  
+      for(uword i=k+1; i < N; ++i)  { colj[i] += colk[i] * val; }
+      }
+  
+    for(uword i=j+1; i < N; ++i)  { colj[i] *= neg_M_jj; }
+    }
+  
+  // W = M', so that the columns of the upper triangle of M'*M are sums of contiguous columns of W
+  
+  for(uword k=0; k < N; ++k)
+  for(uword i=0; i <= k; ++i)
+    {
+    W[k*N + i] = access::alt_conj(A[i*N + k]);
+    }
+  
+  for(uword j=0; j < N; ++j)
+    {
+    eT* colj = &(A[j*N]);
+  
+    arrayops::fill_zeros(colj, j+1);
+  
+    for(uword k=j; k < N; ++k)
+      {
+      const eT* W_colk = &(W[k*N]);
+  
+      const eT val = access::alt_conj(W_colk[j]);
+  
+      for(uword i=0; i <= j; ++i)  { colj[i] += W_colk[i] * val; }
+      }
+  
+    colj[j] = eT( std::real(colj[j]) );
+    }
+  
+  batch_linalg::fill_lower(A, N);
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::inv_sympd_lapack(eT* A, const uword N)
+  {
+  #if defined(ARMA_USE_LAPACK)
+    {
+    char     uplo = 'L';
+    blas_int n    = blas_int(N);
+    blas_int info = 0;
+  
+    arma_extra_debug_print("lapack::potrf()");
+    lapack::potrf(&uplo, &n, A, &n, &info);
+  
+    if(info != 0)  { return false; }
+  
+    arma_extra_debug_print("lapack::potri()");
+    lapack::potri(&uplo, &n, A, &n, &info);
+  
+    if(info != 0)  { return false; }
+  
+    batch_linalg::fill_upper(A, N);
+  
+    return true;
+    }
+  #else
+    {
+    arma_ignore(A);
+    arma_ignore(N);
+  
+    return false;  // use of LAPACK is checked before the slices are processed
+    }
+  #endif
+  }
+
+
+
+//! LU decomposition with partial pivoting, followed by forward and back substitution;
+//! row interchanges are applied to B as soon as they're found, so no pivot vector is needed;
+//! the system is rejected if min|U(k,k)| / max|U(k,k)| is below machine epsilon,
+//! a cheap lower bound on the condition number which catches the singular cases that pivoting leaves with a tiny non-zero pivot
+template<typename eT>
+inline
+bool
+batch_linalg::solve_small(eT* B, eT* LU, const uword N, const uword n_rhs)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  for(uword k=0; k < N; ++k)
+    {
+    eT* colk = &(LU[k*N]);
+  
+    uword p     = k;
+    T     p_val = batch_linalg::abs1(colk[k]);
+  
+    for(uword i=k+1; i < N; ++i)
+      {
+      const T val = batch_linalg::abs1(colk[i]);
+  
+      if(val > p_val)  { p = i; p_val = val; }
+      }
+  
+    if( (p_val > T(0)) == false )  { return false; }
+  
+    if(p != k)
+      {
+      for(uword c=0; c < N;     ++c)  { std::swap(LU[c*N + k], LU[c*N + p]); }
+      for(uword c=0; c < n_rhs; ++c)  { std::swap( B[c*N + k],  B[c*N + p]); }
+      }
+  
+    const eT scale = eT(1) / colk[k];
+  
+    for(uword i=k+1; i < N; ++i)  { colk[i] *= scale; }
+  
+    for(uword c=k+1; c < N; ++c)
+      {
+      eT* colc = &(LU[c*N]);
+  
+      const eT val = colc[k];
+  
+      for(uword i=k+1; i < N; ++i)  { colc[i] -= colk[i] * val; }
+      }
+    }
+  
+  T U_min = std::abs(LU[0]);
+  T U_max = U_min;
+  
+  for(uword k=1; k < N; ++k)
+    {
+    const T val = std::abs(LU[k*N + k]);
+  
+    U_min = (std::min)(U_min, val);
+    U_max = (std::max)(U_max, val);
+    }
+  
+  if( (U_min >= (std::numeric_limits<T>::epsilon() * U_max)) == false )  { return false; }  // also catches NaN
+  
+  for(uword c=0; c < n_rhs; ++c)
+    {
+    eT* b = &(B[c*N]);
+  
+    for(uword k=0; k < N; ++k)
+      {
+      const eT* colk = &(LU[k*N]);
+  
+      const eT val = b[k];
+  
+      for(uword i=k+1; i < N; ++i)  { b[i] -= colk[i] * val; }
+      }
+  
+    for(uword k=N; k-- > 0;)
+      {
+      const eT* colk = &(LU[k*N]);
+  
+      b[k] /= colk[k];
+  
+      const eT val = b[k];
+  
+      for(uword i=0; i < k; ++i)  { b[i] -= colk[i] * val; }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+//! LU decomposition via getrf, rejected if the rcond estimate from gecon is below machine epsilon, followed by getrs;
+//! LU holds a copy of the slice, followed by workspace for gecon
+template<typename eT>
+inline
+bool
+batch_linalg::solve_lapack(eT* B, eT* LU, const uword N, const uword n_rhs, workspace<eT>& ws)
+  {
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename get_pod_type<eT>::result T;
+  
+    // 1-norm of the slice, taken before it's overwritten by the LU factors
+    T norm_val = T(0);
+  
+    for(uword j=0; j < N; ++j)
+      {
+      const eT* colj = &(LU[j*N]);
+  
+      T acc = T(0);
+  
+      for(uword i=0; i < N; ++i)  { acc += std::abs(colj[i]); }
+  
+      norm_val = (std::max)(norm_val, acc);
+      }
+  
+    char     norm_id = '1';
+    char     trans   = 'N';
+    blas_int n       = blas_int(N);
+    blas_int nrhs    = blas_int(n_rhs);
+    blas_int info    = 0;
+    T        rcond   = T(0);
+  
+    blas_int* ipiv = ws.iwork.memptr();
+  
+    arma_extra_debug_print("lapack::getrf()");
+    lapack::getrf(&n, &n, LU, &n, ipiv, &info);
+  
+    if(info != 0)  { return false; }
+  
+    batch_linalg::gecon(&norm_id, &n, LU, &norm_val, &rcond, ws, &info);
+  
+    if( (info != 0) || ((rcond >= std::numeric_limits<T>::epsilon()) == false) )  { return false; }  // also catches NaN
+  
+    arma_extra_debug_print("lapack::getrs()");
+    lapack::getrs(&trans, &n, &nrhs, LU, &n, ipiv, B, &n, &info);
+  
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(B);
+    arma_ignore(LU);
+    arma_ignore(N);
+    arma_ignore(n_rhs);
+    arma_ignore(ws);
+  
+    return false;  // use of LAPACK is checked before the slices are processed
+    }
+  #endif
+  }
+
+
+
+//! real slice; the workspace for gecon follows the N*N elements of the LU factors
+template<typename eT>
+inline
+void
+batch_linalg::gecon(char* norm_id, blas_int* n, const eT* LU, const eT* norm_val, eT* rcond, workspace<eT>& ws, blas_int* info)
+  {
+  #if defined(ARMA_USE_LAPACK)
+    {
+    const uword N = uword(*n);
+  
+    arma_extra_debug_print("lapack::gecon()");
+    lapack::gecon(norm_id, n, LU, n, norm_val, rcond, &(ws.work[N*N]), &(ws.iwork[N]), info);
+    }
+  #else
+    {
+    arma_ignore(norm_id);
+    arma_ignore(n);
+    arma_ignore(LU);
+    arma_ignore(norm_val);
+    arma_ignore(rcond);
+    arma_ignore(ws);
+    arma_ignore(info);
+    }
+  #endif
+  }
+
+
+
+//! complex slice; the workspace for gecon follows the N*N elements of the LU factors
+template<typename T>
+inline
+void
+batch_linalg::gecon(char* norm_id, blas_int* n, const std::complex<T>* LU, const T* norm_val, T* rcond, workspace< std::complex<T> >& ws, blas_int* info)
+  {
+  #if defined(ARMA_USE_LAPACK)
+    {
+    const uword N = uword(*n);
+  
+    arma_extra_debug_print("lapack::cx_gecon()");
+    lapack::cx_gecon(norm_id, n, LU, n, norm_val, rcond, &(ws.work[N*N]), ws.rwork.memptr(), info);
+    }
+  #else
+    {
+    arma_ignore(norm_id);
+    arma_ignore(n);
+    arma_ignore(LU);
+    arma_ignore(norm_val);
+    arma_ignore(rcond);
+    arma_ignore(ws);
+    arma_ignore(info);
+    }
+  #endif
+  }
+
+
+
+//! cyclic Jacobi method for a real symmetric matrix (the full matrix must be stored in A);
+//! converges quadratically, and for small matrices avoids the tridiagonal reduction done by LAPACK;
+//! eigenvalues are sorted in ascending order
+template<typename eT>
+inline
+bool
+batch_linalg::eig_sym_jacobi(eT* eigval, eT* A, eT* V, const uword N, const bool calc_vec)
+  {
+  const eT eps = std::numeric_limits<eT>::epsilon();
+  
+  // the Frobenius norm is preserved by the rotations;
+  // off-diagonal elements below norm_val * eps^2 are negligible
+  const eT tiny = eps * eps * std::sqrt( op_dot::direct_dot(N*N, A, A) );
+  
+  if(calc_vec)
+    {
+    arrayops::fill_zeros(V, N*N);
+  
+    for(uword i=0; i < N; ++i)  { V[i*N + i] = eT(1); }
+    }
+  
+  bool converged = false;
+  
+  for(uword sweep=0; sweep < 64; ++sweep)
+    {
+    uword n_rot = 0;
+  
+    for(uword q=1; q < N; ++q)
+    for(uword p=0; p < q; ++p)
+      {
+      const eT A_pq = A[q*N + p];
+      const eT A_pp = A[p*N + p];
+      const eT A_qq = A[q*N + q];
+  
+      const eT abs_A_pq = std::abs(A_pq);
+  
+      // relative threshold: an off-diagonal element is skipped once it's negligible compared to its two diagonal elements
+      if( (abs_A_pq <= tiny) || ((A_pq*A_pq) <= (eps*eps) * std::abs(A_pp * A_qq)) )  { continue; }
+  
+      ++n_rot;
+  
+      const eT theta     = (A_qq - A_pp) / (eT(2) * A_pq);
+      const eT abs_theta = std::abs(theta);
+  
+      // smaller root of t^2 + 2*theta*t - 1 = 0
+      eT t = (abs_theta > (eT(1) / eps)) ? (eT(0.5) / abs_theta) : (eT(1) / (abs_theta + std::sqrt(eT(1) + theta*theta)));
+  
+      if(theta < eT(0))  { t = -t; }
+  
+      const eT c = eT(1) / std::sqrt(eT(1) + t*t);
+      const eT s = t * c;
+  
+      eT* A_colp = &(A[p*N]);
+      eT* A_colq = &(A[q*N]);
+  
+      // rotate columns p and q, and mirror them into rows p and q;
+      // the elements at (p,p), (p,q), (q,p) and (q,q) end up wrong here and are set afterwards
+      for(uword k=0; k < N; ++k)
+        {
+        const eT A_kp = A_colp[k];
+        const eT A_kq = A_colq[k];
+  
+        A_colp[k] = c*A_kp - s*A_kq;
+        A_colq[k] = s*A_kp + c*A_kq;
+  
+        A[k*N + p] = A_colp[k];
+        A[k*N + q] = A_colq[k];
+        }
+  
+      A_colp[p] = A_pp - t*A_pq;
+      A_colq[q] = A_qq + t*A_pq;
+      A_colp[q] = eT(0);
+      A_colq[p] = eT(0);
+  
+      if(calc_vec)
+        {
+        eT* V_colp = &(V[p*N]);
+        eT* V_colq = &(V[q*N]);
+  
+        for(uword k=0; k < N; ++k)
+          {
+          const eT V_kp = V_colp[k];
+          const eT V_kq = V_colq[k];
+  
+          V_colp[k] = c*V_kp - s*V_kq;
+          V_colq[k] = s*V_kp + c*V_kq;
+          }
+        }
+      }
+  
+    if(n_rot == 0)  { converged = true; break; }
+    }
+  
+  if(converged == false)  { return false; }
+  
+  for(uword i=0; i < N; ++i)  { eigval[i] = A[i*N + i]; }
+  
+  // selection sort; at most N-1 swaps of eigenvector columns
+  for(uword i=0; i < N; ++i)
+    {
+    uword min_index = i;
+  
+    for(uword k=i+1; k < N; ++k)  { if(eigval[k] < eigval[min_index])  { min_index = k; } }
+  
+    if(min_index != i)
+      {
+      std::swap(eigval[i], eigval[min_index]);
+  
+      if(calc_vec)  { for(uword k=0; k < N; ++k)  { std::swap(V[i*N + k], V[min_index*N + k]); } }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+//! real symmetric slice; A holds a copy of the slice, followed by workspace for LAPACK
+template<typename eT>
+inline
+bool
+batch_linalg::eig_sym_slice(eT* eigval, eT* A, eT* V, const uword N, const bool calc_vec, workspace<eT>& ws)
+  {
+  if(N <= jacobi_size)
+    {
+    batch_linalg::fill_lower(A, N);
+  
+    return batch_linalg::eig_sym_jacobi(eigval, A, V, N, calc_vec);
+    }
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    if(calc_vec)  { arrayops::copy(V, A, N*N); }
+  
+    char jobz  = (calc_vec) ? 'V' : 'N';
+    char uplo  = 'U';
+  
+    blas_int n     = blas_int(N);
+    blas_int lwork = blas_int(ws.work.n_elem - N*N);
+    blas_int info  = 0;
+  
+    arma_extra_debug_print("lapack::syev()");
+    lapack::syev(&jobz, &uplo, &n, ((calc_vec) ? V : A), &n, eigval, &(A[N*N]), &lwork, &info);
+  
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(V);
+    arma_ignore(calc_vec);
+    arma_ignore(ws);
+  
+    return false;  // use of LAPACK is checked before the slices are processed
+    }
+  #endif
+  }
+
+
+
+//! hermitian slice; A holds a copy of the slice, followed by workspace for LAPACK
+template<typename T>
+inline
+bool
+batch_linalg::eig_sym_slice(T* eigval, std::complex<T>* A, std::complex<T>* V, const uword N, const bool calc_vec, workspace< std::complex<T> >& ws)
+  {
+  #if defined(ARMA_USE_LAPACK)
+    {
+    if(calc_vec)  { arrayops::copy(V, A, N*N); }
+  
+    char jobz  = (calc_vec) ? 'V' : 'N';
+    char uplo  = 'U';
+  
+    blas_int n     = blas_int(N);
+    blas_int lwork = blas_int(ws.work.n_elem - N*N);
+    blas_int info  = 0;
+  
+    arma_extra_debug_print("lapack::heev()");
+    lapack::heev(&jobz, &uplo, &n, ((calc_vec) ? V : A), &n, eigval, &(A[N*N]), &lwork, ws.rwork.memptr(), &info);
+  
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(A);
+    arma_ignore(V);
+    arma_ignore(N);
+    arma_ignore(calc_vec);
+    arma_ignore(ws);
+  
+    return false;  // use of LAPACK is checked before the slices are processed
+    }
+  #endif
+  }
+
+
+
+//! copy the conjugated lower triangle into the upper triangle
+template<typename eT>
+inline
+void
+batch_linalg::fill_upper(eT* A, const uword N)
+  {
+  for(uword j=0; j < N; ++j)
+  for(uword i=0; i < j; ++i)
+    {
+    A[j*N + i] = access::alt_conj(A[i*N + j]);
+    }
+  }
+
+
+
+//! copy the conjugated upper triangle into the lower triangle
+template<typename eT>
+inline
+void
+batch_linalg::fill_lower(eT* A, const uword N)
+  {
+  for(uword j=0; j < N; ++j)
+  for(uword i=j+1; i < N; ++i)
+    {
+    A[j*N + i] = access::alt_conj(A[i*N + j]);
+    }
+  }
+
+
+
+//! @}
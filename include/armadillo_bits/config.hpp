@@ -198,6 +198,10 @@
 //// Uncomment the above line to see the function traces of how Armadillo evaluates expressions.
 //// This is mainly useful for debugging of the library.
 
+// #define ARMA_PROFILE
+//// Uncomment the above line to record call counts, time and temporary allocations of internal functions.
+//// See arma_profiler::print() for printing the results.
+
 
 #if defined(ARMA_EXTRA_DEBUG)
   #undef  ARMA_NO_DEBUG
@@ -285,6 +289,11 @@
   //// Uncomment the above line to disable use of std::mutex
 #endif
 
+#if !defined(ARMA_DONT_USE_STD_THREAD)
+  // #define ARMA_DONT_USE_STD_THREAD
+  //// Uncomment the above line to disable use of std::thread
+#endif
+
 // for compatibility with earlier versions of Armadillo
 #if defined(ARMA_DONT_USE_CXX11_MUTEX)
   #pragma message ("WARNING: support for ARMA_DONT_USE_CXX11_MUTEX is deprecated and will be removed;")
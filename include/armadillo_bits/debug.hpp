@@ -1374,15 +1374,29 @@ arma_assert_atlas_size(const T1& A, const T2& B)
 
 
 
+#if defined(ARMA_PROFILE)
+  
+  // each function gets its own profiler site, created on the first call; see arma_profiler_bones.hpp;
+  // arma_extra_debug_sigprint_this() is only used by constructors and destructors, which are not profiled
+  #define arma_profiler_sigprint  static arma_profiler::site* const arma_profiler_site = arma_profiler::get_site(ARMA_FNSIG); const arma_profiler::scope arma_profiler_scope(arma_profiler_site);
+  
+#else
+  
+  #define arma_profiler_sigprint
+  
+#endif
+
+
+
 #if defined(ARMA_EXTRA_DEBUG)
   
-  #define arma_extra_debug_sigprint       arma_sigprint(ARMA_FNSIG); arma_bktprint
+  #define arma_extra_debug_sigprint       arma_profiler_sigprint arma_sigprint(ARMA_FNSIG); arma_bktprint
   #define arma_extra_debug_sigprint_this  arma_sigprint(ARMA_FNSIG); arma_thisprint
   #define arma_extra_debug_print          arma_print
   
 #else
   
-  #define arma_extra_debug_sigprint        true ? (void)0 : arma_bktprint
+  #define arma_extra_debug_sigprint        arma_profiler_sigprint true ? (void)0 : arma_bktprint
   #define arma_extra_debug_sigprint_this   true ? (void)0 : arma_thisprint
   #define arma_extra_debug_print           true ? (void)0 : arma_print
   
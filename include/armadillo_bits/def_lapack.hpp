@@ -98,6 +98,26 @@
   #define arma_cpbtrf cpbtrf
   #define arma_zpbtrf zpbtrf
   
+  #define arma_spbtrs spbtrs
+  #define arma_dpbtrs dpbtrs
+  #define arma_cpbtrs cpbtrs
+  #define arma_zpbtrs zpbtrs
+  
+  #define arma_spptrf spptrf
+  #define arma_dpptrf dpptrf
+  #define arma_cpptrf cpptrf
+  #define arma_zpptrf zpptrf
+  
+  #define arma_spptrs spptrs
+  #define arma_dpptrs dpptrs
+  #define arma_cpptrs cpptrs
+  #define arma_zpptrs zpptrs
+  
+  #define arma_stptrs stptrs
+  #define arma_dtptrs dtptrs
+  #define arma_ctptrs ctptrs
+  #define arma_ztptrs ztptrs
+  
   #define arma_spotri spotri
   #define arma_dpotri dpotri
   #define arma_cpotri cpotri
@@ -248,6 +268,16 @@
   #define arma_cgbcon cgbcon
   #define arma_zgbcon zgbcon
   
+  #define arma_spbcon spbcon
+  #define arma_dpbcon dpbcon
+  #define arma_cpbcon cpbcon
+  #define arma_zpbcon zpbcon
+  
+  #define arma_stpcon stpcon
+  #define arma_dtpcon dtpcon
+  #define arma_ctpcon ctpcon
+  #define arma_ztpcon ztpcon
+  
   #define arma_ilaenv ilaenv
   
   #define arma_slahqr slahqr
@@ -269,6 +299,30 @@
   #define arma_cpstrf cpstrf
   #define arma_zpstrf zpstrf
   
+  #define arma_ssytrf ssytrf
+  #define arma_dsytrf dsytrf
+  
+  #define arma_chetrf chetrf
+  #define arma_zhetrf zhetrf
+  
+  #define arma_ssytrs ssytrs
+  #define arma_dsytrs dsytrs
+  
+  #define arma_chetrs chetrs
+  #define arma_zhetrs zhetrs
+  
+  #define arma_ssycon ssycon
+  #define arma_dsycon dsycon
+  
+  #define arma_checon checon
+  #define arma_zhecon zhecon
+  
+  #define arma_sormqr sormqr
+  #define arma_dormqr dormqr
+  
+  #define arma_cunmqr cunmqr
+  #define arma_zunmqr zunmqr
+  
 #else
   
   #define arma_sgetrf SGETRF
@@ -334,6 +388,26 @@
   #define arma_cpbtrf CPBTRF
   #define arma_zpbtrf ZPBTRF
   
+  #define arma_spbtrs SPBTRS
+  #define arma_dpbtrs DPBTRS
+  #define arma_cpbtrs CPBTRS
+  #define arma_zpbtrs ZPBTRS
+  
+  #define arma_spptrf SPPTRF
+  #define arma_dpptrf DPPTRF
+  #define arma_cpptrf CPPTRF
+  #define arma_zpptrf ZPPTRF
+  
+  #define arma_spptrs SPPTRS
+  #define arma_dpptrs DPPTRS
+  #define arma_cpptrs CPPTRS
+  #define arma_zpptrs ZPPTRS
+  
+  #define arma_stptrs STPTRS
+  #define arma_dtptrs DTPTRS
+  #define arma_ctptrs CTPTRS
+  #define arma_ztptrs ZTPTRS
+  
   #define arma_spotri SPOTRI
   #define arma_dpotri DPOTRI
   #define arma_cpotri CPOTRI
@@ -484,6 +558,16 @@
   #define arma_cgbcon CGBCON
   #define arma_zgbcon ZGBCON
   
+  #define arma_spbcon SPBCON
+  #define arma_dpbcon DPBCON
+  #define arma_cpbcon CPBCON
+  #define arma_zpbcon ZPBCON
+  
+  #define arma_stpcon STPCON
+  #define arma_dtpcon DTPCON
+  #define arma_ctpcon CTPCON
+  #define arma_ztpcon ZTPCON
+  
   #define arma_ilaenv ILAENV
   
   #define arma_slahqr SLAHQR
@@ -505,6 +589,30 @@
   #define arma_cpstrf CPSTRF
   #define arma_zpstrf ZPSTRF
   
+  #define arma_ssytrf SSYTRF
+  #define arma_dsytrf DSYTRF
+  
+  #define arma_chetrf CHETRF
+  #define arma_zhetrf ZHETRF
+  
+  #define arma_ssytrs SSYTRS
+  #define arma_dsytrs DSYTRS
+  
+  #define arma_chetrs CHETRS
+  #define arma_zhetrs ZHETRS
+  
+  #define arma_ssycon SSYCON
+  #define arma_dsycon DSYCON
+  
+  #define arma_checon CHECON
+  #define arma_zhecon ZHECON
+  
+  #define arma_sormqr SORMQR
+  #define arma_dormqr DORMQR
+  
+  #define arma_cunmqr CUNMQR
+  #define arma_zunmqr ZUNMQR
+  
 #endif
 
 
@@ -611,6 +719,30 @@ extern "C"
   void arma_fortran(arma_cpbtrf)(const char* uplo, const blas_int* n, const blas_int* kd, blas_cxf* ab, const blas_int* ldab, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
   void arma_fortran(arma_zpbtrf)(const char* uplo, const blas_int* n, const blas_int* kd, blas_cxd* ab, const blas_int* ldab, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
   
+  // solve system of linear equations (using pre-computed Cholesky decomposition of band matrix)
+  void arma_fortran(arma_spbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const    float* ab, const blas_int* ldab,    float* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dpbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const   double* ab, const blas_int* ldab,   double* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_cpbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const blas_cxf* ab, const blas_int* ldab, blas_cxf* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zpbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const blas_cxd* ab, const blas_int* ldab, blas_cxd* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // Cholesky decomposition (packed storage)
+  void arma_fortran(arma_spptrf)(const char* uplo, const blas_int* n,    float* ap, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dpptrf)(const char* uplo, const blas_int* n,   double* ap, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_cpptrf)(const char* uplo, const blas_int* n, blas_cxf* ap, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zpptrf)(const char* uplo, const blas_int* n, blas_cxd* ap, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // solve system of linear equations (using pre-computed Cholesky decomposition in packed storage)
+  void arma_fortran(arma_spptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const    float* ap,    float* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dpptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const   double* ap,   double* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_cpptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxf* ap, blas_cxf* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zpptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxd* ap, blas_cxd* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // solve system of linear equations (triangular matrix in packed storage)
+  void arma_fortran(arma_stptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const    float* ap,    float* b, const blas_int* ldb, blas_int* info, blas_len uplo_len, blas_len trans_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dtptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const   double* ap,   double* b, const blas_int* ldb, blas_int* info, blas_len uplo_len, blas_len trans_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ctptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const blas_cxf* ap, blas_cxf* b, const blas_int* ldb, blas_int* info, blas_len uplo_len, blas_len trans_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ztptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const blas_cxd* ap, blas_cxd* b, const blas_int* ldb, blas_int* info, blas_len uplo_len, blas_len trans_len, blas_len diag_len) ARMA_NOEXCEPT;
+  
   // matrix inversion (using pre-computed Cholesky decomposition)
   void arma_fortran(arma_spotri)(const char* uplo, const blas_int* n,    float* a, const blas_int* lda, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
   void arma_fortran(arma_dpotri)(const char* uplo, const blas_int* n,   double* a, const blas_int* lda, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
@@ -819,6 +951,22 @@ extern "C"
   void arma_fortran(arma_cgbcon)(const char* norm, const blas_int* n, const blas_int* kl, const blas_int* ku, const blas_cxf* ab, const blas_int* ldab, const blas_int* ipiv, const  float* anorm,  float* rcond, blas_cxf* work,  float* rwork, blas_int* info, blas_len norm_len) ARMA_NOEXCEPT;
   void arma_fortran(arma_zgbcon)(const char* norm, const blas_int* n, const blas_int* kl, const blas_int* ku, const blas_cxd* ab, const blas_int* ldab, const blas_int* ipiv, const double* anorm, double* rcond, blas_cxd* work, double* rwork, blas_int* info, blas_len norm_len) ARMA_NOEXCEPT;
   
+  // reciprocal of condition number (real, symmetric positive definite band matrix)
+  void arma_fortran(arma_spbcon)(const char* uplo, const blas_int* n, const blas_int* kd, const  float* ab, const blas_int* ldab, const  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dpbcon)(const char* uplo, const blas_int* n, const blas_int* kd, const double* ab, const blas_int* ldab, const double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (complex, hermitian positive definite band matrix)
+  void arma_fortran(arma_cpbcon)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_cxf* ab, const blas_int* ldab, const  float* anorm,  float* rcond, blas_cxf* work,  float* rwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zpbcon)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_cxd* ab, const blas_int* ldab, const double* anorm, double* rcond, blas_cxd* work, double* rwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (real, packed triangular matrix)
+  void arma_fortran(arma_stpcon)(const char* norm, const char* uplo, const char* diag, const blas_int* n, const  float* ap,  float* rcond,  float* work, blas_int* iwork, blas_int* info, blas_len norm_len, blas_len uplo_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dtpcon)(const char* norm, const char* uplo, const char* diag, const blas_int* n, const double* ap, double* rcond, double* work, blas_int* iwork, blas_int* info, blas_len norm_len, blas_len uplo_len, blas_len diag_len) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (complex, packed triangular matrix)
+  void arma_fortran(arma_ctpcon)(const char* norm, const char* uplo, const char* diag, const blas_int* n, const blas_cxf* ap,  float* rcond, blas_cxf* work,  float* rwork, blas_int* info, blas_len norm_len, blas_len uplo_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ztpcon)(const char* norm, const char* uplo, const char* diag, const blas_int* n, const blas_cxd* ap, double* rcond, blas_cxd* work, double* rwork, blas_int* info, blas_len norm_len, blas_len uplo_len, blas_len diag_len) ARMA_NOEXCEPT;
+  
   // obtain parameters according to the local configuration of lapack
   blas_int arma_fortran(arma_ilaenv)(const blas_int* ispec, const char* name, const char* opts, const blas_int* n1, const blas_int* n2, const blas_int* n3, const blas_int* n4, blas_len name_len, blas_len opts_len) ARMA_NOEXCEPT;
   
@@ -846,6 +994,38 @@ extern "C"
   void arma_fortran(arma_cpstrf)(const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda, blas_int* piv, blas_int* rank, const  float* tol,  float* work, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
   void arma_fortran(arma_zpstrf)(const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, blas_int* piv, blas_int* rank, const double* tol, double* work, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
   
+  // LDL^T decomposition (real, symmetric indefinite matrix)
+  void arma_fortran(arma_ssytrf)(const char* uplo, const blas_int* n,  float* a, const blas_int* lda, blas_int* ipiv,  float* work, const blas_int* lwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsytrf)(const char* uplo, const blas_int* n, double* a, const blas_int* lda, blas_int* ipiv, double* work, const blas_int* lwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // LDL^H decomposition (complex, hermitian indefinite matrix)
+  void arma_fortran(arma_chetrf)(const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda, blas_int* ipiv, blas_cxf* work, const blas_int* lwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zhetrf)(const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, blas_int* ipiv, blas_cxd* work, const blas_int* lwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // solve linear equations using LDL^T decomposition (real, symmetric indefinite matrix)
+  void arma_fortran(arma_ssytrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const  float* a, const blas_int* lda, const blas_int* ipiv,  float* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsytrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const double* a, const blas_int* lda, const blas_int* ipiv, double* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // solve linear equations using LDL^H decomposition (complex, hermitian indefinite matrix)
+  void arma_fortran(arma_chetrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxf* a, const blas_int* lda, const blas_int* ipiv, blas_cxf* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zhetrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxd* a, const blas_int* lda, const blas_int* ipiv, blas_cxd* b, const blas_int* ldb, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (real, symmetric indefinite matrix)
+  void arma_fortran(arma_ssycon)(const char* uplo, const blas_int* n, const  float* a, const blas_int* lda, const blas_int* ipiv, const  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsycon)(const char* uplo, const blas_int* n, const double* a, const blas_int* lda, const blas_int* ipiv, const double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (complex, hermitian indefinite matrix)
+  void arma_fortran(arma_checon)(const char* uplo, const blas_int* n, const blas_cxf* a, const blas_int* lda, const blas_int* ipiv, const  float* anorm,  float* rcond, blas_cxf* work, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zhecon)(const char* uplo, const blas_int* n, const blas_cxd* a, const blas_int* lda, const blas_int* ipiv, const double* anorm, double* rcond, blas_cxd* work, blas_int* info, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // multiply by Q from QR decomposition (real matrix)
+  void arma_fortran(arma_sormqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const  float* a, const blas_int* lda, const  float* tau,  float* c, const blas_int* ldc,  float* work, const blas_int* lwork, blas_int* info, blas_len side_len, blas_len trans_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dormqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const double* a, const blas_int* lda, const double* tau, double* c, const blas_int* ldc, double* work, const blas_int* lwork, blas_int* info, blas_len side_len, blas_len trans_len) ARMA_NOEXCEPT;
+  
+  // multiply by Q from QR decomposition (complex matrix)
+  void arma_fortran(arma_cunmqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const blas_cxf* a, const blas_int* lda, const blas_cxf* tau, blas_cxf* c, const blas_int* ldc, blas_cxf* work, const blas_int* lwork, blas_int* info, blas_len side_len, blas_len trans_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zunmqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const blas_cxd* a, const blas_int* lda, const blas_cxd* tau, blas_cxd* c, const blas_int* ldc, blas_cxd* work, const blas_int* lwork, blas_int* info, blas_len side_len, blas_len trans_len) ARMA_NOEXCEPT;
+  
 #else
   
   // prototypes without hidden arguments
@@ -932,6 +1112,30 @@ extern "C"
   void arma_fortran(arma_cpbtrf)(const char* uplo, const blas_int* n, const blas_int* kd, blas_cxf* ab, const blas_int* ldab, blas_int* info) ARMA_NOEXCEPT;
   void arma_fortran(arma_zpbtrf)(const char* uplo, const blas_int* n, const blas_int* kd, blas_cxd* ab, const blas_int* ldab, blas_int* info) ARMA_NOEXCEPT;
   
+  // solve system of linear equations (using pre-computed Cholesky decomposition of band matrix)
+  void arma_fortran(arma_spbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const    float* ab, const blas_int* ldab,    float* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dpbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const   double* ab, const blas_int* ldab,   double* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_cpbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const blas_cxf* ab, const blas_int* ldab, blas_cxf* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zpbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const blas_cxd* ab, const blas_int* ldab, blas_cxd* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  
+  // Cholesky decomposition (packed storage)
+  void arma_fortran(arma_spptrf)(const char* uplo, const blas_int* n,    float* ap, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dpptrf)(const char* uplo, const blas_int* n,   double* ap, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_cpptrf)(const char* uplo, const blas_int* n, blas_cxf* ap, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zpptrf)(const char* uplo, const blas_int* n, blas_cxd* ap, blas_int* info) ARMA_NOEXCEPT;
+  
+  // solve system of linear equations (using pre-computed Cholesky decomposition in packed storage)
+  void arma_fortran(arma_spptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const    float* ap,    float* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dpptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const   double* ap,   double* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_cpptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxf* ap, blas_cxf* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zpptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxd* ap, blas_cxd* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  
+  // solve system of linear equations (triangular matrix in packed storage)
+  void arma_fortran(arma_stptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const    float* ap,    float* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dtptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const   double* ap,   double* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ctptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const blas_cxf* ap, blas_cxf* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ztptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const blas_cxd* ap, blas_cxd* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  
   // matrix inversion (using pre-computed Cholesky decomposition)
   void arma_fortran(arma_spotri)(const char* uplo, const blas_int* n,    float* a, const blas_int* lda, blas_int* info) ARMA_NOEXCEPT;
   void arma_fortran(arma_dpotri)(const char* uplo, const blas_int* n,   double* a, const blas_int* lda, blas_int* info) ARMA_NOEXCEPT;
@@ -1141,6 +1345,22 @@ extern "C"
   void arma_fortran(arma_cgbcon)(const char* norm, const blas_int* n, const blas_int* kl, const blas_int* ku, const blas_cxf* ab, const blas_int* ldab, const blas_int* ipiv, const  float* anorm,  float* rcond, blas_cxf* work,  float* rwork, blas_int* info) ARMA_NOEXCEPT;
   void arma_fortran(arma_zgbcon)(const char* norm, const blas_int* n, const blas_int* kl, const blas_int* ku, const blas_cxd* ab, const blas_int* ldab, const blas_int* ipiv, const double* anorm, double* rcond, blas_cxd* work, double* rwork, blas_int* info) ARMA_NOEXCEPT;
   
+  // reciprocal of condition number (real, symmetric positive definite band matrix)
+  void arma_fortran(arma_spbcon)(const char* uplo, const blas_int* n, const blas_int* kd, const  float* ab, const blas_int* ldab, const  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dpbcon)(const char* uplo, const blas_int* n, const blas_int* kd, const double* ab, const blas_int* ldab, const double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (complex, hermitian positive definite band matrix)
+  void arma_fortran(arma_cpbcon)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_cxf* ab, const blas_int* ldab, const  float* anorm,  float* rcond, blas_cxf* work,  float* rwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zpbcon)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_cxd* ab, const blas_int* ldab, const double* anorm, double* rcond, blas_cxd* work, double* rwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (real, packed triangular matrix)
+  void arma_fortran(arma_stpcon)(const char* norm, const char* uplo, const char* diag, const blas_int* n, const  float* ap,  float* rcond,  float* work, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dtpcon)(const char* norm, const char* uplo, const char* diag, const blas_int* n, const double* ap, double* rcond, double* work, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (complex, packed triangular matrix)
+  void arma_fortran(arma_ctpcon)(const char* norm, const char* uplo, const char* diag, const blas_int* n, const blas_cxf* ap,  float* rcond, blas_cxf* work,  float* rwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ztpcon)(const char* norm, const char* uplo, const char* diag, const blas_int* n, const blas_cxd* ap, double* rcond, blas_cxd* work, double* rwork, blas_int* info) ARMA_NOEXCEPT;
+  
   // obtain parameters according to the local configuration of lapack
   // NOTE: DO NOT USE THIS FORM; kept only for compatibility
   // NOTE: this function takes 'name' and 'opts' argumments, which are strings with length != 1; their length needs to be given via "hidden" parameters, which this form lacks
@@ -1170,6 +1390,38 @@ extern "C"
   void arma_fortran(arma_cpstrf)(const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda, blas_int* piv, blas_int* rank, const  float* tol,  float* work, blas_int* info) ARMA_NOEXCEPT;
   void arma_fortran(arma_zpstrf)(const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, blas_int* piv, blas_int* rank, const double* tol, double* work, blas_int* info) ARMA_NOEXCEPT;
   
+  // LDL^T decomposition (real, symmetric indefinite matrix)
+  void arma_fortran(arma_ssytrf)(const char* uplo, const blas_int* n,  float* a, const blas_int* lda, blas_int* ipiv,  float* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsytrf)(const char* uplo, const blas_int* n, double* a, const blas_int* lda, blas_int* ipiv, double* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // LDL^H decomposition (complex, hermitian indefinite matrix)
+  void arma_fortran(arma_chetrf)(const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda, blas_int* ipiv, blas_cxf* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zhetrf)(const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, blas_int* ipiv, blas_cxd* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // solve linear equations using LDL^T decomposition (real, symmetric indefinite matrix)
+  void arma_fortran(arma_ssytrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const  float* a, const blas_int* lda, const blas_int* ipiv,  float* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsytrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const double* a, const blas_int* lda, const blas_int* ipiv, double* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  
+  // solve linear equations using LDL^H decomposition (complex, hermitian indefinite matrix)
+  void arma_fortran(arma_chetrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxf* a, const blas_int* lda, const blas_int* ipiv, blas_cxf* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zhetrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxd* a, const blas_int* lda, const blas_int* ipiv, blas_cxd* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (real, symmetric indefinite matrix)
+  void arma_fortran(arma_ssycon)(const char* uplo, const blas_int* n, const  float* a, const blas_int* lda, const blas_int* ipiv, const  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsycon)(const char* uplo, const blas_int* n, const double* a, const blas_int* lda, const blas_int* ipiv, const double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // reciprocal of condition number (complex, hermitian indefinite matrix)
+  void arma_fortran(arma_checon)(const char* uplo, const blas_int* n, const blas_cxf* a, const blas_int* lda, const blas_int* ipiv, const  float* anorm,  float* rcond, blas_cxf* work, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zhecon)(const char* uplo, const blas_int* n, const blas_cxd* a, const blas_int* lda, const blas_int* ipiv, const double* anorm, double* rcond, blas_cxd* work, blas_int* info) ARMA_NOEXCEPT;
+  
+  // multiply by Q from QR decomposition (real matrix)
+  void arma_fortran(arma_sormqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const  float* a, const blas_int* lda, const  float* tau,  float* c, const blas_int* ldc,  float* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dormqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const double* a, const blas_int* lda, const double* tau, double* c, const blas_int* ldc, double* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // multiply by Q from QR decomposition (complex matrix)
+  void arma_fortran(arma_cunmqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const blas_cxf* a, const blas_int* lda, const blas_cxf* tau, blas_cxf* c, const blas_int* ldc, blas_cxf* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zunmqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const blas_cxd* a, const blas_int* lda, const blas_cxd* tau, blas_cxd* c, const blas_int* ldc, blas_cxd* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
+  
 #endif
 }
 
@@ -40,6 +40,8 @@ class diskio
   friend class SpMat_aux;
   friend class field_aux;
   
+  friend class gemm_ooc;
+  
   template<typename eT> arma_cold inline static std::string gen_txt_header(const Mat<eT>&);
   template<typename eT> arma_cold inline static std::string gen_bin_header(const Mat<eT>&);
   
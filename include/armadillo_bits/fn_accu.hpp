@@ -54,17 +54,23 @@ accu_proxy_linear(const Proxy<T1>& P)
       for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
         {
         const uword start = (thread_id+0) * chunk_size;
-        const uword endp1 = (thread_id+1) * chunk_size;
+        const uword endp1 = ((thread_id+1) == n_threads_use) ? n_elem : ((thread_id+1) * chunk_size);
         
         eT acc = eT(0);
-        for(uword i=start; i < endp1; ++i)  { acc += Pea[i]; }
+        
+        if(arma_config::compensated_sum && is_real<eT>::value)
+          {
+          acc = arrayops::accumulate_compensated<eT>(Pea, start, endp1);
+          }
+        else
+          {
+          for(uword i=start; i < endp1; ++i)  { acc += Pea[i]; }
+          }
         
         partial_accs[thread_id] = acc;
         }
       
-      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)  { val += partial_accs[thread_id]; }
-      
-      for(uword i=(n_threads_use*chunk_size); i < n_elem; ++i)  { val += Pea[i]; }
+      val = arrayops::accumulate(partial_accs.memptr(), n_threads_use);
       }
     #endif
     }
@@ -85,15 +91,22 @@ accu_proxy_linear(const Proxy<T1>& P)
       }
     #else
       {
-      eT val1 = eT(0);
-      eT val2 = eT(0);
-      
-      uword i,j;
-      for(i=0, j=1; j < n_elem; i+=2, j+=2)  { val1 += Pea[i]; val2 += Pea[j]; }
-      
-      if(i < n_elem)  { val1 += Pea[i]; }
-      
-      val = val1 + val2;
+      if(arma_config::compensated_sum && is_real<eT>::value)
+        {
+        val = arrayops::accumulate_compensated<eT>(Pea, 0, n_elem);
+        }
+      else
+        {
+        eT val1 = eT(0);
+        eT val2 = eT(0);
+        
+        uword i,j;
+        for(i=0, j=1; j < n_elem; i+=2, j+=2)  { val1 += Pea[i]; val2 += Pea[j]; }
+        
+        if(i < n_elem)  { val1 += Pea[i]; }
+        
+        val = val1 + val2;
+        }
       }
     #endif
     }
@@ -264,7 +277,7 @@ accu(const T1& X)
     {
     const quasi_unwrap<typename Proxy<T1>::stored_type> tmp(P.Q);
     
-    return arrayops::accumulate(tmp.M.memptr(), tmp.M.n_elem);
+    return arrayops::accumulate_mp(tmp.M.memptr(), tmp.M.n_elem);
     }
   
   return (Proxy<T1>::use_at) ? accu_proxy_at(P) : accu_proxy_linear(P);
@@ -627,17 +640,23 @@ accu_cube_proxy_linear(const ProxyCube<T1>& P)
       for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
         {
         const uword start = (thread_id+0) * chunk_size;
-        const uword endp1 = (thread_id+1) * chunk_size;
+        const uword endp1 = ((thread_id+1) == n_threads_use) ? n_elem : ((thread_id+1) * chunk_size);
         
         eT acc = eT(0);
-        for(uword i=start; i < endp1; ++i)  { acc += Pea[i]; }
+        
+        if(arma_config::compensated_sum && is_real<eT>::value)
+          {
+          acc = arrayops::accumulate_compensated<eT>(Pea, start, endp1);
+          }
+        else
+          {
+          for(uword i=start; i < endp1; ++i)  { acc += Pea[i]; }
+          }
         
         partial_accs[thread_id] = acc;
         }
       
-      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)  { val += partial_accs[thread_id]; }
-      
-      for(uword i=(n_threads_use*chunk_size); i < n_elem; ++i)  { val += Pea[i]; }
+      val = arrayops::accumulate(partial_accs.memptr(), n_threads_use);
       }
     #endif
     }
@@ -146,4 +146,122 @@ chol
 
 
 
+//! update the Cholesky factor R of matrix A, so that R becomes the Cholesky factor of A + V*V.t();
+//! each column of V is a rank-1 update
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+cholupdate
+  (
+         Mat<typename T1::elem_type>&    R,
+  const Base<typename T1::elem_type,T1>& V,
+  const char* layout = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (layout != nullptr) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "cholupdate(): layout must be \"upper\" or \"lower\"" );
+  
+  const bool status = op_chol::apply_update(R, V.get_ref(), ((sig == 'u') ? 0 : 1), false);
+  
+  if(status == false)  { arma_debug_warn_level(3, "cholupdate(): update failed"); }
+  
+  return status;
+  }
+
+
+
+//! downdate the Cholesky factor R of matrix A, so that R becomes the Cholesky factor of A - V*V.t();
+//! each column of V is a rank-1 downdate
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+choldowndate
+  (
+         Mat<typename T1::elem_type>&    R,
+  const Base<typename T1::elem_type,T1>& V,
+  const char* layout = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (layout != nullptr) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "choldowndate(): layout must be \"upper\" or \"lower\"" );
+  
+  const bool status = op_chol::apply_update(R, V.get_ref(), ((sig == 'u') ? 0 : 1), true);
+  
+  if(status == false)  { arma_debug_warn_level(3, "choldowndate(): downdated matrix is not positive definite"); }
+  
+  return status;
+  }
+
+
+
+//! Cholesky decomposition of each slice of a cube
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, Cube<typename T1::elem_type> >::result
+chol
+  (
+  const BaseCube<typename T1::elem_type,T1>& X,
+  const char* layout = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (layout != nullptr) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "chol(): layout must be \"upper\" or \"lower\"" );
+  
+  Cube<typename T1::elem_type> out(X.get_ref());
+  
+  const bool status = batch_linalg::chol(out, ((sig == 'u') ? 0 : 1));
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("chol(): decomposition failed");
+    }
+  
+  return out;
+  }
+
+
+
+//! Cholesky decomposition of each slice of a cube;
+//! if the decomposition fails for a slice, the corresponding output slice is filled with NaN
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+chol
+  (
+         Cube<typename T1::elem_type>&       out,
+  const BaseCube<typename T1::elem_type,T1>& X,
+  const char* layout = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (layout != nullptr) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "chol(): layout must be \"upper\" or \"lower\"" );
+  
+  out = X.get_ref();
+  
+  const bool status = batch_linalg::chol(out, ((sig == 'u') ? 0 : 1));
+  
+  if(status == false)
+    {
+    arma_debug_warn_level(3, "chol(): decomposition failed for one or more slices");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
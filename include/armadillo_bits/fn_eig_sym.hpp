@@ -158,4 +158,96 @@ eig_sym
 
 
 
+//! eigenvalues of each symmetric/hermitian slice of a cube; column i of the output holds the eigenvalues of slice i
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, Mat<typename T1::pod_type> >::result
+eig_sym
+  (
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  typedef typename T1::pod_type   T;
+  
+  const unwrap_cube<T1> UX(X.get_ref());
+  
+  Mat<T>   eigval;
+  Cube<eT> eigvec_junk;
+  
+  const bool status = batch_linalg::eig_sym(eigval, eigvec_junk, UX.M, false);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_stop_runtime_error("eig_sym(): decomposition failed");
+    }
+  
+  return eigval;
+  }
+
+
+
+//! eigenvalues of each symmetric/hermitian slice of a cube;
+//! if the decomposition fails for a slice, the corresponding column of eigval is filled with NaN
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+eig_sym
+  (
+         Mat<typename T1::pod_type>&         eigval,
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1> UX(X.get_ref());
+  
+  Cube<eT> eigvec_junk;
+  
+  const bool status = batch_linalg::eig_sym(eigval, eigvec_junk, UX.M, false);
+  
+  if(status == false)
+    {
+    arma_debug_warn_level(3, "eig_sym(): decomposition failed for one or more slices");
+    }
+  
+  return status;
+  }
+
+
+
+//! eigenvalues and eigenvectors of each symmetric/hermitian slice of a cube;
+//! if the decomposition fails for a slice, the corresponding column of eigval and slice of eigvec are filled with NaN
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+eig_sym
+  (
+         Mat<typename T1::pod_type>&         eigval,
+         Cube<typename T1::elem_type>&       eigvec,
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_cube_check<T1> UX(X.get_ref(), eigvec);
+  
+  const bool status = batch_linalg::eig_sym(eigval, eigvec, UX.M, true);
+  
+  if(status == false)
+    {
+    arma_debug_warn_level(3, "eig_sym(): decomposition failed for one or more slices");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
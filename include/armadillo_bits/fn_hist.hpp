@@ -73,4 +73,32 @@ hist(const T1& X, const T2& Y, const uword dim)
   }
 
 
+template<typename T1, typename T2, typename T3>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_arma_type<T1>::value && is_arma_type<T2>::value && is_arma_type<T3>::value && is_real<typename T1::elem_type>::value && is_same_type<typename T1::elem_type, typename T2::elem_type>::value && is_same_type<typename T1::elem_type, typename T3::elem_type>::value,
+  Mat<typename T1::elem_type>
+  >::result
+hist_weighted(const T1& X, const T2& centers, const T3& W)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> UX(X);
+  const quasi_unwrap<T2> UC(centers);
+  const quasi_unwrap<T3> UW(W);
+  
+  Mat<eT> out;
+  
+  glue_hist::apply_weighted_noalias(out, UX.M, UC.M, UW.M);
+  
+  return out;
+  }
+
+
+
 //! @}
@@ -177,6 +177,144 @@ interp1_helper_linear(const Mat<eT>& XG, const Mat<eT>& YG, const Mat<eT>& XI, M
 
 
 
+template<typename eT>
+inline
+bool
+interp1_helper_is_uniform(const Mat<eT>& XG)
+  {
+  arma_extra_debug_sigprint();
+  
+  // XG is assumed to be sorted in strictly ascending manner
+  
+  const uword NG = XG.n_elem;
+  
+  if(NG < 2)  { return false; }
+  
+  const eT* XG_mem = XG.memptr();
+  
+  const eT XG_first = XG_mem[0   ];
+  const eT XG_last  = XG_mem[NG-1];
+  
+  const eT dx = (XG_last - XG_first) / eT(NG-1);
+  
+  if( (dx > eT(0)) == false )  { return false; }
+  
+  if( (arma_isfinite(XG_first) == false) || (arma_isfinite(XG_last) == false) )  { return false; }
+  
+  // the spacing only needs to be approximately uniform,
+  // as the index computed from the spacing is subsequently refined;
+  // see interp1_helper_uniform_index()
+  
+  const eT tol = eT(0.01) * dx;
+  
+  for(uword i=1; i < (NG-1); ++i)
+    {
+    const eT delta = XG_mem[i] - (XG_first + eT(i)*dx);
+    
+    if( (std::abs(delta) <= tol) == false )  { return false; }  // also catches NaN
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+interp1_helper_uniform_index(const eT* XG_mem, const uword NG, const eT XG_min, const eT inv_dx, const eT XI_val)
+  {
+  // XI_val is assumed to be in the [XG_min, XG_max] range;
+  // returns j such that XG_mem[j] <= XI_val <= XG_mem[j+1]
+  
+  const eT pos = (XI_val - XG_min) * inv_dx;
+  
+  uword j = (pos > eT(0)) ? uword(pos) : uword(0);
+  
+  j = (std::min)(j, uword(NG-2));
+  
+  while( (j > 0) && (XG_mem[j] > XI_val) )  { --j; }
+  
+  while( ((j+2) < NG) && (XG_mem[j+1] < XI_val) )  { ++j; }
+  
+  return j;
+  }
+
+
+
+template<typename eT>
+arma_inline
+eT
+interp1_helper_uniform_eval(const eT* XG_mem, const eT* YG_mem, const uword NG, const eT XG_min, const eT XG_max, const eT inv_dx, const eT XI_val, const eT extrap_val, const bool nearest)
+  {
+  if((XI_val < XG_min) || (XI_val > XG_max))  { return extrap_val; }
+  
+  if(arma_isnan(XI_val))  { return Datum<eT>::nan; }
+  
+  const uword j = interp1_helper_uniform_index(XG_mem, NG, XG_min, inv_dx, XI_val);
+  
+  const eT a_err = XI_val - XG_mem[j  ];
+  const eT b_err = XG_mem[j+1] - XI_val;
+  
+  if(nearest)  { return (a_err <= b_err) ? YG_mem[j] : YG_mem[j+1]; }
+  
+  const eT weight = (a_err > eT(0)) ? (a_err / (a_err + b_err)) : eT(0);
+  
+  return (eT(1) - weight)*YG_mem[j] + (weight)*YG_mem[j+1];
+  }
+
+
+
+template<typename eT>
+inline
+void
+interp1_helper_uniform(const Mat<eT>& XG, const Mat<eT>& YG, const Mat<eT>& XI, Mat<eT>& YI, const eT extrap_val, const bool nearest)
+  {
+  arma_extra_debug_sigprint();
+  
+  // XG is assumed to be uniformly spaced and sorted in ascending manner;
+  // XI does not need to be sorted, as the bracketing interval is directly computed for each element
+  
+  const uword NG = XG.n_elem;
+  const uword NI = XI.n_elem;
+  
+  YI.copy_size(XI);
+  
+  const eT* XG_mem = XG.memptr();
+  const eT* YG_mem = YG.memptr();
+  const eT* XI_mem = XI.memptr();
+        eT* YI_mem = YI.memptr();
+  
+  const eT XG_min = XG_mem[0   ];
+  const eT XG_max = XG_mem[NG-1];
+  
+  const eT inv_dx = eT(NG-1) / (XG_max - XG_min);
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(mp_gate<eT>::eval(NI))
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword i=0; i<NI; ++i)
+        {
+        YI_mem[i] = interp1_helper_uniform_eval(XG_mem, YG_mem, NG, XG_min, XG_max, inv_dx, XI_mem[i], extrap_val, nearest);
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword i=0; i<NI; ++i)
+    {
+    YI_mem[i] = interp1_helper_uniform_eval(XG_mem, YG_mem, NG, XG_min, XG_max, inv_dx, XI_mem[i], extrap_val, nearest);
+    }
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -196,39 +334,61 @@ interp1_helper(const Mat<eT>& X, const Mat<eT>& Y, const Mat<eT>& XI, Mat<eT>& Y
   // sig = 20: linear
   // sig = 21: linear, assume monotonic increase in X and XI
   
-  if(sig == 11)  { interp1_helper_nearest(X, Y, XI, YI, extrap_val); return; }
-  if(sig == 21)  { interp1_helper_linear (X, Y, XI, YI, extrap_val); return; }
-  
-  uvec X_indices;
-  
-  try { X_indices = find_unique(X,false); } catch(...) { }
-  
-  // NOTE: find_unique(X,false) provides indices of elements sorted in ascending order
-  // NOTE: find_unique(X,false) will reset X_indices if X has NaN
-  
-  const uword N_subset = X_indices.n_elem;
-  
-  arma_debug_check( (N_subset < 2), "interp1(): X must have at least two unique elements" );
-  
-  Mat<eT> X_sanitised(N_subset, 1, arma_nozeros_indicator());
-  Mat<eT> Y_sanitised(N_subset, 1, arma_nozeros_indicator());
+  if( (sig == 11) || (sig == 21) )
+    {
+    if(interp1_helper_is_uniform(X))  { interp1_helper_uniform(X, Y, XI, YI, extrap_val, (sig == 11)); return; }
+    
+    if(sig == 11)  { interp1_helper_nearest(X, Y, XI, YI, extrap_val); return; }
+    if(sig == 21)  { interp1_helper_linear (X, Y, XI, YI, extrap_val); return; }
+    }
   
-  eT* X_sanitised_mem = X_sanitised.memptr();
-  eT* Y_sanitised_mem = Y_sanitised.memptr();
+  // if X is already strictly ascending and has no NaN, it doesn't need to be sanitised
   
-  const eT* X_mem = X.memptr();
-  const eT* Y_mem = Y.memptr();
+  const bool X_is_sane = X.is_sorted("strictascend") && (X.has_nan() == false);
   
-  const uword* X_indices_mem = X_indices.memptr();
+  Mat<eT> X_sanitised;
+  Mat<eT> Y_sanitised;
   
-  for(uword i=0; i<N_subset; ++i)
+  if(X_is_sane == false)
     {
-    const uword j = X_indices_mem[i];
+    uvec X_indices;
+    
+    try { X_indices = find_unique(X,false); } catch(...) { }
     
-    X_sanitised_mem[i] = X_mem[j];
-    Y_sanitised_mem[i] = Y_mem[j];
+    // NOTE: find_unique(X,false) provides indices of elements sorted in ascending order
+    // NOTE: find_unique(X,false) will reset X_indices if X has NaN
+    
+    const uword N_subset = X_indices.n_elem;
+    
+    arma_debug_check( (N_subset < 2), "interp1(): X must have at least two unique elements" );
+    
+    X_sanitised.set_size(N_subset, 1);
+    Y_sanitised.set_size(N_subset, 1);
+    
+    eT* X_sanitised_mem = X_sanitised.memptr();
+    eT* Y_sanitised_mem = Y_sanitised.memptr();
+    
+    const eT* X_mem = X.memptr();
+    const eT* Y_mem = Y.memptr();
+    
+    const uword* X_indices_mem = X_indices.memptr();
+    
+    for(uword i=0; i<N_subset; ++i)
+      {
+      const uword j = X_indices_mem[i];
+      
+      X_sanitised_mem[i] = X_mem[j];
+      Y_sanitised_mem[i] = Y_mem[j];
+      }
     }
   
+  const Mat<eT>& XG = (X_is_sane) ? X : X_sanitised;
+  const Mat<eT>& YG = (X_is_sane) ? Y : Y_sanitised;
+  
+  // for uniformly spaced XG, the position of each XI element is directly computed, so XI doesn't need to be sorted
+  
+  if(interp1_helper_is_uniform(XG))  { interp1_helper_uniform(XG, YG, XI, YI, extrap_val, (sig == 10)); return; }
+  
   
   Mat<eT> XI_tmp;
   uvec    XI_indices;
@@ -259,8 +419,8 @@ interp1_helper(const Mat<eT>& X, const Mat<eT>& Y, const Mat<eT>& XI, Mat<eT>& Y
   // NOTE: XI_sorted may have NaN
   
   
-       if(sig == 10)  { interp1_helper_nearest(X_sanitised, Y_sanitised, XI_sorted, YI, extrap_val); }
-  else if(sig == 20)  { interp1_helper_linear (X_sanitised, Y_sanitised, XI_sorted, YI, extrap_val); }
+       if(sig == 10)  { interp1_helper_nearest(XG, YG, XI_sorted, YI, extrap_val); }
+  else if(sig == 20)  { interp1_helper_linear (XG, YG, XI_sorted, YI, extrap_val); }
   
   
   if( (XI_is_sorted == false) && (YI.n_elem > 0) )
@@ -21,6 +21,113 @@
 
 
 
+template<typename eT>
+inline
+void
+interp2_helper_uniform_apply(const eT* XG_mem, const Mat<eT>& ZG, eT* ZI_mem, const uword ZI_n_rows, const uword NG, const eT XG_min, const eT XG_max, const eT inv_dx, const eT XI_val, const uword i, const eT extrap_val, const uword mode, const bool nearest)
+  {
+  // called from within a parallel region, so elements are accessed through raw pointers and strides instead of subviews;
+  // mode = 0: row i of ZI is formed from rows of ZG; mode = 1: column i of ZI is formed from columns of ZG
+  
+  const uword N         = (mode == 0) ? ZG.n_cols  : ZG.n_rows;
+  const uword ZG_stride = (mode == 0) ? ZG.n_rows  : uword(1);
+  const uword ZI_stride = (mode == 0) ? ZI_n_rows  : uword(1);
+  
+  const eT* ZG_base = ZG.memptr();
+  
+  ZI_mem += (mode == 0) ? i : (i * ZI_n_rows);
+  
+  if( (XI_val < XG_min) || (XI_val > XG_max) || arma_isnan(XI_val) )
+    {
+    const eT fill_val = arma_isnan(XI_val) ? Datum<eT>::nan : extrap_val;
+    
+    for(uword k=0; k<N; ++k)  { ZI_mem[k*ZI_stride] = fill_val; }
+    
+    return;
+    }
+  
+  const uword j = interp1_helper_uniform_index(XG_mem, NG, XG_min, inv_dx, XI_val);
+  
+  const eT a_err = XI_val - XG_mem[j  ];
+  const eT b_err = XG_mem[j+1] - XI_val;
+  
+  if(nearest)
+    {
+    const uword best_j = (a_err <= b_err) ? j : (j+1);
+    
+    const eT* ZG_mem = ZG_base + ((mode == 0) ? best_j : (best_j * ZG.n_rows));
+    
+    for(uword k=0; k<N; ++k)  { ZI_mem[k*ZI_stride] = ZG_mem[k*ZG_stride]; }
+    }
+  else
+    {
+    const eT weight = (a_err > eT(0)) ? (a_err / (a_err + b_err)) : eT(0);
+    
+    const eT* ZG_mem_a = ZG_base + ((mode == 0) ?  j    : ( j    * ZG.n_rows));
+    const eT* ZG_mem_b = ZG_base + ((mode == 0) ? (j+1) : ((j+1) * ZG.n_rows));
+    
+    for(uword k=0; k<N; ++k)
+      {
+      ZI_mem[k*ZI_stride] = (eT(1) - weight)*ZG_mem_a[k*ZG_stride] + (weight)*ZG_mem_b[k*ZG_stride];
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+interp2_helper_uniform(const Mat<eT>& XG, const Mat<eT>& ZG, const Mat<eT>& XI, Mat<eT>& ZI, const eT extrap_val, const uword mode, const bool nearest)
+  {
+  arma_extra_debug_sigprint();
+  
+  // XG is assumed to be uniformly spaced and sorted in ascending manner;
+  // as the bracketing interval is directly computed for each XI element,
+  // each row (mode = 0) or column (mode = 1) of ZI is processed independently
+  
+  if(mode == 0)  { ZI.set_size(XI.n_elem, ZG.n_cols); }
+  if(mode == 1)  { ZI.set_size(ZG.n_rows, XI.n_elem); }
+  
+  const eT* XG_mem = XG.memptr();
+  const eT* XI_mem = XI.memptr();
+        eT* ZI_mem = ZI.memptr();
+  
+  const uword ZI_n_rows = ZI.n_rows;
+  
+  const uword NG = XG.n_elem;
+  const uword NI = XI.n_elem;
+  
+  const eT XG_min = XG_mem[0   ];
+  const eT XG_max = XG_mem[NG-1];
+  
+  const eT inv_dx = eT(NG-1) / (XG_max - XG_min);
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (NI >= 2) && mp_gate<eT>::eval(ZI.n_elem) )
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword i=0; i<NI; ++i)
+        {
+        interp2_helper_uniform_apply(XG_mem, ZG, ZI_mem, ZI_n_rows, NG, XG_min, XG_max, inv_dx, XI_mem[i], i, extrap_val, mode, nearest);
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword i=0; i<NI; ++i)
+    {
+    interp2_helper_uniform_apply(XG_mem, ZG, ZI_mem, ZI_n_rows, NG, XG_min, XG_max, inv_dx, XI_mem[i], i, extrap_val, mode, nearest);
+    }
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -28,6 +135,8 @@ interp2_helper_nearest(const Mat<eT>& XG, const Mat<eT>& ZG, const Mat<eT>& XI,
   {
   arma_extra_debug_sigprint();
   
+  if(interp1_helper_is_uniform(XG))  { interp2_helper_uniform(XG, ZG, XI, ZI, extrap_val, mode, true); return; }
+  
   const eT XG_min = XG.min();
   const eT XG_max = XG.max();
   
@@ -93,6 +202,8 @@ interp2_helper_linear(const Mat<eT>& XG, const Mat<eT>& ZG, const Mat<eT>& XI, M
   {
   arma_extra_debug_sigprint();
   
+  if(interp1_helper_is_uniform(XG))  { interp2_helper_uniform(XG, ZG, XI, ZI, extrap_val, mode, false); return; }
+  
   const eT XG_min = XG.min();
   const eT XG_max = XG.max();
   
@@ -135,4 +135,58 @@ inv_sympd
 
 
 
+//! inverse of each slice of a cube
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, Cube<typename T1::elem_type> >::result
+inv_sympd
+  (
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Cube<typename T1::elem_type> out(X.get_ref());
+  
+  const bool status = batch_linalg::inv_sympd(out);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("inv_sympd(): matrix is singular or not positive definite");
+    }
+  
+  return out;
+  }
+
+
+
+//! inverse of each slice of a cube;
+//! if a slice is singular or not positive definite, the corresponding output slice is filled with NaN
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+inv_sympd
+  (
+         Cube<typename T1::elem_type>&       out,
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  out = X.get_ref();
+  
+  const bool status = batch_linalg::inv_sympd(out);
+  
+  if(status == false)
+    {
+    arma_debug_warn_level(3, "inv_sympd(): one or more slices are singular or not positive definite");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup fn_mul_ooc
+//! @{
+
+
+
+//! out-of-core matrix multiplication: C = A*B, where A, B and C are stored in arma_binary files;
+//! mem_limit is the approximate number of bytes used for holding tiles of the matrices
+template<typename obj_type>
+inline
+bool
+mul_ooc(const std::string& C_name, const std::string& A_name, const std::string& B_name, const uword mem_limit = (uword(1) << 30), const typename arma_Mat_Col_Row_only<obj_type>::result* junk = nullptr)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename obj_type::elem_type eT;
+  
+  std::string err_msg;
+  
+  const bool status = gemm_ooc::apply<eT>(C_name, A_name, B_name, mem_limit, err_msg);
+  
+  if(status == false)  { arma_debug_warn_level(3, "mul_ooc(): ", err_msg); }
+  
+  return status;
+  }
+
+
+
+//! @}
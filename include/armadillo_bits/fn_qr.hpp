@@ -142,4 +142,107 @@ qr
 
 
 
+//! update the decomposition A = Q*R (obtained via qr() or qr_econ()) after inserting vector X into A,
+//! as column or row 'index' of A
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+qrinsert
+  (
+         Mat<typename T1::elem_type>&    Q,
+         Mat<typename T1::elem_type>&    R,
+  const uword                            index,
+  const Base<typename T1::elem_type,T1>& X,
+  const char*                            orientation = "col"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_debug_check( (&Q == &R), "qrinsert(): Q and R are the same object" );
+  
+  const char sig = (orientation != nullptr) ? orientation[0] : char(0);
+  
+  arma_debug_check( ((sig != 'c') && (sig != 'r')), "qrinsert(): argument 'orientation' must be \"col\" or \"row\"" );
+  
+  arma_debug_check( ((Q.n_cols != R.n_rows) || (Q.n_cols > Q.n_rows) || ((Q.n_cols < Q.n_rows) && (R.n_rows != R.n_cols))), "qrinsert(): Q and R must be obtained from qr() or qr_econ()" );
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  arma_debug_check( ((U.M.is_vec() == false) && (U.M.is_empty() == false)), "qrinsert(): given object must be a vector" );
+  
+  const Col<eT> x(U.M.memptr(), U.M.n_elem);
+  
+  if(sig == 'c')
+    {
+    arma_debug_check_bounds( (index > R.n_cols), "qrinsert(): index out of bounds" );
+    
+    arma_debug_check( (x.n_elem != Q.n_rows), "qrinsert(): number of elements in X must match number of rows in A" );
+    }
+  else
+    {
+    arma_debug_check_bounds( (index > Q.n_rows), "qrinsert(): index out of bounds" );
+    
+    arma_debug_check( (x.n_elem != R.n_cols), "qrinsert(): number of elements in X must match number of columns in A" );
+    }
+  
+  if(x.internal_has_nonfinite())
+    {
+    arma_debug_warn_level(3, "qrinsert(): given vector has non-finite elements");
+    return false;
+    }
+  
+  if(sig == 'c')
+    {
+    auxlib::qr_insert_col(Q, R, index, x);
+    }
+  else
+    {
+    auxlib::qr_insert_row(Q, R, index, x);
+    }
+  
+  return true;
+  }
+
+
+
+//! update the decomposition A = Q*R (obtained via qr() or qr_econ()) after deleting column or row 'index' of A
+template<typename eT>
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, void >::result
+qrdelete
+  (
+        Mat<eT>& Q,
+        Mat<eT>& R,
+  const uword    index,
+  const char*    orientation = "col"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (&Q == &R), "qrdelete(): Q and R are the same object" );
+  
+  const char sig = (orientation != nullptr) ? orientation[0] : char(0);
+  
+  arma_debug_check( ((sig != 'c') && (sig != 'r')), "qrdelete(): argument 'orientation' must be \"col\" or \"row\"" );
+  
+  arma_debug_check( ((Q.n_cols != R.n_rows) || (Q.n_cols > Q.n_rows) || ((Q.n_cols < Q.n_rows) && (R.n_rows != R.n_cols))), "qrdelete(): Q and R must be obtained from qr() or qr_econ()" );
+  
+  if(sig == 'c')
+    {
+    arma_debug_check_bounds( (index >= R.n_cols), "qrdelete(): index out of bounds" );
+    
+    auxlib::qr_delete_col(Q, R, index);
+    }
+  else
+    {
+    arma_debug_check_bounds( (index >= Q.n_rows), "qrdelete(): index out of bounds" );
+    
+    auxlib::qr_delete_row(Q, R, index);
+    }
+  }
+
+
+
 //! @}
@@ -221,4 +221,339 @@ solve
 
 
 
+//
+// solve_band
+
+
+template<typename eT, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, Mat<eT> >::result
+solve
+  (
+  const band_mat<eT>&       A,
+  const Base<eT,T2>&        B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = A.solve(out, B.get_ref());
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT, typename T2>
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, bool >::result
+solve
+  (
+        Mat<eT>&            out,
+  const band_mat<eT>&       A,
+  const Base<eT,T2>&        B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = A.solve(out, B.get_ref());
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_debug_warn_level(3, "solve(): solution not found");
+    }
+  
+  return status;
+  }
+
+
+
+template<typename eT, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, Mat<eT> >::result
+solve
+  (
+  const band_mat<eT>&       A,
+  const Base<eT,T2>&        B,
+  const solve_opts::opts&   opts
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = A.solve(out, B.get_ref(), opts.flags);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT, typename T2>
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, bool >::result
+solve
+  (
+        Mat<eT>&            out,
+  const band_mat<eT>&       A,
+  const Base<eT,T2>&        B,
+  const solve_opts::opts&   opts
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = A.solve(out, B.get_ref(), opts.flags);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_debug_warn_level(3, "solve(): solution not found");
+    }
+  
+  return status;
+  }
+
+
+
+//
+// solve_packed
+
+
+template<typename eT, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, Mat<eT> >::result
+solve
+  (
+  const symmat_packed<eT>&  A,
+  const Base<eT,T2>&        B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = A.solve(out, B.get_ref());
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT, typename T2>
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, bool >::result
+solve
+  (
+        Mat<eT>&            out,
+  const symmat_packed<eT>&  A,
+  const Base<eT,T2>&        B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = A.solve(out, B.get_ref());
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_debug_warn_level(3, "solve(): solution not found");
+    }
+  
+  return status;
+  }
+
+
+
+template<typename eT, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, Mat<eT> >::result
+solve
+  (
+  const trimat_packed<eT>&  A,
+  const Base<eT,T2>&        B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = A.solve(out, B.get_ref());
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT, typename T2>
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, bool >::result
+solve
+  (
+        Mat<eT>&            out,
+  const trimat_packed<eT>&  A,
+  const Base<eT,T2>&        B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = A.solve(out, B.get_ref());
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_debug_warn_level(3, "solve(): solution not found");
+    }
+  
+  return status;
+  }
+
+
+
+template<typename eT, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, Mat<eT> >::result
+solve
+  (
+  const trimat_packed<eT>&  A,
+  const Base<eT,T2>&        B,
+  const solve_opts::opts&   opts
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out;
+  
+  const bool status = A.solve(out, B.get_ref(), opts.flags);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT, typename T2>
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, bool >::result
+solve
+  (
+        Mat<eT>&            out,
+  const trimat_packed<eT>&  A,
+  const Base<eT,T2>&        B,
+  const solve_opts::opts&   opts
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = A.solve(out, B.get_ref(), opts.flags);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_debug_warn_level(3, "solve(): solution not found");
+    }
+  
+  return status;
+  }
+
+
+
+//
+// solve each slice of a cube
+
+
+
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, Cube<typename T1::elem_type> >::result
+solve
+  (
+  const BaseCube<typename T1::elem_type,T1>& A,
+  const BaseCube<typename T1::elem_type,T2>& B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_cube<T1> UA(A.get_ref());
+  
+  Cube<typename T1::elem_type> out(B.get_ref());
+  
+  const bool status = batch_linalg::solve(out, UA.M);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("solve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+//! if no solution is found for a slice, the corresponding output slice is filled with NaN
+template<typename T1, typename T2>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+solve
+  (
+         Cube<typename T1::elem_type>&       out,
+  const BaseCube<typename T1::elem_type,T1>& A,
+  const BaseCube<typename T1::elem_type,T2>& B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_cube_check<T1> UA(A.get_ref(), out);
+  
+  out = B.get_ref();
+  
+  const bool status = batch_linalg::solve(out, UA.M);
+  
+  if(status == false)
+    {
+    arma_debug_warn_level(3, "solve(): solution not found for one or more slices");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
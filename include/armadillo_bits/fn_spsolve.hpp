@@ -57,15 +57,43 @@ spsolve_helper
   
   arma_debug_check( ( (opts.pivot_thresh < double(0)) || (opts.pivot_thresh > double(1)) ), "spsolve(): pivot_thresh must be in the [0,1] interval" );
   
+  const unwrap_spmat<T1> UA(A.get_ref());
+  
+  bool is_lower = true;
+  
+  // triangular systems are solved directly, unless the LAPACK based solver, equilibration or refinement was explicitly requested
+  
+  if( (sig == 's') && (opts.equilibrate == false) && (opts.refine == superlu_opts::REF_NONE) && sp_trisolve<eT>::is_trimat(UA.M, is_lower) )
+    {
+    arma_extra_debug_print("spsolve(): detected triangular matrix; using forward/backward substitution");
+    
+    const quasi_unwrap<T2> UB(B.get_ref());
+    
+    arma_debug_check( (UA.M.n_rows != UB.M.n_rows), "spsolve(): number of rows in the given objects must be the same" );
+    
+    if(arma_config::check_nonfinite && (UA.M.internal_has_nonfinite() || UB.M.internal_has_nonfinite()))
+      {
+      arma_debug_warn_level(3, "spsolve(): detected non-finite elements");
+      }
+    else
+      {
+      // as with spsolve_simple(), only an exact zero on the diagonal is rejected; no condition number is estimated
+      
+      const sp_trisolve<eT> S(UA.M, is_lower);
+      
+      status = S.solve(out, UB.M);
+      }
+    }
+  else
   if(sig == 's')  // SuperLU solver
     {
     if( (opts.equilibrate == false) && (opts.refine == superlu_opts::REF_NONE) )
       {
-      status = sp_auxlib::spsolve_simple(out, A.get_ref(), B.get_ref(), opts);
+      status = sp_auxlib::spsolve_simple(out, UA.M, B.get_ref(), opts);
       }
     else
       {
-      status = sp_auxlib::spsolve_refine(out, rcond, A.get_ref(), B.get_ref(), opts);
+      status = sp_auxlib::spsolve_refine(out, rcond, UA.M, B.get_ref(), opts);
       }
     }
   else
@@ -82,7 +110,7 @@ spsolve_helper
     
     try
       {
-      Mat<eT> tmp(A.get_ref());  // conversion from sparse to dense can throw std::bad_alloc
+      Mat<eT> tmp(UA.M);  // conversion from sparse to dense can throw std::bad_alloc
       
       AA.steal_mem(tmp);
       
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup fn_symperm
+//! @{
+
+
+
+//! symmetric permutation of X, equivalent to X(p,p)
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+SpMat<typename T1::elem_type>
+symperm(const SpBase<typename T1::elem_type,T1>& X, const Base<uword,T2>& p)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_spmat<T1> UX(X.get_ref());
+  const quasi_unwrap<T2> UP(p.get_ref());
+  
+  arma_debug_check( ((UP.M.is_vec() == false) && (UP.M.is_empty() == false)), "symperm(): given object must be a vector" );
+  
+  const Col<uword> P(const_cast<uword*>(UP.M.memptr()), UP.M.n_elem, false, true);
+  
+  SpMat<eT> out;
+  
+  sp_reorder::symperm(out, UX.M, P);
+  
+  return out;
+  }
+
+
+
+//! @}
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup fn_symrcm
+//! @{
+
+
+
+//! reverse Cuthill-McKee ordering of the symmetric structure of X, for reducing bandwidth
+template<typename T1>
+arma_warn_unused
+inline
+uvec
+symrcm(const SpBase<typename T1::elem_type,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_spmat<T1> U(X.get_ref());
+  
+  uvec out;
+  
+  sp_reorder::rcm(out, U.M, "symrcm()");
+  
+  return out;
+  }
+
+
+
+//! @}
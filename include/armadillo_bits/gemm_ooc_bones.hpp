@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup gemm_ooc
+//! @{
+
+
+
+//! out-of-core multiplication of matrices stored in arma_binary files;
+//! the operands are processed in tiles, with the I/O for the next tile overlapped with the multiplication of the current tile
+class gemm_ooc
+  {
+  public:
+  
+  template<typename eT> inline static bool apply(const std::string& C_name, const std::string& A_name, const std::string& B_name, const uword mem_limit, std::string& err_msg);
+  
+  
+  private:
+  
+  struct tile_step
+    {
+    uword row_start;
+    uword col_start;
+    uword k_start;
+    uword n_rows;
+    uword n_cols;
+    uword n_k;
+    bool  is_first;
+    bool  is_last;
+    };
+  
+  template<typename eT> inline static bool read_header(std::istream& f, uword& n_rows, uword& n_cols, std::streamoff& offset);
+  
+  template<typename eT> inline static bool read_tile(Mat<eT>& X, std::istream& f, const std::streamoff offset, const uword f_n_rows, const uword row_start, const uword col_start, const uword n_rows, const uword n_cols);
+  
+  template<typename eT> inline static bool write_tile(std::ostream& f, const std::streamoff offset, const uword f_n_rows, const uword row_start, const uword col_start, const Mat<eT>& X);
+  };
+
+
+
+//! @}
@@ -0,0 +1,339 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup gemm_ooc
+//! @{
+
+
+
+//! C = A*B, where A, B and C are matrices stored in arma_binary files;
+//! mem_limit is the approximate number of bytes used for tiles
+template<typename eT>
+inline
+bool
+gemm_ooc::apply(const std::string& C_name, const std::string& A_name, const std::string& B_name, const uword mem_limit, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream fA(A_name, std::fstream::binary);
+  std::ifstream fB(B_name, std::fstream::binary);
+  
+  if(fA.is_open() == false)  { err_msg = "couldn't open file: " + A_name; return false; }
+  if(fB.is_open() == false)  { err_msg = "couldn't open file: " + B_name; return false; }
+  
+  uword A_n_rows = 0;
+  uword A_n_cols = 0;
+  uword B_n_rows = 0;
+  uword B_n_cols = 0;
+  
+  std::streamoff A_offset = 0;
+  std::streamoff B_offset = 0;
+  
+  if(gemm_ooc::read_header<eT>(fA, A_n_rows, A_n_cols, A_offset) == false)  { err_msg = "incorrect header in file: " + A_name; return false; }
+  if(gemm_ooc::read_header<eT>(fB, B_n_rows, B_n_cols, B_offset) == false)  { err_msg = "incorrect header in file: " + B_name; return false; }
+  
+  if(A_n_cols != B_n_rows)  { err_msg = arma_incompat_size_string(A_n_rows, A_n_cols, B_n_rows, B_n_cols, "matrix multiplication"); return false; }
+  
+  const uword M = A_n_rows;
+  const uword K = A_n_cols;
+  const uword N = B_n_cols;
+  
+  const std::string tmp_name = diskio::gen_tmp_name(C_name);
+  
+  std::ofstream fC(tmp_name, std::fstream::binary);
+  
+  if(fC.is_open() == false)  { err_msg = "couldn't create file: " + tmp_name; return false; }
+  
+  fC << diskio::gen_bin_header(Mat<eT>()) << '\n';
+  fC << M << ' ' << N << '\n';
+  
+  const std::streamoff C_offset = std::streamoff(fC.tellp());
+  
+  // extend the file to its final size, so that the tiles of C can be written in any order
+  
+  if( (M > 0) && (N > 0) )
+    {
+    fC.seekp( C_offset + std::streamoff(M) * std::streamoff(N) * std::streamoff(sizeof(eT)) - 1 );
+    fC.put(char(0));
+    }
+  
+  // six tiles are resident: two of A and two of B (current and next), the accumulated tile of C, and the finished tile of C being written
+  
+  const uword tile_size = (std::max)( uword(1), uword( std::sqrt( double(mem_limit) / double(6 * sizeof(eT)) ) ) );
+  
+  std::vector<tile_step> steps;
+  
+  for(uword col_start=0; col_start < N; col_start += tile_size)
+  for(uword row_start=0; row_start < M; row_start += tile_size)
+    {
+    tile_step step;
+    
+    step.row_start = row_start;
+    step.col_start = col_start;
+    step.n_rows    = (std::min)(tile_size, M - row_start);
+    step.n_cols    = (std::min)(tile_size, N - col_start);
+    
+    if(K == 0)
+      {
+      step.k_start  = 0;
+      step.n_k      = 0;
+      step.is_first = true;
+      step.is_last  = true;
+      
+      steps.push_back(step);
+      }
+    
+    for(uword k_start=0; k_start < K; k_start += tile_size)
+      {
+      step.k_start  = k_start;
+      step.n_k      = (std::min)(tile_size, K - k_start);
+      step.is_first = (k_start == 0);
+      step.is_last  = ((k_start + step.n_k) == K);
+      
+      steps.push_back(step);
+      }
+    }
+  
+  const uword n_steps = uword(steps.size());
+  
+  Mat<eT> A_tile[2];
+  Mat<eT> B_tile[2];
+  Mat<eT> C_acc;
+  Mat<eT> C_done;
+  
+  bool        io_okay = fC.good();
+  std::string io_msg;
+  
+  // load the tiles for step s_load (if any), and write C_done as the result of step s_done (if any)
+  
+  const auto io_task = [&](const uword s_load, const uword s_done)
+    {
+    try
+      {
+      if(s_done < n_steps)
+        {
+        const tile_step& step = steps[s_done];
+        
+        if(gemm_ooc::write_tile(fC, C_offset, M, step.row_start, step.col_start, C_done) == false)  { io_okay = false; io_msg = "couldn't write file: " + tmp_name; return; }
+        }
+      
+      if( (s_load < n_steps) && (steps[s_load].n_k > 0) )
+        {
+        const tile_step& step = steps[s_load];
+        
+        Mat<eT>& A_next = A_tile[s_load % 2];
+        Mat<eT>& B_next = B_tile[s_load % 2];
+        
+        if(gemm_ooc::read_tile(A_next, fA, A_offset, M, step.row_start, step.k_start,   step.n_rows, step.n_k   ) == false)  { io_okay = false; io_msg = "couldn't read file: " + A_name; return; }
+        if(gemm_ooc::read_tile(B_next, fB, B_offset, K, step.k_start,   step.col_start, step.n_k,    step.n_cols) == false)  { io_okay = false; io_msg = "couldn't read file: " + B_name; return; }
+        }
+      }
+    catch(...)
+      {
+      io_okay = false;
+      io_msg  = "not enough memory";
+      }
+    };
+  
+  if(n_steps > 0)  { io_task(0, n_steps); }
+  
+  #if !defined(ARMA_DONT_USE_STD_THREAD)
+    std::thread io_thread;
+  #endif
+  
+  // the I/O thread refers to local objects, so it must be joined before an exception (eg. from gemm or set_size) leaves this function
+  
+  try
+    {
+    for(uword s=0; s < n_steps; ++s)
+      {
+      #if !defined(ARMA_DONT_USE_STD_THREAD)
+        if(io_thread.joinable())  { io_thread.join(); }
+      #endif
+      
+      if(io_okay == false)  { break; }
+      
+      // the previous I/O task has finished, so the tile of C finished in the previous step can be handed over
+      
+      const bool have_done = (s > 0) && steps[s-1].is_last;
+      
+      if(have_done)  { C_done.swap(C_acc); }
+      
+      const uword s_done = (have_done) ? (s-1) : n_steps;
+      
+      #if !defined(ARMA_DONT_USE_STD_THREAD)
+        {
+        io_thread = std::thread(io_task, s+1, s_done);
+        }
+      #else
+        {
+        io_task(s+1, s_done);
+        }
+      #endif
+      
+      const tile_step& step = steps[s];
+      
+      if(step.n_k == 0)
+        {
+        C_acc.zeros(step.n_rows, step.n_cols);
+        }
+      else
+      if(step.is_first)
+        {
+        C_acc.set_size(step.n_rows, step.n_cols);
+        
+        gemm<false,false,false,false>::apply(C_acc, A_tile[s % 2], B_tile[s % 2]);
+        }
+      else
+        {
+        gemm<false,false,false,true>::apply(C_acc, A_tile[s % 2], B_tile[s % 2], eT(1), eT(1));
+        }
+      }
+    }
+  catch(...)
+    {
+    #if !defined(ARMA_DONT_USE_STD_THREAD)
+      if(io_thread.joinable())  { io_thread.join(); }
+    #endif
+    
+    fC.close();
+    
+    std::remove(tmp_name.c_str());
+    
+    throw;
+    }
+  
+  #if !defined(ARMA_DONT_USE_STD_THREAD)
+    if(io_thread.joinable())  { io_thread.join(); }
+  #endif
+  
+  if( io_okay && (n_steps > 0) )
+    {
+    const tile_step& step = steps[n_steps-1];
+    
+    io_okay = gemm_ooc::write_tile(fC, C_offset, M, step.row_start, step.col_start, C_acc);
+    
+    if(io_okay == false)  { io_msg = "couldn't write file: " + tmp_name; }
+    }
+  
+  fC.flush();
+  
+  io_okay = io_okay && fC.good();
+  
+  fC.close();
+  
+  if(io_okay)  { io_okay = diskio::safe_rename(tmp_name, C_name); }
+  
+  if(io_okay == false)
+    {
+    std::remove(tmp_name.c_str());
+    
+    err_msg = (io_msg.empty()) ? std::string("couldn't write file: ") + C_name : io_msg;
+    }
+  
+  return io_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+gemm_ooc::read_header(std::istream& f, uword& n_rows, uword& n_cols, std::streamoff& offset)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string f_header;
+  
+  f >> f_header;
+  f >> n_rows;
+  f >> n_cols;
+  
+  if( (f.good() == false) || (f_header != diskio::gen_bin_header(Mat<eT>())) )  { return false; }
+  
+  f.get();
+  
+  offset = std::streamoff(f.tellg());
+  
+  return f.good();
+  }
+
+
+
+//! X = tile of the matrix stored column by column in file f, where the matrix has f_n_rows rows and its elements start at the given offset
+template<typename eT>
+inline
+bool
+gemm_ooc::read_tile(Mat<eT>& X, std::istream& f, const std::streamoff offset, const uword f_n_rows, const uword row_start, const uword col_start, const uword n_rows, const uword n_cols)
+  {
+  arma_extra_debug_sigprint();
+  
+  X.set_size(n_rows, n_cols);
+  
+  const std::streamoff elem_size = std::streamoff(sizeof(eT));
+  
+  if(n_rows == f_n_rows)
+    {
+    // the tile is a contiguous block of columns
+    
+    f.seekg( offset + std::streamoff(col_start) * std::streamoff(f_n_rows) * elem_size );
+    f.read( reinterpret_cast<char*>(X.memptr()), std::streamsize(X.n_elem) * std::streamsize(sizeof(eT)) );
+    
+    return f.good();
+    }
+  
+  for(uword col=0; col < n_cols; ++col)
+    {
+    f.seekg( offset + ( std::streamoff(col_start + col) * std::streamoff(f_n_rows) + std::streamoff(row_start) ) * elem_size );
+    f.read( reinterpret_cast<char*>(X.colptr(col)), std::streamsize(n_rows) * std::streamsize(sizeof(eT)) );
+    }
+  
+  return f.good();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+gemm_ooc::write_tile(std::ostream& f, const std::streamoff offset, const uword f_n_rows, const uword row_start, const uword col_start, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::streamoff elem_size = std::streamoff(sizeof(eT));
+  
+  if(X.n_rows == f_n_rows)
+    {
+    f.seekp( offset + std::streamoff(col_start) * std::streamoff(f_n_rows) * elem_size );
+    f.write( reinterpret_cast<const char*>(X.memptr()), std::streamsize(X.n_elem) * std::streamsize(sizeof(eT)) );
+    
+    return f.good();
+    }
+  
+  for(uword col=0; col < X.n_cols; ++col)
+    {
+    f.seekp( offset + ( std::streamoff(col_start + col) * std::streamoff(f_n_rows) + std::streamoff(row_start) ) * elem_size );
+    f.write( reinterpret_cast<const char*>(X.colptr(col)), std::streamsize(X.n_rows) * std::streamsize(sizeof(eT)) );
+    }
+  
+  return f.good();
+  }
+
+
+
+//! @}
@@ -54,16 +54,20 @@ glue_cor::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_cor>& X)
     return;
     }
   
-  const uword N        = AA.n_rows;
-  const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  // evaluate the standard deviations first, as out may be an alias of A or B
   
-  const Mat<eT> tmp1 = AA.each_row() - mean(AA,0);
-  const Mat<eT> tmp2 = BB.each_row() - mean(BB,0);
+  const Mat<eT> s = conv_to< Mat<eT> >::from( stddev(AA).t() * stddev(BB) );
   
-  out = tmp1.t() * tmp2;
-  out /= norm_val;
+  if(&A == &B)
+    {
+    op_cov::apply_direct(out, AA, AA, false, norm_type);
+    }
+  else
+    {
+    op_cov::apply_direct(out, AA, BB, false, norm_type);
+    }
   
-  out /= conv_to< Mat<eT> >::from( stddev(AA).t() * stddev(BB) );  // TODO: check for zeros?
+  out /= s;  // TODO: check for zeros?
   }
 
 
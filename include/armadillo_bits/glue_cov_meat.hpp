@@ -54,14 +54,16 @@ glue_cov::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_cov>& X)
     return;
     }
   
-  const uword N        = AA.n_rows;
-  const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  // the symmetric case is only taken when A and B refer to the same object, eg. cov(X,X)
   
-  const Mat<eT> tmp1 = AA.each_row() - mean(AA,0);
-  const Mat<eT> tmp2 = BB.each_row() - mean(BB,0);
-  
-  out = tmp1.t() * tmp2;
-  out /= norm_val;
+  if(&A == &B)
+    {
+    op_cov::apply_direct(out, AA, AA, false, norm_type);
+    }
+  else
+    {
+    op_cov::apply_direct(out, AA, BB, false, norm_type);
+    }
   }
 
 
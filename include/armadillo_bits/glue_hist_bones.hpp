@@ -20,13 +20,41 @@
 //! @{
 
 
+//! locates the nearest bin center;
+//! for uniformly spaced centers the bin index is directly computed, otherwise binary search is used
+template<typename eT>
+struct glue_hist_locator
+  {
+  const eT*   C_mem;
+  const uword n_bins;
+  
+  bool C_is_uniform;
+  eT   C_0;
+  eT   C_inv_delta;
+  
+  inline glue_hist_locator(const Mat<eT>& C);
+  
+  arma_inline bool get_index(uword& index, const eT val) const;
+  };
+
+
+
 class glue_hist
   : public traits_glue_default
   {
   public:
   
+  template<typename eT>
+  inline static bool is_uniform(const eT* C_mem, const uword C_n_elem);
+  
+  template<typename out_eT, typename eT, typename locator_type>
+  inline static void count(out_eT* out_mem, const uword out_stride, const eT* X_mem, const uword X_stride, const eT* W_mem, const uword N, const locator_type& locator);
+  
   template<typename eT>
   inline static void apply_noalias(Mat<uword>& out, const Mat<eT>& X, const Mat<eT>& C, const uword dim);
+  
+  template<typename eT>
+  inline static void apply_weighted_noalias(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& C, const Mat<eT>& W);
 
   template<typename T1, typename T2>
   inline static void apply(Mat<uword>& out, const mtGlue<uword,T1,T2,glue_hist>& expr);
@@ -20,6 +20,194 @@
 //! @{
 
 
+template<typename eT>
+inline
+glue_hist_locator<eT>::glue_hist_locator(const Mat<eT>& C)
+  : C_mem       (C.memptr())
+  , n_bins      (C.n_elem   )
+  , C_is_uniform(false      )
+  , C_0         (eT(0)      )
+  , C_inv_delta (eT(0)      )
+  {
+  arma_extra_debug_sigprint();
+  
+  C_is_uniform = glue_hist::is_uniform(C_mem, n_bins);
+  
+  if(C_is_uniform)
+    {
+    C_0         = C_mem[0];
+    C_inv_delta = eT(n_bins-1) / (C_mem[n_bins-1] - C_mem[0]);
+    }
+  }
+
+
+
+template<typename eT>
+arma_inline
+bool
+glue_hist_locator<eT>::get_index(uword& index, const eT val) const
+  {
+  if(arma_isfinite(val) == false)
+    {
+    if(val < eT(0))  { index = 0;          return true; }  // -inf
+    if(val > eT(0))  { index = n_bins - 1; return true; }  // +inf
+    
+    return false;  // ignore NaN
+    }
+  
+  uword j = 0;
+  
+  if(C_is_uniform)
+    {
+    const eT pos = (val - C_0) * C_inv_delta;
+    
+    j = (pos > eT(0)) ? ( (pos < eT(n_bins-1)) ? uword(pos) : uword(n_bins-1) ) : uword(0);
+    }
+  else
+    {
+    j = uword( std::lower_bound(C_mem, C_mem + n_bins, val) - C_mem );
+    
+    j = (std::min)(j, uword(n_bins-1));
+    }
+  
+  // refine the position to the nearest center;
+  // in case of a tie, the center with the lower index is used
+  
+  while(j > 0)
+    {
+    const eT center_a = C_mem[j-1];
+    const eT center_b = C_mem[j  ];
+    
+    const eT dist_a = (center_a >= val) ? (center_a - val) : (val - center_a);
+    const eT dist_b = (center_b >= val) ? (center_b - val) : (val - center_b);
+    
+    if(dist_a <= dist_b)  { --j; }  else  { break; }
+    }
+  
+  while( (j+1) < n_bins )
+    {
+    const eT center_a = C_mem[j  ];
+    const eT center_b = C_mem[j+1];
+    
+    const eT dist_a = (center_a >= val) ? (center_a - val) : (val - center_a);
+    const eT dist_b = (center_b >= val) ? (center_b - val) : (val - center_b);
+    
+    if(dist_b < dist_a)  { ++j; }  else  { break; }
+    }
+  
+  index = j;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+glue_hist::is_uniform(const eT* C_mem, const uword C_n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  // C_mem is assumed to be sorted in strictly ascending manner;
+  // the spacing only needs to be approximately uniform,
+  // as the bin index computed from the spacing is subsequently refined
+  
+  if( (is_non_integral<eT>::value == false) || (C_n_elem < 2) )  { return false; }
+  
+  const eT C_first = C_mem[0         ];
+  const eT C_last  = C_mem[C_n_elem-1];
+  
+  if( (arma_isfinite(C_first) == false) || (arma_isfinite(C_last) == false) )  { return false; }
+  
+  const eT delta = (C_last - C_first) / eT(C_n_elem-1);
+  
+  if( ((delta > eT(0)) && arma_isfinite(delta)) == false )  { return false; }
+  
+  const eT tol = eT(0.01) * delta;
+  
+  for(uword i=1; i < (C_n_elem-1); ++i)
+    {
+    const eT err = C_mem[i] - (C_first + eT(i)*delta);
+    
+    if( (eop_aux::arma_abs(err) <= tol) == false )  { return false; }
+    }
+  
+  return true;
+  }
+
+
+
+//! counts (or accumulates weights of) the elements in each bin;
+//! the elements and bins are accessed with the given strides, allowing rows to be processed without copying;
+//! for large inputs each thread uses a private histogram, with all histograms merged at the end
+template<typename out_eT, typename eT, typename locator_type>
+inline
+void
+glue_hist::count(out_eT* out_mem, const uword out_stride, const eT* X_mem, const uword X_stride, const eT* W_mem, const uword N, const locator_type& locator)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_bins = locator.n_bins;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( mp_gate<eT>::eval(N) && (N >= (n_bins * uword(8))) )
+      {
+      const int   n_threads_max = mp_thread_limit::get();
+      const uword n_threads_use = (std::min)(uword(podarray_prealloc_n_elem::val), uword(n_threads_max));
+      const uword chunk_size    = N / n_threads_use;
+      
+      Mat<out_eT> partial_hists(n_bins, n_threads_use, arma_zeros_indicator());
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = (thread_id+0) * chunk_size;
+        const uword endp1 = (thread_id+1 == n_threads_use) ? N : ((thread_id+1) * chunk_size);
+        
+        out_eT* hist_mem = partial_hists.colptr(thread_id);
+        
+        uword index = 0;
+        
+        for(uword i=start; i < endp1; ++i)
+          {
+          if(locator.get_index(index, X_mem[i*X_stride]))  { hist_mem[index] += (W_mem != nullptr) ? out_eT(W_mem[i]) : out_eT(1); }
+          }
+        }
+      
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const out_eT* hist_mem = partial_hists.colptr(thread_id);
+        
+        for(uword j=0; j < n_bins; ++j)  { out_mem[j*out_stride] += hist_mem[j]; }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  uword index = 0;
+  
+  if(W_mem == nullptr)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      if(locator.get_index(index, X_mem[i*X_stride]))  { out_mem[index*out_stride]++; }
+      }
+    }
+  else
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      if(locator.get_index(index, X_mem[i*X_stride]))  { out_mem[index*out_stride] += out_eT(W_mem[i]); }
+      }
+    }
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -42,8 +230,7 @@ glue_hist::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const Mat<eT>& C, co
     "hist(): given 'centers' vector does not contain monotonically increasing values"
     );
   
-  const eT* C_mem    = C.memptr();
-  const eT  center_0 = C_mem[0];
+  const glue_hist_locator<eT> locator(C);
   
   if(dim == 0)
     {
@@ -51,47 +238,7 @@ glue_hist::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const Mat<eT>& C, co
     
     for(uword col=0; col < X_n_cols; ++col)
       {
-      const eT*    X_coldata   = X.colptr(col);
-            uword* out_coldata = out.colptr(col);
-      
-      for(uword row=0; row < X_n_rows; ++row)
-        {
-        const eT val = X_coldata[row];
-        
-        if(arma_isfinite(val))
-          {
-          eT    opt_dist  = (center_0 >= val) ? (center_0 - val) : (val - center_0);
-          uword opt_index = 0;
-          
-          for(uword j=1; j < C_n_elem; ++j)
-            {
-            const eT center = C_mem[j];
-            const eT dist   = (center >= val) ? (center - val) : (val - center);
-            
-            if(dist < opt_dist)
-              {
-              opt_dist  = dist;
-              opt_index = j;
-              }
-            else
-              {
-              break;
-              }
-            }
-          
-          out_coldata[opt_index]++;
-          }
-        else
-          {
-          // -inf
-          if(val < eT(0)) { out_coldata[0]++; }
-          
-          // +inf
-          if(val > eT(0)) { out_coldata[C_n_elem-1]++; }
-          
-          // ignore NaN
-          }
-        }
+      glue_hist::count(out.colptr(col), uword(1), X.colptr(col), uword(1), (const eT*)nullptr, X_n_rows, locator);
       }
     }
   else
@@ -99,100 +246,46 @@ glue_hist::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const Mat<eT>& C, co
     {
     out.zeros(X_n_rows, C_n_elem);
     
-    if(X_n_rows == 1)
+    for(uword row=0; row < X_n_rows; ++row)
       {
-      const uword  X_n_elem = X.n_elem;
-      const eT*    X_mem    = X.memptr();
-            uword* out_mem  = out.memptr();
-      
-      for(uword i=0; i < X_n_elem; ++i)
-        {
-        const eT val = X_mem[i];
-        
-        if(is_finite(val))
-          {
-          eT    opt_dist  = (val >= center_0) ? (val - center_0) : (center_0 - val);
-          uword opt_index = 0;
-          
-          for(uword j=1; j < C_n_elem; ++j)
-            {
-            const eT center = C_mem[j];
-            const eT dist   = (val >= center) ? (val - center) : (center - val);
-            
-            if(dist < opt_dist)
-              {
-              opt_dist  = dist;
-              opt_index = j;
-              }
-            else
-              {
-              break;
-              }
-            }
-          
-          out_mem[opt_index]++;
-          }
-        else
-          {
-          // -inf
-          if(val < eT(0)) { out_mem[0]++; }
-          
-          // +inf
-          if(val > eT(0)) { out_mem[C_n_elem-1]++; }
-          
-          // ignore NaN
-          }
-        }
-      }
-    else
-      {
-      for(uword row=0; row < X_n_rows; ++row)
-        {
-        for(uword col=0; col < X_n_cols; ++col)
-          {
-          const eT val = X.at(row,col);
-          
-          if(arma_isfinite(val))
-            {
-            eT    opt_dist  = (center_0 >= val) ? (center_0 - val) : (val - center_0);
-            uword opt_index = 0;
-            
-            for(uword j=1; j < C_n_elem; ++j)
-              {
-              const eT center = C_mem[j];
-              const eT dist   = (center >= val) ? (center - val) : (val - center);
-              
-              if(dist < opt_dist)
-                {
-                opt_dist  = dist;
-                opt_index = j;
-                }
-              else
-                {
-                break;
-                }
-              }
-            
-            out.at(row,opt_index)++;
-            }
-          else
-            {
-            // -inf
-            if(val < eT(0)) { out.at(row,0)++; }
-            
-            // +inf
-            if(val > eT(0)) { out.at(row,C_n_elem-1)++; }
-            
-            // ignore NaN
-            }
-          }
-        }
+      glue_hist::count(out.memptr() + row, X_n_rows, X.memptr() + row, X_n_rows, (const eT*)nullptr, X_n_cols, locator);
       }
     }
   }
 
 
 
+template<typename eT>
+inline
+void
+glue_hist::apply_weighted_noalias(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& C, const Mat<eT>& W)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( ((X.is_vec() == false) && (X.is_empty() == false)), "hist_weighted(): given object must be a vector" );
+  arma_debug_check( ((C.is_vec() == false) && (C.is_empty() == false)), "hist_weighted(): parameter 'centers' must be a vector" );
+  
+  arma_debug_check( (X.n_elem != W.n_elem), "hist_weighted(): number of weights must match the number of elements" );
+  
+  const uword C_n_elem = C.n_elem;
+  
+  if( C_n_elem == 0 )  { out.reset(); return; }
+  
+  arma_debug_check
+    (
+    ((Col<eT>(const_cast<eT*>(C.memptr()), C_n_elem, false, false)).is_sorted("strictascend") == false),
+    "hist_weighted(): given 'centers' vector does not contain monotonically increasing values"
+    );
+  
+  const glue_hist_locator<eT> locator(C);
+  
+  if(X.is_rowvec())  { out.zeros(1, C_n_elem); }  else  { out.zeros(C_n_elem, 1); }
+  
+  glue_hist::count(out.memptr(), uword(1), X.memptr(), uword(1), W.memptr(), X.n_elem, locator);
+  }
+
+
+
 template<typename T1, typename T2>
 inline
 void
@@ -20,6 +20,26 @@
 //! @{
 
 
+//! locates the bin in which a value falls, ie. edge[i] <= val < edge[i+1];
+//! for uniformly spaced edges the bin index is directly computed, otherwise binary search is used
+template<typename eT>
+struct glue_histc_locator
+  {
+  const eT*   B_mem;
+  const uword n_bins;
+  
+  bool B_is_uniform;
+  eT   B_0;
+  eT   B_last;
+  eT   B_inv_delta;
+  
+  inline glue_histc_locator(const Mat<eT>& B);
+  
+  arma_inline bool get_index(uword& index, const eT val) const;
+  };
+
+
+
 class glue_histc
   : public traits_glue_default
   {
@@ -20,6 +20,71 @@
 //! @{
 
 
+template<typename eT>
+inline
+glue_histc_locator<eT>::glue_histc_locator(const Mat<eT>& B)
+  : B_mem       (B.memptr())
+  , n_bins      (B.n_elem   )
+  , B_is_uniform(false      )
+  , B_0         (eT(0)      )
+  , B_last      (eT(0)      )
+  , B_inv_delta (eT(0)      )
+  {
+  arma_extra_debug_sigprint();
+  
+  if(n_bins == 0)  { return; }
+  
+  B_0    = B_mem[0       ];
+  B_last = B_mem[n_bins-1];
+  
+  B_is_uniform = glue_hist::is_uniform(B_mem, n_bins);
+  
+  if(B_is_uniform)  { B_inv_delta = eT(n_bins-1) / (B_last - B_0); }
+  }
+
+
+
+template<typename eT>
+arma_inline
+bool
+glue_histc_locator<eT>::get_index(uword& index, const eT val) const
+  {
+  // NOTE: the last bin counts values that match the last edge (for compatibility with Matlab);
+  // NOTE: values outside of the edges (and NaN) are ignored
+  
+  if(n_bins < 2)  { return false; }
+  
+  if( (B_0 <= val) && (val < B_last) )
+    {
+    uword i = 0;
+    
+    if(B_is_uniform)
+      {
+      const eT pos = (val - B_0) * B_inv_delta;
+      
+      i = (pos > eT(0)) ? ( (pos < eT(n_bins-2)) ? uword(pos) : uword(n_bins-2) ) : uword(0);
+      
+      while( (i > 0) && (val < B_mem[i]) )  { --i; }
+      
+      while( ((i+2) < n_bins) && (val >= B_mem[i+1]) )  { ++i; }
+      }
+    else
+      {
+      i = uword( std::upper_bound(B_mem, B_mem + n_bins, val) - B_mem ) - 1;
+      }
+    
+    index = i;
+    
+    return true;
+    }
+  
+  if(val == B_last)  { index = n_bins-1; return true; }
+  
+  return false;
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -42,8 +107,7 @@ glue_histc::apply_noalias(Mat<uword>& C, const Mat<eT>& A, const Mat<eT>& B, con
     "hist(): given 'edges' vector does not contain monotonically increasing values"
     );
   
-  const eT*   B_mem       = B.memptr();
-  const uword B_n_elem_m1 = B_n_elem - 1;
+  const glue_histc_locator<eT> locator(B);
   
   if(dim == uword(0))
     {
@@ -51,19 +115,7 @@ glue_histc::apply_noalias(Mat<uword>& C, const Mat<eT>& A, const Mat<eT>& B, con
     
     for(uword col=0; col < A_n_cols; ++col)
       {
-      const eT*    A_coldata = A.colptr(col);
-            uword* C_coldata = C.colptr(col);
-      
-      for(uword row=0; row < A_n_rows; ++row)
-        {
-        const eT x = A_coldata[row];
-        
-        for(uword i=0; i < B_n_elem_m1; ++i)
-          {
-               if( (B_mem[i]           <= x) && (x < B_mem[i+1]) )  { C_coldata[i]++;           break; }
-          else if(  B_mem[B_n_elem_m1] == x                      )  { C_coldata[B_n_elem_m1]++; break; }    // for compatibility with Matlab
-          }
-        }
+      glue_hist::count(C.colptr(col), uword(1), A.colptr(col), uword(1), (const eT*)nullptr, A_n_rows, locator);
       }
     }
   else
@@ -71,36 +123,9 @@ glue_histc::apply_noalias(Mat<uword>& C, const Mat<eT>& A, const Mat<eT>& B, con
     {
     C.zeros(A_n_rows, B_n_elem);
     
-    if(A.n_rows == 1)
-      {
-      const uword  A_n_elem = A.n_elem;
-      const eT*    A_mem    = A.memptr();
-            uword* C_mem    = C.memptr();
-      
-      for(uword j=0; j < A_n_elem; ++j)
-        {
-        const eT x = A_mem[j];
-        
-        for(uword i=0; i < B_n_elem_m1; ++i)
-          {
-               if( (B_mem[i]           <= x) && (x < B_mem[i+1]) )  { C_mem[i]++;           break; }
-          else if(  B_mem[B_n_elem_m1] == x                      )  { C_mem[B_n_elem_m1]++; break; }    // for compatibility with Matlab
-          }
-        }
-      }
-    else
+    for(uword row=0; row < A_n_rows; ++row)
       {
-      for(uword row=0; row < A_n_rows; ++row)
-      for(uword col=0; col < A_n_cols; ++col)
-        {
-        const eT x = A.at(row,col);
-        
-        for(uword i=0; i < B_n_elem_m1; ++i)
-          {
-               if( (B_mem[i]            <= x) && (x < B_mem[i+1]) )  { C.at(row,i)++;           break; }
-          else if(  B_mem[B_n_elem_m1]  == x                      )  { C.at(row,B_n_elem_m1)++; break; }   // for compatibility with Matlab
-          }
-        }
+      glue_hist::count(C.memptr() + row, A_n_rows, A.memptr() + row, A_n_rows, (const eT*)nullptr, A_n_cols, locator);
       }
     }
   }
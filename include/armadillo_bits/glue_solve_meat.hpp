@@ -99,6 +99,7 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
   const bool refine       = has_user_flags && bool(flags & solve_opts::flag_refine      );
   const bool no_trimat    = has_user_flags && bool(flags & solve_opts::flag_no_trimat   );
   const bool force_approx = has_user_flags && bool(flags & solve_opts::flag_force_approx);
+  const bool mixed        = has_user_flags && bool(flags & solve_opts::flag_mixed       );
   
   if(has_user_flags)
     {
@@ -114,10 +115,34 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     if(refine      )  { arma_extra_debug_print("refine");       }
     if(no_trimat   )  { arma_extra_debug_print("no_trimat");    }
     if(force_approx)  { arma_extra_debug_print("force_approx"); }
+    if(mixed       )  { arma_extra_debug_print("mixed");        }
     
     arma_debug_check( (fast     && equilibrate ), "solve(): options 'fast' and 'equilibrate' are mutually exclusive"      );
     arma_debug_check( (fast     && refine      ), "solve(): options 'fast' and 'refine' are mutually exclusive"           );
     arma_debug_check( (no_sympd && likely_sympd), "solve(): options 'no_sympd' and 'likely_sympd' are mutually exclusive" );
+    arma_debug_check( (fast     && mixed       ), "solve(): options 'fast' and 'mixed' are mutually exclusive"            );
+    arma_debug_check( (mixed    && equilibrate ), "solve(): options 'mixed' and 'equilibrate' are mutually exclusive"     );
+    arma_debug_check( (mixed    && refine      ), "solve(): options 'mixed' and 'refine' are mutually exclusive"          );
+    }
+  
+  if(mixed && (is_Mat<T2>::value == false))
+    {
+    // B is used by the mixed precision solver and possibly again by the full precision fallback, so evaluate it only once
+    
+    const quasi_unwrap<T2> UB( B_expr.get_ref() );
+    
+    if(UB.is_alias(actual_out))
+      {
+      Mat<eT> tmp;
+      
+      const bool status = glue_solve_gen_full::apply<eT, T1, Mat<eT>, has_user_flags>(tmp, A_expr, UB.M, flags);
+      
+      actual_out.steal_mem(tmp);
+      
+      return status;
+      }
+    
+    return glue_solve_gen_full::apply<eT, T1, Mat<eT>, has_user_flags>(actual_out, A_expr, UB.M, flags);
     }
   
   Mat<eT> A = A_expr.get_ref();
@@ -132,6 +157,7 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     if(equilibrate)   { arma_debug_warn_level(2,  "solve(): option 'equilibrate' ignored for forced approximate solution"  ); }
     if(refine)        { arma_debug_warn_level(2,  "solve(): option 'refine' ignored for forced approximate solution"       ); }
     if(likely_sympd)  { arma_debug_warn_level(2,  "solve(): option 'likely_sympd' ignored for forced approximate solution" ); }
+    if(mixed)         { arma_debug_warn_level(2,  "solve(): option 'mixed' ignored for forced approximate solution"        ); }
     
     return auxlib::solve_approx_svd(actual_out, A, B_expr.get_ref());  // A is overwritten
     }
@@ -162,13 +188,49 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     uword KL = 0;
     uword KU = 0;
     
-    const bool is_band  = arma_config::optimise_band && ((no_band || auxlib::crippled_lapack(A)) ? false : band_helper::is_band(KL, KU, A, uword(32)));
+    // a structure hint set by the user is carried over from A_expr when it is a Mat, and replaces the detection scans
+    
+    const struct_hint hint = A.get_hint(KL, KU);
+    
+    const bool has_hint   = (hint != struct_hint::none);
+    const bool hint_band  = (hint == struct_hint::band);
+    const bool hint_sympd = (hint == struct_hint::sympd);
+    const bool hint_triu  = (hint == struct_hint::triu) || (hint_band && (KL == 0));
+    const bool hint_tril  = (hint == struct_hint::tril) || (hint_band && (KU == 0));
+    const bool hint_other = has_hint && (hint != struct_hint::sym);  // structure known not to be banded
+    
+    const bool is_band  = arma_config::optimise_band && ((no_band || auxlib::crippled_lapack(A)) ? false : (hint_band || ((hint_other == false) && band_helper::is_band(KL, KU, A, uword(32)))));
     
-    const bool is_triu = (no_trimat || refine || equilibrate || likely_sympd || is_band           ) ? false : trimat_helper::is_triu(A);
-    const bool is_tril = (no_trimat || refine || equilibrate || likely_sympd || is_band || is_triu) ? false : trimat_helper::is_tril(A);
+    const bool is_triu = (no_trimat || refine || equilibrate || likely_sympd || is_band           ) ? false : (has_hint ? hint_triu : trimat_helper::is_triu(A));
+    const bool is_tril = (no_trimat || refine || equilibrate || likely_sympd || is_band || is_triu) ? false : (has_hint ? hint_tril : trimat_helper::is_tril(A));
     
-    const bool try_sympd = arma_config::optimise_sym && ((no_sympd || auxlib::crippled_lapack(A) || is_band || is_triu || is_tril) ? false : (likely_sympd ? true : sym_helper::guess_sympd(A, uword(16))));
+    const bool try_sympd = arma_config::optimise_sym && ((no_sympd || auxlib::crippled_lapack(A) || is_band || is_triu || is_tril) ? false : ((likely_sympd || hint_sympd) ? true : sym_helper::guess_sympd(A, uword(16))));
     
+    // mixed precision is only worthwhile for dense systems stored in double precision
+    
+    const bool try_mixed = mixed && is_double<T>::value && (is_band == false) && (is_triu == false) && (is_tril == false);
+    
+    bool mixed_status = false;
+    
+    if(try_mixed)
+      {
+      arma_extra_debug_print("glue_solve_gen_full::apply(): mixed precision mode");
+      
+      mixed_status = auxlib::solve_square_mixed(out, rcond, A, B_expr.get_ref(), try_sympd);  // A is not overwritten
+      
+      if(mixed_status == false)
+        {
+        arma_extra_debug_print("glue_solve_gen_full::apply(): auxlib::solve_square_mixed() failed; falling back to full precision");
+        
+        rcond = T(0);
+        }
+      }
+    
+    if(mixed_status)
+      {
+      status = true;
+      }
+    else
     if(fast)
       {
       // fast mode: solvers without refinement and without rcond estimate
@@ -315,6 +377,7 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     if(equilibrate)   { arma_debug_warn_level(2,  "solve(): option 'equilibrate' ignored for non-square matrix"  ); }
     if(refine)        { arma_debug_warn_level(2,  "solve(): option 'refine' ignored for non-square matrix"       ); }
     if(likely_sympd)  { arma_debug_warn_level(2,  "solve(): option 'likely_sympd' ignored for non-square matrix" ); }
+    if(mixed)         { arma_debug_warn_level(2,  "solve(): option 'mixed' ignored for non-square matrix"        ); }
     
     if(fast)
       {
@@ -497,6 +560,7 @@ glue_solve_tri_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
   const bool refine       = bool(flags & solve_opts::flag_refine      );
   const bool no_trimat    = bool(flags & solve_opts::flag_no_trimat   );
   const bool force_approx = bool(flags & solve_opts::flag_force_approx);
+  const bool mixed        = bool(flags & solve_opts::flag_mixed       );
   
   arma_extra_debug_print("glue_solve_tri_full::apply(): enabled flags:");
   
@@ -510,6 +574,7 @@ glue_solve_tri_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
   if(refine      )  { arma_extra_debug_print("refine");       }
   if(no_trimat   )  { arma_extra_debug_print("no_trimat");    }
   if(force_approx)  { arma_extra_debug_print("force_approx"); }
+  if(mixed       )  { arma_extra_debug_print("mixed");        }
   
   if(no_trimat || equilibrate || refine || force_approx)
     {
@@ -519,6 +584,7 @@ glue_solve_tri_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     }
   
   if(likely_sympd)  { arma_debug_warn_level(2, "solve(): option 'likely_sympd' ignored for triangular matrix"); }
+  if(mixed)         { arma_debug_warn_level(2, "solve(): option 'mixed' ignored for triangular matrix");        }
   
   const quasi_unwrap<T1> UA(A_expr.get_ref());
   const Mat<eT>& A     = UA.M;
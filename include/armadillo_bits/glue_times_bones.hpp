@@ -141,6 +141,15 @@ class glue_times
   template<typename eT, const bool do_trans_A, const bool do_trans_B, const bool do_trans_C, const bool do_scalar_times, typename TA, typename TB, typename TC>
   arma_hot inline static void apply(Mat<eT>& out, const TA& A, const TB& B, const TC& C, const eT val);
   
+  template<typename T1, typename T2>
+  inline static void apply_strided(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue_times>& X);
+  
+  template<typename eT, const bool do_trans_A, const bool do_trans_B, const bool use_alpha, typename TA, typename TB>
+  inline static void apply_strided_noalias(Mat<eT>& out, const TA& A, const TB& B, const eT alpha, const typename arma_blas_type_only<eT>::result* junk = nullptr);
+  
+  template<typename eT, const bool do_trans_A, const bool do_trans_B, const bool use_alpha, typename TA, typename TB>
+  inline static void apply_strided_noalias(Mat<eT>& out, const TA& A, const TB& B, const eT alpha, const typename arma_not_blas_type<eT>::result* junk = nullptr);
+  
   template<typename eT, const bool do_trans_A, const bool do_trans_B, const bool do_trans_C, const bool do_trans_D, const bool do_scalar_times, typename TA, typename TB, typename TC, typename TD>
   arma_hot inline static void apply(Mat<eT>& out, const TA& A, const TB& B, const TC& C, const TD& D, const eT val);
   };
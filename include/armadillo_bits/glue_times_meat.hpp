@@ -31,6 +31,18 @@ glue_times_redirect2_helper<do_inv_detect>::apply(Mat<typename T1::elem_type>& o
   
   typedef typename T1::elem_type eT;
   
+  if( (arma_config::blas) && (arma_config::atlas == false) && (is_supported_blas_type<eT>::value) && (partial_unwrap_strided<T1>::is_strided || partial_unwrap_strided<T2>::is_strided) )
+    {
+    if( partial_unwrap_strided<T1>::use_strided(X.A) || partial_unwrap_strided<T2>::use_strided(X.B) )
+      {
+      arma_extra_debug_print("glue_times_redirect<2>::apply(): using strided subview");
+      
+      glue_times::apply_strided(out, X);
+      
+      return;
+      }
+    }
+  
   const partial_unwrap<T1> tmp1(X.A);
   const partial_unwrap<T2> tmp2(X.B);
   
@@ -722,6 +734,145 @@ glue_times::apply
 
 
 
+template<typename T1, typename T2>
+inline
+void
+glue_times::apply_strided(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue_times>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const partial_unwrap_strided<T1> A(X.A);
+  const partial_unwrap_strided<T2> B(X.B);
+  
+  constexpr bool use_alpha = partial_unwrap_strided<T1>::do_times || partial_unwrap_strided<T2>::do_times;
+  
+  const eT alpha = use_alpha ? (A.get_val() * B.get_val()) : eT(0);
+  
+  if( A.is_alias(out) || B.is_alias(out) )
+    {
+    Mat<eT> tmp;
+    
+    glue_times::apply_strided_noalias<eT, partial_unwrap_strided<T1>::do_trans, partial_unwrap_strided<T2>::do_trans, use_alpha>(tmp, A, B, alpha);
+    
+    out.steal_mem(tmp);
+    }
+  else
+    {
+    glue_times::apply_strided_noalias<eT, partial_unwrap_strided<T1>::do_trans, partial_unwrap_strided<T2>::do_trans, use_alpha>(out, A, B, alpha);
+    }
+  }
+
+
+
+//! multiply operands described by partial_unwrap_strided, passing their leading dimensions directly to BLAS
+template<typename eT, const bool do_trans_A, const bool do_trans_B, const bool use_alpha, typename TA, typename TB>
+inline
+void
+glue_times::apply_strided_noalias(Mat<eT>& out, const TA& A, const TB& B, const eT alpha, const typename arma_blas_type_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_debug_assert_trans_mul_size<do_trans_A, do_trans_B>(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "matrix multiplication");
+  
+  const uword final_n_rows = (do_trans_A) ? A.n_cols : A.n_rows;
+  const uword final_n_cols = (do_trans_B) ? B.n_rows : B.n_cols;
+  
+  const uword k = (do_trans_A) ? A.n_rows : A.n_cols;
+  
+  out.set_size(final_n_rows, final_n_cols);
+  
+  if(out.n_elem == 0)  { return; }
+  
+  if(k == 0)  { out.zeros(); return; }
+  
+  #if defined(ARMA_USE_BLAS)
+    {
+    arma_debug_assert_blas_size(A, B);
+    
+    const char trans_A = (do_trans_A) ? ( is_cx<eT>::yes ? 'C' : 'T' ) : 'N';
+    const char trans_B = (do_trans_B) ? ( is_cx<eT>::yes ? 'C' : 'T' ) : 'N';
+    
+    const eT local_alpha = (use_alpha) ? alpha : eT(1);
+    const eT local_beta  = eT(0);
+    
+    const blas_int lda = blas_int(A.ld);
+    const blas_int ldb = blas_int(B.ld);
+    
+    const bool same_operand = (A.mem == B.mem) && (A.ld == B.ld) && (A.n_rows == B.n_rows) && (A.n_cols == B.n_cols);
+    
+    if( (final_n_cols == 1) && ( (do_trans_B == false) || is_cx<eT>::no ) )
+      {
+      // B is either a column vector (increment 1) or a row of a larger matrix (increment ld)
+      
+      const blas_int m    = blas_int(A.n_rows);
+      const blas_int n    = blas_int(A.n_cols);
+      const blas_int incx = (do_trans_B) ? ldb : blas_int(1);
+      const blas_int incy = blas_int(1);
+      
+      arma_extra_debug_print("blas::gemv()");
+      
+      blas::gemv<eT>(&trans_A, &m, &n, &local_alpha, A.mem, &lda, B.mem, &incx, &local_beta, out.memptr(), &incy);
+      }
+    else
+    if( same_operand && (do_trans_A != do_trans_B) && is_cx<eT>::no )
+      {
+      // trans(X)*X or X*trans(X); only the upper triangle is computed by syrk
+      
+      const char uplo  = 'U';
+      const char trans = (do_trans_A) ? 'T' : 'N';
+      
+      const blas_int n   = blas_int(final_n_rows);
+      const blas_int kk  = blas_int(k);
+      const blas_int ldc = blas_int(final_n_rows);
+      
+      arma_extra_debug_print("blas::syrk()");
+      
+      blas::syrk<eT>(&uplo, &trans, &n, &kk, &local_alpha, A.mem, &lda, &local_beta, out.memptr(), &ldc);
+      
+      syrk_helper::inplace_copy_upper_tri_to_lower_tri(out);
+      }
+    else
+      {
+      const blas_int m   = blas_int(final_n_rows);
+      const blas_int n   = blas_int(final_n_cols);
+      const blas_int kk  = blas_int(k);
+      const blas_int ldc = blas_int(final_n_rows);
+      
+      arma_extra_debug_print("blas::gemm()");
+      
+      blas::gemm<eT>(&trans_A, &trans_B, &m, &n, &kk, &local_alpha, A.mem, &lda, B.mem, &ldb, &local_beta, out.memptr(), &ldc);
+      }
+    }
+  #else
+    {
+    arma_ignore(alpha);
+    arma_stop_logic_error("glue_times::apply_strided_noalias(): use of BLAS must be enabled");
+    }
+  #endif
+  }
+
+
+
+template<typename eT, const bool do_trans_A, const bool do_trans_B, const bool use_alpha, typename TA, typename TB>
+inline
+void
+glue_times::apply_strided_noalias(Mat<eT>& out, const TA& A, const TB& B, const eT alpha, const typename arma_not_blas_type<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(out);
+  arma_ignore(A);
+  arma_ignore(B);
+  arma_ignore(alpha);
+  arma_ignore(junk);
+  
+  arma_stop_logic_error("glue_times::apply_strided_noalias(): element type not supported by BLAS");
+  }
+
+
+
 template
   <
   typename   eT,
@@ -79,6 +79,12 @@ class glue_times_sparse_dense
   template<typename T1, typename T2>
   inline static void apply_noalias_trans(Mat<typename T1::elem_type>& out, const T1& x, const T2& y);
   
+  template<typename eT, typename T2>
+  inline static void apply_noalias(Mat<eT>& out, const sp_compact<eT>& A, const T2& y);
+  
+  template<typename eT, typename T2>
+  inline static void apply_noalias_trans(Mat<eT>& out, const sp_compact<eT>& A, const T2& y);
+  
   template<typename T1, typename T2>
   inline static void apply_mixed(Mat< typename promote_type<typename T1::elem_type, typename T2::elem_type>::result >& out, const T1& X, const T2& Y);
   };
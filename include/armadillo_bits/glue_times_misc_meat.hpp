@@ -390,6 +390,42 @@ glue_times_sparse_dense::apply_noalias(Mat<typename T1::elem_type>& out, const T
   
   arma_debug_assert_mul_size(A_n_rows, A_n_cols, B_n_rows, B_n_cols, "matrix multiplication");
   
+  if( ((resolves_to_colvector<T2>::value) || (B_n_cols == 1)) && A.has_csr() )
+    {
+    arma_extra_debug_print("using column vector specialisation (row-wise via CSR mirror)");
+    
+    const SpMat_csr<eT>& A_csr = A.csr();
+    
+    out.set_size(A_n_rows, 1);
+    
+          eT* out_mem = out.memptr();
+    const eT*   B_mem =   B.memptr();
+    
+    const eT*    A_values      = A_csr.values;
+    const uword* A_col_indices = A_csr.col_indices;
+    const uword* A_row_ptrs    = A_csr.row_ptrs;
+    
+    #if defined(ARMA_USE_OPENMP)
+      const bool use_mp    = (A_n_rows >= 2) && (mp_thread_limit::in_parallel() == false) && mp_gate<eT>::eval(A.n_nonzero);
+      const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+    #endif
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+    #endif
+    for(uword row=0; row < A_n_rows; ++row)
+      {
+      const uword start = A_row_ptrs[row    ];
+      const uword endp1 = A_row_ptrs[row + 1];
+      
+      eT acc = eT(0);
+      
+      for(uword i=start; i < endp1; ++i)  { acc += A_values[i] * B_mem[ A_col_indices[i] ]; }
+      
+      out_mem[row] = acc;
+      }
+    }
+  else
   if((resolves_to_colvector<T2>::value) || (B_n_cols == 1))
     {
     arma_extra_debug_print("using column vector specialisation");
@@ -572,6 +608,103 @@ glue_times_sparse_dense::apply_noalias_trans(Mat<typename T1::elem_type>& out, c
 
 
 
+//! A is used directly, without conversion to SpMat; each column of the output is independent
+template<typename eT, typename T2>
+inline
+void
+glue_times_sparse_dense::apply_noalias(Mat<eT>& out, const sp_compact<eT>& A, const T2& y)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T2> UB(y);
+  const Mat<eT>&     B = UB.M;
+  
+  arma_debug_assert_mul_size(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "matrix multiplication");
+  
+  out.zeros(A.n_rows, B.n_cols);
+  
+  const eT*    A_values      = A.values.memptr();
+  const u32*   A_row_indices = A.row_indices.memptr();
+  const uword* A_col_ptrs    = A.col_ptrs.memptr();
+  
+  const uword A_n_cols = A.n_cols;
+  const uword B_n_cols = B.n_cols;
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = (B_n_cols >= 2) && mp_gate<eT>::eval(A.n_nonzero);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword col=0; col < B_n_cols; ++col)
+    {
+          eT* out_mem = out.colptr(col);
+    const eT*   B_mem =   B.colptr(col);
+    
+    for(uword A_col=0; A_col < A_n_cols; ++A_col)
+      {
+      const eT    B_val = B_mem[A_col];
+      const uword endp1 = A_col_ptrs[A_col + 1];
+      
+      for(uword i=A_col_ptrs[A_col]; i < endp1; ++i)  { out_mem[ A_row_indices[i] ] += A_values[i] * B_val; }
+      }
+    }
+  }
+
+
+
+//! out = A.st() * B, computed as dot products with the columns of A
+template<typename eT, typename T2>
+inline
+void
+glue_times_sparse_dense::apply_noalias_trans(Mat<eT>& out, const sp_compact<eT>& A, const T2& y)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T2> UB(y);
+  const Mat<eT>&     B = UB.M;
+  
+  arma_debug_assert_mul_size(A.n_cols, A.n_rows, B.n_rows, B.n_cols, "matrix multiplication");
+  
+  out.set_size(A.n_cols, B.n_cols);
+  
+  const eT*    A_values      = A.values.memptr();
+  const u32*   A_row_indices = A.row_indices.memptr();
+  const uword* A_col_ptrs    = A.col_ptrs.memptr();
+  
+  const uword A_n_cols = A.n_cols;
+  const uword B_n_cols = B.n_cols;
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = (A_n_cols >= 2) && mp_gate<eT>::eval(A.n_nonzero);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  for(uword col=0; col < B_n_cols; ++col)
+    {
+          eT* out_mem = out.colptr(col);
+    const eT*   B_mem =   B.colptr(col);
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+    #endif
+    for(uword A_col=0; A_col < A_n_cols; ++A_col)
+      {
+      const uword endp1 = A_col_ptrs[A_col + 1];
+      
+      eT acc = eT(0);
+      
+      for(uword i=A_col_ptrs[A_col]; i < endp1; ++i)  { acc += A_values[i] * B_mem[ A_row_indices[i] ]; }
+      
+      out_mem[A_col] = acc;
+      }
+    }
+  }
+
+
+
 template<typename T1, typename T2>
 inline
 void
@@ -98,6 +98,10 @@ memory::acquire(const uword n_elem)
   
   arma_check_bad_alloc( (out_memptr == nullptr), "arma::memory::acquire(): out of memory" );
   
+  #if defined(ARMA_PROFILE)
+    arma_profiler::note_alloc(sizeof(eT)*size_t(n_elem));
+  #endif
+  
   return out_memptr;
   }
 
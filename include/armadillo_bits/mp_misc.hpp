@@ -66,6 +66,10 @@ struct mp_thread_limit
       int n_threads = int(1);
     #endif
     
+    #if defined(ARMA_PROFILE)
+      if(n_threads > 1)  { arma_profiler::note_parallel(); }
+    #endif
+    
     return n_threads;
     }
   
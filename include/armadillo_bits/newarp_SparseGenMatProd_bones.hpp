@@ -26,8 +26,7 @@ class SparseGenMatProd
   {
   private:
   
-  const SpMat<eT>& op_mat;
-        SpMat<eT>  op_mat_st;
+  const sp_sell<eT> op_mat_sell;
   
   
   public:
@@ -23,13 +23,11 @@ namespace newarp
 template<typename eT>
 inline
 SparseGenMatProd<eT>::SparseGenMatProd(const SpMat<eT>& mat_obj)
-  : op_mat(mat_obj)
+  : op_mat_sell(mat_obj)
   , n_rows(mat_obj.n_rows)
   , n_cols(mat_obj.n_cols)
   {
   arma_extra_debug_sigprint();
-  
-  op_mat_st = op_mat.st(); // pre-calculate transpose
   }
 
 
@@ -51,12 +49,17 @@ SparseGenMatProd<eT>::perform_op(eT* x_in, eT* y_out) const
   // y = op_mat * x;
   
   
-  // NEW METHOD
+  // // PREVIOUS METHOD
+  // 
+  // const Row<eT> x(x_in , n_cols, false, true);
+  //       Row<eT> y(y_out, n_rows, false, true);
+  // 
+  // y =  x * op_mat_st;
+  
   
-  const Row<eT> x(x_in , n_cols, false, true);
-        Row<eT> y(y_out, n_rows, false, true);
+  // NEW METHOD: matrix stored in the SELL-C-sigma format
   
-  y =  x * op_mat_st;
+  op_mat_sell.mul_raw(y_out, x_in);
   }
 
 
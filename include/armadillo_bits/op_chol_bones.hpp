@@ -31,6 +31,9 @@ class op_chol
   
   template<typename T1>
   inline static bool apply_direct(Mat<typename T1::elem_type>& out, const Base<typename T1::elem_type,T1>& A_expr, const uword layout);
+  
+  template<typename T1>
+  inline static bool apply_update(Mat<typename T1::elem_type>& R, const Base<typename T1::elem_type,T1>& V_expr, const uword layout, const bool downdate);
   };
 
 
@@ -71,4 +71,36 @@ op_chol::apply_direct(Mat<typename T1::elem_type>& out, const Base<typename T1::
 
 
 
+template<typename T1>
+inline
+bool
+op_chol::apply_update(Mat<typename T1::elem_type>& R, const Base<typename T1::elem_type,T1>& V_expr, const uword layout, const bool downdate)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> U(V_expr.get_ref());
+  const Mat<eT>& V     = U.M;
+  
+  const char* func_name = (downdate) ? "choldowndate()" : "cholupdate()";
+  
+  arma_debug_check( (R.is_square() == false), func_name, ": given factor must be square sized"                 );
+  arma_debug_check( (V.n_rows != R.n_rows  ), func_name, ": number of rows in given matrices must be the same" );
+  
+  if(R.is_empty() || V.is_empty())  { return true; }
+  
+  // operate on a copy, so that R is unchanged if the downdated matrix is not positive definite
+  
+  Mat<eT> tmp(R);
+  
+  const bool status = auxlib::chol_update(tmp, V, layout, downdate);
+  
+  if(status)  { R.steal_mem(tmp); }
+  
+  return status;
+  }
+
+
+
 //! @}
@@ -29,6 +29,8 @@ class op_cor
   
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op< T1,               op_cor>& in);
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op< Op<T1,op_htrans>, op_cor>& in);
+  
+  template<typename eT> inline static void normalise(Mat<eT>& C);
   };
 
 
@@ -53,17 +53,9 @@ op_cor::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cor>& in)
                       ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
                       : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
   
-  const uword N        = AA.n_rows;
-  const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  op_cov::apply_direct(out, AA, AA, false, norm_type);
   
-  const Mat<eT> tmp = AA.each_row() - mean(AA,0);
-  
-  out = tmp.t() * tmp;
-  out /= norm_val;
-  
-  const Col<eT> s = sqrt(out.diag());
-  
-  out /= (s * s.t());  // TODO: check for zeros in s?
+  op_cor::normalise(out);
   }
 
 
@@ -79,45 +71,52 @@ op_cor::apply(Mat<typename T1::elem_type>& out, const Op< Op<T1,op_htrans>, op_c
   
   const uword norm_type = in.aux_uword_a;
   
-  if(is_cx<eT>::yes)
+  const unwrap<T1>   U(in.m.m);
+  const Mat<eT>& A = U.M;
+  
+  if(A.n_elem == 0)
     {
-    const Mat<eT> tmp = in.m;  // force the evaluation of Op<T1,op_htrans>
-    
-    out = cor(tmp, norm_type);
+    out.reset();
+    return;
     }
-  else
+  
+  if(A.n_elem == 1)
     {
-    const unwrap<T1>   U(in.m.m);
-    const Mat<eT>& A = U.M;
-    
-    if(A.n_elem == 0)
-      {
-      out.reset();
-      return;
-      }
+    out.set_size(1,1);
+    out[0] = eT(1);
+    return;
+    }
+  
+  const Mat<eT>& AA = (A.n_cols == 1)
+                      ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
+                      : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
+  
+  op_cov::apply_direct(out, AA, AA, true, norm_type);
+  
+  op_cor::normalise(out);
+  }
+
+
+
+//! scale the covariance matrix C in place by the outer product of its standard deviations
+template<typename eT>
+inline
+void
+op_cor::normalise(Mat<eT>& C)
+  {
+  arma_extra_debug_sigprint();
+  
+  const Col<eT> s = sqrt(C.diag());
+  
+  for(uword col=0; col < C.n_cols; ++col)
+    {
+    const eT  s_col     = s[col];
+          eT* C_colmem = C.colptr(col);
     
-    if(A.n_elem == 1)
+    for(uword row=0; row < C.n_rows; ++row)
       {
-      out.set_size(1,1);
-      out[0] = eT(1);
-      return;
+      C_colmem[row] /= (s[row] * s_col);  // TODO: check for zeros in s?
       }
-    
-    const Mat<eT>& AA = (A.n_cols == 1)
-                        ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
-                        : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
-    
-    const uword N        = AA.n_cols;
-    const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-    
-    const Mat<eT> tmp = AA.each_col() - mean(AA,1);
-    
-    out = tmp * tmp.t();
-    out /= norm_val;
-    
-    const Col<eT> s = sqrt(out.diag());
-    
-    out /= (s * s.t());  // TODO: check for zeros in s?
     }
   }
 
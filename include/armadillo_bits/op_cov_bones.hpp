@@ -29,6 +29,25 @@ class op_cov
   
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op< T1,               op_cov>& in);
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op< Op<T1,op_htrans>, op_cov>& in);
+  
+  //
+  
+  template<typename eT> inline static void apply_direct(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& Y, const bool obs_in_cols, const uword norm_type, const typename arma_blas_type_only<eT>::result* junk = nullptr);
+  template<typename eT> inline static void apply_direct(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& Y, const bool obs_in_cols, const uword norm_type, const typename arma_not_blas_type<eT>::result* junk = nullptr);
+  
+  
+  private:
+  
+  inline static uword block_size(const uword n_vars);
+  
+  template<typename eT> inline static void fetch_block(Mat<eT>& C, Col<eT>& mu, const Mat<eT>& X, const bool obs_in_cols, const uword start, const uword n_obs);
+  
+  template<typename eT> inline static void block_product(Mat<eT>& D, const Mat<eT>& C, const typename arma_not_cx<eT>::result* junk = nullptr);
+  template<typename eT> inline static void block_product(Mat<eT>& D, const Mat<eT>& C, const typename arma_cx_only<eT>::result* junk = nullptr);
+  
+  template<typename eT> inline static void merge(uword& n_a, Col<eT>& muX_a, Col<eT>& muY_a, Mat<eT>& S_a, const uword n_b, const Col<eT>& muX_b, const Col<eT>& muY_b, const Mat<eT>& S_b, const bool is_sym);
+  
+  template<typename eT> inline static void scatter_range(uword& n, Col<eT>& muX, Col<eT>& muY, Mat<eT>& S, const Mat<eT>& X, const Mat<eT>& Y, const bool obs_in_cols, const uword start, const uword end);
   };
 
 
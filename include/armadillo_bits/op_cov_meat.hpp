@@ -46,13 +46,7 @@ op_cov::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cov>& in)
                       ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
                       : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
   
-  const uword N        = AA.n_rows;
-  const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-  
-  const Mat<eT> tmp = AA.each_row() - mean(AA,0);
-  
-  out = tmp.t() * tmp;
-  out /= norm_val;
+  op_cov::apply_direct(out, AA, AA, false, norm_type);
   }
 
 
@@ -68,34 +62,300 @@ op_cov::apply(Mat<typename T1::elem_type>& out, const Op< Op<T1,op_htrans>, op_c
   
   const uword norm_type = in.aux_uword_a;
   
-  if(is_cx<eT>::yes)
+  const unwrap<T1>   U(in.m.m);
+  const Mat<eT>& A = U.M;
+  
+  if(A.n_elem == 0)
+    {
+    out.reset();
+    return;
+    }
+  
+  const Mat<eT>& AA = (A.n_cols == 1)
+                      ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
+                      : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
+  
+  // the observations are the columns of AA; fetch_block() takes care of the conjugate transpose
+  
+  op_cov::apply_direct(out, AA, AA, true, norm_type);
+  }
+
+
+
+//! out = cov(X,Y) with the observations in the rows of X and Y (or in the columns if obs_in_cols is true);
+//! X and Y are processed in blocks of observations, so the memory use is O(n_vars^2 + block) rather than a centred copy of the data;
+//! passing the same object as X and Y selects the symmetric case, which is evaluated via syrk() / herk()
+template<typename eT>
+inline
+void
+op_cov::apply_direct(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& Y, const bool obs_in_cols, const uword norm_type, const typename arma_blas_type_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const bool is_sym = (&X == &Y);
+  
+  const uword N     = (obs_in_cols) ? X.n_cols : X.n_rows;
+  const uword n_X   = (obs_in_cols) ? X.n_rows : X.n_cols;
+  const uword n_Y   = (obs_in_cols) ? Y.n_rows : Y.n_cols;
+  
+  uword   n = 0;
+  Col<eT> muX(n_X,                  fill::zeros);
+  Col<eT> muY((is_sym) ? 0 : n_Y,   fill::zeros);
+  Mat<eT> S  (n_X, n_Y,             fill::zeros);
+  
+  Col<eT>& muY_ref = (is_sym) ? muX : muY;
+  
+  bool done = false;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    // each thread accumulates a partial result over a contiguous range of observations;
+    // the partial results are merged in order, so the outcome only depends on the number of threads
+    
+    const uword block_rows = op_cov::block_size(n_X);
+    const uword n_threads  = ( (N >= 2*block_rows) && mp_gate<eT>::eval(X.n_elem) ) ? (std::min)( uword(mp_thread_limit::get()), N / block_rows ) : uword(1);
+    
+    if(n_threads > 1)
+      {
+      std::vector< uword   > n_part  (n_threads, uword(0));
+      std::vector< Col<eT> > muX_part(n_threads);
+      std::vector< Col<eT> > muY_part(n_threads);
+      std::vector< Mat<eT> > S_part  (n_threads);
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = (N *  t     ) / n_threads;
+        const uword end   = (N * (t + 1)) / n_threads;
+        
+        muX_part[t].zeros(n_X);
+        muY_part[t].zeros((is_sym) ? 0 : n_Y);
+          S_part[t].zeros(n_X, n_Y);
+        
+        op_cov::scatter_range(n_part[t], muX_part[t], ((is_sym) ? muX_part[t] : muY_part[t]), S_part[t], X, Y, obs_in_cols, start, end);
+        }
+      
+      for(uword t=0; t < n_threads; ++t)
+        {
+        op_cov::merge(n, muX, muY_ref, S, n_part[t], muX_part[t], ((is_sym) ? muX_part[t] : muY_part[t]), S_part[t], is_sym);
+        }
+      
+      done = true;
+      }
+    }
+  #endif
+  
+  if(done == false)
+    {
+    op_cov::scatter_range(n, muX, muY_ref, S, X, Y, obs_in_cols, uword(0), N);
+    }
+  
+  const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  
+  S /= norm_val;
+  
+  out.steal_mem(S);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_cov::apply_direct(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& Y, const bool obs_in_cols, const uword norm_type, const typename arma_not_blas_type<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const uword N        = (obs_in_cols) ? X.n_cols : X.n_rows;
+  const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  
+  if(obs_in_cols)
     {
-    const Mat<eT> tmp = in.m;  // force the evaluation of Op<T1,op_htrans>
+    const Mat<eT> tmp1 = X.each_col() - mean(X,1);
+    const Mat<eT> tmp2 = Y.each_col() - mean(Y,1);
     
-    out = cov(tmp, norm_type);
+    out = tmp1 * tmp2.t();
     }
   else
     {
-    const unwrap<T1>   U(in.m.m);
-    const Mat<eT>& A = U.M;
+    const Mat<eT> tmp1 = X.each_row() - mean(X,0);
+    const Mat<eT> tmp2 = Y.each_row() - mean(Y,0);
     
-    if(A.n_elem == 0)
+    out = tmp1.t() * tmp2;
+    }
+  
+  out /= norm_val;
+  }
+
+
+
+//! number of observations per block: large enough for the O(n_vars^2) merge to be negligible next to the block product,
+//! yet small enough for the block buffer to be no larger than the output
+inline
+uword
+op_cov::block_size(const uword n_vars)
+  {
+  return (std::max)( uword(256), (std::min)(n_vars, uword(2048)) );
+  }
+
+
+
+//! C = centred block of n_obs observations (one per row), starting at observation 'start'; mu = mean of the block
+template<typename eT>
+inline
+void
+op_cov::fetch_block(Mat<eT>& C, Col<eT>& mu, const Mat<eT>& X, const bool obs_in_cols, const uword start, const uword n_obs)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(obs_in_cols)
+    {
+    const Mat<eT> X_block(const_cast<eT*>(X.colptr(start)), X.n_rows, n_obs, false, true);
+    
+    op_htrans::apply_mat_noalias(C, X_block);
+    }
+  else
+    {
+    C.set_size(n_obs, X.n_cols);
+    
+    for(uword col=0; col < X.n_cols; ++col)
       {
-      out.reset();
-      return;
+      arrayops::copy( C.colptr(col), &(X.colptr(col)[start]), n_obs );
       }
+    }
+  
+  mu.set_size(C.n_cols);
+  
+  for(uword col=0; col < C.n_cols; ++col)
+    {
+    eT* C_colmem = C.colptr(col);
     
-    const Mat<eT>& AA = (A.n_cols == 1)
-                        ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
-                        : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
+    const eT val = arrayops::accumulate(C_colmem, n_obs) / eT(n_obs);
     
-    const uword N        = AA.n_cols;
-    const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+    arrayops::inplace_minus(C_colmem, val, n_obs);
     
-    const Mat<eT> tmp = AA.each_col() - mean(AA,1);
+    mu[col] = val;
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_cov::block_product(Mat<eT>& D, const Mat<eT>& C, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  D.set_size(C.n_cols, C.n_cols);
+  
+  syrk<true,false,false>::apply_blas_type(D, C);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_cov::block_product(Mat<eT>& D, const Mat<eT>& C, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  D.set_size(C.n_cols, C.n_cols);
+  
+  herk<true,false,false>::apply_blas_type(D, C);
+  }
+
+
+
+//! merge the partial result (n_b, muX_b, muY_b, S_b) into (n_a, muX_a, muY_a, S_a),
+//! where S is the scatter matrix about the means (Chan, Golub and LeVeque, 1979);
+//! in the symmetric case muY_a and muY_b are the same objects as muX_a and muX_b
+template<typename eT>
+inline
+void
+op_cov::merge(uword& n_a, Col<eT>& muX_a, Col<eT>& muY_a, Mat<eT>& S_a, const uword n_b, const Col<eT>& muX_b, const Col<eT>& muY_b, const Mat<eT>& S_b, const bool is_sym)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  if(n_b == 0)  { return; }
+  
+  const uword n = n_a + n_b;
+  
+  const T w = (T(n_a) / T(n)) * T(n_b);
+  const T r = T(n_b) / T(n);
+  
+  const Col<eT> dX = muX_b - muX_a;
+  const Col<eT> dY = (is_sym) ? Col<eT>() : Col<eT>(muY_b - muY_a);
+  
+  const Col<eT>& dY_ref = (is_sym) ? dX : dY;
+  
+  for(uword col=0; col < S_a.n_cols; ++col)
+    {
+    const eT  dY_val     = dY_ref[col] * w;
+          eT* S_a_colmem = S_a.colptr(col);
+    const eT* S_b_colmem = S_b.colptr(col);
     
-    out = tmp * tmp.t();
-    out /= norm_val;
+    for(uword row=0; row < S_a.n_rows; ++row)
+      {
+      S_a_colmem[row] += S_b_colmem[row] + access::alt_conj(dX[row]) * dY_val;
+      }
+    }
+  
+  muX_a += dX * r;
+  
+  if(is_sym == false)  { muY_a += dY * r; }
+  
+  n_a = n;
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_cov::scatter_range(uword& n, Col<eT>& muX, Col<eT>& muY, Mat<eT>& S, const Mat<eT>& X, const Mat<eT>& Y, const bool obs_in_cols, const uword start, const uword end)
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool  is_sym     = (&X == &Y);
+  const uword block_rows = op_cov::block_size(S.n_rows);
+  
+  Mat<eT> CX;
+  Mat<eT> CY;
+  Mat<eT> D;
+  
+  Col<eT> block_muX;
+  Col<eT> block_muY;
+  
+  for(uword block_start=start; block_start < end; block_start += block_rows)
+    {
+    const uword n_obs = (std::min)(block_rows, end - block_start);
+    
+    op_cov::fetch_block(CX, block_muX, X, obs_in_cols, block_start, n_obs);
+    
+    if(is_sym)
+      {
+      op_cov::block_product(D, CX);
+      
+      op_cov::merge(n, muX, muX, S, n_obs, block_muX, block_muX, D, true);
+      }
+    else
+      {
+      op_cov::fetch_block(CY, block_muY, Y, obs_in_cols, block_start, n_obs);
+      
+      D.set_size(CX.n_cols, CY.n_cols);
+      
+      glue_times::apply<eT, true, false, false>(D, CX, CY, eT(1));
+      
+      op_cov::merge(n, muX, muY, S, n_obs, block_muX, block_muY, D, false);
+      }
     }
   }
 
@@ -53,6 +53,15 @@ op_det::apply_direct(typename T1::elem_type& out_val, const Base<typename T1::el
   
   arma_debug_check( (A.is_square() == false), "det(): given matrix must be square sized" );
   
+  // structure hint set by the user, carried over from expr
+  
+  uword KL = 0;
+  uword KU = 0;
+  
+  const struct_hint hint = A.get_hint(KL, KU);
+  
+  const bool has_hint = (hint != struct_hint::none);
+  
   const uword N = A.n_rows;
   
   if(N == 0)  { out_val = eT(1); return true; }
@@ -75,6 +84,37 @@ op_det::apply_direct(typename T1::elem_type& out_val, const Base<typename T1::el
     // fallthrough if det_val is suspect
     }
   
+  if(has_hint)
+    {
+    const bool hint_trimat = (hint == struct_hint::triu) || (hint == struct_hint::tril) || ((hint == struct_hint::band) && ((KL == 0) || (KU == 0)));
+    
+    if(hint_trimat)  { out_val = op_det::apply_trimat(A); return true; }
+    
+    if(hint == struct_hint::sympd)
+      {
+      arma_extra_debug_print("op_det::apply_direct(): sympd hint");
+      
+      const bool status = auxlib::chol_simple(A);
+      
+      if(status)
+        {
+        T val = T(1);
+        
+        for(uword i=0; i < N; ++i)  { const T R_ii = access::tmp_real(A.at(i,i)); val *= (R_ii * R_ii); }
+        
+        out_val = eT(val);
+        
+        return true;
+        }
+      
+      arma_extra_debug_print("op_det::apply_direct(): auxlib::chol_simple() failed; retrying");
+      
+      A = expr.get_ref();
+      }
+    
+    return auxlib::det(out_val, A);
+    }
+  
   if(A.is_diagmat())  { out_val = op_det::apply_diagmat(A); return true; }
   
   const bool is_triu =                   trimat_helper::is_triu(A);
@@ -37,6 +37,14 @@ class op_dot
   typename arma_cx_only<eT>::result
   direct_dot_arma(const uword n_elem, const eT* const A, const eT* const B);
   
+  template<typename eT>
+  arma_hot inline static typename arma_real_only<eT>::result
+  direct_dot_compensated(const uword n_elem, const eT* const A, const eT* const B);
+  
+  template<typename eT>
+  arma_hot inline static typename arma_real_only<eT>::result
+  direct_dot_mp(const uword n_elem, const eT* const A, const eT* const B);
+  
   template<typename eT>
   arma_hot inline static typename arma_real_only<eT>::result
   direct_dot(const uword n_elem, const eT* const A, const eT* const B);
@@ -65,6 +73,20 @@ class op_dot
 
 
 
+//! element accessor for the products A[i]*B[i], used for compensated summation of dot products
+template<typename eT>
+struct op_dot_products_ea
+  {
+  const eT* const A;
+  const eT* const B;
+  
+  arma_inline op_dot_products_ea(const eT* const in_A, const eT* const in_B) : A(in_A), B(in_B) {}
+  
+  arma_inline eT operator[] (const uword i) const { return A[i] * B[i]; }
+  };
+
+
+
 //! \brief
 //! normalised dot product operation 
 
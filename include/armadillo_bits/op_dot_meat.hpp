@@ -98,6 +98,58 @@ op_dot::direct_dot_arma(const uword n_elem, const eT* const A, const eT* const B
 
 
 
+//! for two arrays, float and double version, with compensated summation of the products (see arrayops::accumulate_compensated())
+template<typename eT>
+inline
+typename arma_real_only<eT>::result
+op_dot::direct_dot_compensated(const uword n_elem, const eT* const A, const eT* const B)
+  {
+  arma_extra_debug_sigprint();
+  
+  const op_dot_products_ea<eT> AB(A, B);
+  
+  return arrayops::accumulate_compensated<eT>(AB, 0, n_elem);
+  }
+
+
+
+//! for two arrays, float and double version, using one partial sum per thread
+template<typename eT>
+inline
+typename arma_real_only<eT>::result
+op_dot::direct_dot_mp(const uword n_elem, const eT* const A, const eT* const B)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (n_elem >= (arma_config::mp_threshold * uword(32))) && mp_gate<eT>::eval(n_elem) )
+      {
+      const int   n_threads_max = mp_thread_limit::get();
+      const uword n_threads_use = (std::min)(uword(podarray_prealloc_n_elem::val), uword(n_threads_max));
+      const uword chunk_size    = n_elem / n_threads_use;
+      
+      podarray<eT> partial_accs(n_threads_use);
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = (thread_id+0) * chunk_size;
+        const uword endp1 = ((thread_id+1) == n_threads_use) ? n_elem : ((thread_id+1) * chunk_size);
+        
+        partial_accs[thread_id] = (arma_config::compensated_sum) ? op_dot::direct_dot_compensated(endp1 - start, &(A[start]), &(B[start])) : op_dot::direct_dot_arma(endp1 - start, &(A[start]), &(B[start]));
+        }
+      
+      return arrayops::accumulate(partial_accs.memptr(), n_threads_use);
+      }
+    }
+  #endif
+  
+  return (arma_config::compensated_sum) ? op_dot::direct_dot_compensated(n_elem, A, B) : op_dot::direct_dot_arma(n_elem, A, B);
+  }
+
+
+
 //! for two arrays, float and double version
 template<typename eT>
 inline
@@ -110,6 +162,11 @@ op_dot::direct_dot(const uword n_elem, const eT* const A, const eT* const B)
     {
     return op_dot::direct_dot_arma(n_elem, A, B);
     }
+  else
+  if(arma_config::compensated_sum)
+    {
+    return op_dot::direct_dot_mp(n_elem, A, B);
+    }
   else
     {
     #if defined(ARMA_USE_ATLAS)
@@ -126,7 +183,7 @@ op_dot::direct_dot(const uword n_elem, const eT* const A, const eT* const B)
       }
     #else
       {
-      return op_dot::direct_dot_arma(n_elem, A, B);
+      return op_dot::direct_dot_mp(n_elem, A, B);
       }
     #endif
     }
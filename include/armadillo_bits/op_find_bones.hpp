@@ -79,6 +79,12 @@ class op_find
   
   template<typename T1>
   inline static void apply(Mat<uword>& out, const mtOp<uword, T1, op_find>& X);
+  
+  template<typename eT>
+  inline static bool use_mp(const uword n_elem);
+  
+  template<typename out_eT, typename functor>
+  inline static uword helper_mp(out_eT* out_mem, const uword n_elem, const functor& F);
   };
 
 
@@ -48,9 +48,16 @@ op_find::helper
     {
     typename Proxy<T1>::ea_type PA = A.get_ea();
     
-    for(uword i=0; i<n_elem; ++i)
+    if(op_find::use_mp<eT>(n_elem))
+      {
+      n_nz = op_find::helper_mp(indices_mem, n_elem, [&](uword& dest, const uword i) -> bool { dest = i; return (PA[i] != eT(0)); });
+      }
+    else
       {
-      if(PA[i] != eT(0))  { indices_mem[n_nz] = i;  ++n_nz; }
+      for(uword i=0; i<n_elem; ++i)
+        {
+        if(PA[i] != eT(0))  { indices_mem[n_nz] = i;  ++n_nz; }
+        }
       }
     }
   else
@@ -107,6 +114,34 @@ op_find::helper
   uword* indices_mem = indices.memptr();
   uword  n_nz        = 0;
   
+  if( (Proxy<T1>::use_at == false) && op_find::use_mp<eT>(n_elem) )
+    {
+    typename Proxy<T1>::ea_type PA = A.get_ea();
+    
+    n_nz = op_find::helper_mp(indices_mem, n_elem, [&](uword& dest, const uword i) -> bool
+      {
+      const eT tmp = PA[i];
+      
+      bool not_zero;
+      
+           if(is_same_type<op_type, op_rel_lt_pre   >::yes)  { not_zero = (val <  tmp); }
+      else if(is_same_type<op_type, op_rel_lt_post  >::yes)  { not_zero = (tmp <  val); }
+      else if(is_same_type<op_type, op_rel_gt_pre   >::yes)  { not_zero = (val >  tmp); }
+      else if(is_same_type<op_type, op_rel_gt_post  >::yes)  { not_zero = (tmp >  val); }
+      else if(is_same_type<op_type, op_rel_lteq_pre >::yes)  { not_zero = (val <= tmp); }
+      else if(is_same_type<op_type, op_rel_lteq_post>::yes)  { not_zero = (tmp <= val); }
+      else if(is_same_type<op_type, op_rel_gteq_pre >::yes)  { not_zero = (val >= tmp); }
+      else if(is_same_type<op_type, op_rel_gteq_post>::yes)  { not_zero = (tmp >= val); }
+      else if(is_same_type<op_type, op_rel_eq       >::yes)  { not_zero = (tmp == val); }
+      else if(is_same_type<op_type, op_rel_noteq    >::yes)  { not_zero = (tmp != val); }
+      else { not_zero = false; }
+      
+      dest = i;
+      
+      return not_zero;
+      });
+    }
+  else
   if(Proxy<T1>::use_at == false)
     {
     typename Proxy<T1>::ea_type PA = A.get_ea();
@@ -322,6 +357,34 @@ op_find::helper
   uword* indices_mem = indices.memptr();
   uword  n_nz        = 0;
   
+  if( (Proxy<T1>::use_at == false) && (Proxy<T2>::use_at == false) && op_find::use_mp<eT1>(n_elem) )
+    {
+    ea_type1 PA = A.get_ea();
+    ea_type2 PB = B.get_ea();
+    
+    n_nz = op_find::helper_mp(indices_mem, n_elem, [&](uword& dest, const uword i) -> bool
+      {
+      const eT1 tmp1 = PA[i];
+      const eT2 tmp2 = PB[i];
+      
+      bool not_zero;
+      
+           if(is_same_type<glue_type, glue_rel_lt    >::yes)  { not_zero = (tmp1 <  tmp2); }
+      else if(is_same_type<glue_type, glue_rel_gt    >::yes)  { not_zero = (tmp1 >  tmp2); }
+      else if(is_same_type<glue_type, glue_rel_lteq  >::yes)  { not_zero = (tmp1 <= tmp2); }
+      else if(is_same_type<glue_type, glue_rel_gteq  >::yes)  { not_zero = (tmp1 >= tmp2); }
+      else if(is_same_type<glue_type, glue_rel_eq    >::yes)  { not_zero = (tmp1 == tmp2); }
+      else if(is_same_type<glue_type, glue_rel_noteq >::yes)  { not_zero = (tmp1 != tmp2); }
+      else if(is_same_type<glue_type, glue_rel_and   >::yes)  { not_zero = (tmp1 && tmp2); }
+      else if(is_same_type<glue_type, glue_rel_or    >::yes)  { not_zero = (tmp1 || tmp2); }
+      else { not_zero = false; }
+      
+      dest = i;
+      
+      return not_zero;
+      });
+    }
+  else
   if((Proxy<T1>::use_at == false) && (Proxy<T2>::use_at == false))
     {
     ea_type1 PA = A.get_ea();
@@ -490,6 +553,89 @@ op_find::apply(Mat<uword>& out, const mtOp<uword, T1, op_find>& X)
 
 
 
+template<typename eT>
+inline
+bool
+op_find::use_mp(const uword n_elem)
+  {
+  // the scan is memory bound, so each thread needs a sizeable amount of work to be worthwhile
+  
+  return (arma_config::openmp) && (n_elem >= (arma_config::mp_threshold * uword(32))) && mp_gate<eT>::eval(n_elem);
+  }
+
+
+
+//! parallel version of the compacting scan used by the find functions;
+//! F(dest,i) writes the candidate for element i into dest and returns true if it is to be kept;
+//! the kept entries are stored in out_mem in the same order as a serial scan would produce
+template<typename out_eT, typename functor>
+inline
+uword
+op_find::helper_mp(out_eT* out_mem, const uword n_elem, const functor& F)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int   n_threads_max = mp_thread_limit::get();
+    const uword n_threads_use = (std::min)(uword(podarray_prealloc_n_elem::val), uword(n_threads_max));
+    const uword chunk_size    = n_elem / n_threads_use;
+    
+    podarray<uword> counts(n_threads_use);
+    
+    // each thread compacts its own chunk in place, so the input is only evaluated once
+    
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+    for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+      {
+      const uword start = (thread_id+0) * chunk_size;
+      const uword endp1 = ((thread_id+1) == n_threads_use) ? n_elem : ((thread_id+1) * chunk_size);
+      
+      out_eT* chunk_mem = &(out_mem[start]);
+      
+      uword count = 0;
+      
+      for(uword i=start; i < endp1; ++i)
+        {
+        if( F(chunk_mem[count], i) )  { ++count; }
+        }
+      
+      counts[thread_id] = count;
+      }
+    
+    // join the compacted chunks; the destination never lies after the source
+    
+    uword n_nz = counts[0];
+    
+    for(uword thread_id=1; thread_id < n_threads_use; ++thread_id)
+      {
+      const uword   count     = counts[thread_id];
+      const out_eT* chunk_mem = &(out_mem[thread_id * chunk_size]);
+            out_eT* dest_mem  = &(out_mem[n_nz]);
+      
+      if(dest_mem != chunk_mem)
+        {
+        for(uword i=0; i < count; ++i)  { dest_mem[i] = chunk_mem[i]; }
+        }
+      
+      n_nz += count;
+      }
+    
+    return n_nz;
+    }
+  #else
+    {
+    arma_ignore(out_mem);
+    arma_ignore(n_elem);
+    arma_ignore(F);
+    
+    return uword(0);
+    }
+  #endif
+  }
+
+
+
 //
 
 
@@ -535,9 +681,16 @@ op_find_finite::apply(Mat<uword>& out, const mtOp<uword, T1, op_find_finite>& X)
     {
     const typename Proxy<T1>::ea_type Pea = P.get_ea();
     
-    for(uword i=0; i<n_elem; ++i)
+    if(op_find::use_mp<typename T1::elem_type>(n_elem))
+      {
+      count = op_find::helper_mp(indices_mem, n_elem, [&](uword& dest, const uword i) -> bool { dest = i; return arma_isfinite(Pea[i]); });
+      }
+    else
       {
-      if( arma_isfinite(Pea[i]) )  { indices_mem[count] = i; count++; }
+      for(uword i=0; i<n_elem; ++i)
+        {
+        if( arma_isfinite(Pea[i]) )  { indices_mem[count] = i; count++; }
+        }
       }
     }
   else
@@ -583,9 +736,16 @@ op_find_nonfinite::apply(Mat<uword>& out, const mtOp<uword, T1, op_find_nonfinit
     {
     const typename Proxy<T1>::ea_type Pea = P.get_ea();
     
-    for(uword i=0; i<n_elem; ++i)
+    if(op_find::use_mp<typename T1::elem_type>(n_elem))
+      {
+      count = op_find::helper_mp(indices_mem, n_elem, [&](uword& dest, const uword i) -> bool { dest = i; return (arma_isfinite(Pea[i]) == false); });
+      }
+    else
       {
-      if( arma_isfinite(Pea[i]) == false )  { indices_mem[count] = i; count++; }
+      for(uword i=0; i<n_elem; ++i)
+        {
+        if( arma_isfinite(Pea[i]) == false )  { indices_mem[count] = i; count++; }
+        }
       }
     }
   else
@@ -631,9 +791,16 @@ op_find_nan::apply(Mat<uword>& out, const mtOp<uword, T1, op_find_nan>& X)
     {
     const typename Proxy<T1>::ea_type Pea = P.get_ea();
     
-    for(uword i=0; i<n_elem; ++i)
+    if(op_find::use_mp<typename T1::elem_type>(n_elem))
+      {
+      count = op_find::helper_mp(indices_mem, n_elem, [&](uword& dest, const uword i) -> bool { dest = i; return arma_isnan(Pea[i]); });
+      }
+    else
       {
-      if( arma_isnan(Pea[i]) )  { indices_mem[count] = i; count++; }
+      for(uword i=0; i<n_elem; ++i)
+        {
+        if( arma_isnan(Pea[i]) )  { indices_mem[count] = i; count++; }
+        }
       }
     }
   else
@@ -26,6 +26,12 @@ class op_find_unique
   {
   public:
   
+  template<typename T1>
+  static inline bool apply_helper_hash(Mat<uword>& out, const Proxy<T1>& P, const bool ascending_indices, const typename arma_integral_only<typename T1::elem_type>::result* junk = nullptr);
+  
+  template<typename T1>
+  static inline bool apply_helper_hash(Mat<uword>& out, const Proxy<T1>& P, const bool ascending_indices, const typename arma_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
   template<typename T1>
   static inline bool apply_helper(Mat<uword>& out, const Proxy<T1>& P, const bool ascending_indices);
   
@@ -21,6 +21,108 @@
 
 
 
+//! find the first occurrence of each unique value via hashing, followed by sorting only the unique values;
+//! returns false (leaving out unchanged) if the number of unique values is too large for hashing to be beneficial
+template<typename T1>
+inline
+bool
+op_find_unique::apply_helper_hash(Mat<uword>& out, const Proxy<T1>& P, const bool ascending_indices, const typename arma_integral_only<typename T1::elem_type>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword n_elem = P.get_n_elem();
+  
+  const uword max_n_unique = n_elem / uword(16);
+  
+  std::unordered_map<eT,uword> first_indices;
+  
+  if(Proxy<T1>::use_at == false)
+    {
+    typename Proxy<T1>::ea_type Pea = P.get_ea();
+    
+    for(uword i=0; i<n_elem; ++i)
+      {
+      first_indices.emplace(Pea[i], i);
+      
+      if(first_indices.size() > max_n_unique)  { return false; }
+      }
+    }
+  else
+    {
+    const uword n_rows = P.get_n_rows();
+    const uword n_cols = P.get_n_cols();
+    
+    uword i = 0;
+    
+    for(uword col=0; col < n_cols; ++col)
+    for(uword row=0; row < n_rows; ++row)
+      {
+      first_indices.emplace(P.at(row,col), i);
+      
+      if(first_indices.size() > max_n_unique)  { return false; }
+      
+      ++i;
+      }
+    }
+  
+  const uword N_unique = uword(first_indices.size());
+  
+  uvec indices(N_unique, arma_nozeros_indicator());
+  
+  uword* indices_mem = indices.memptr();
+  
+  typename std::unordered_map<eT,uword>::const_iterator it     = first_indices.begin();
+  typename std::unordered_map<eT,uword>::const_iterator it_end = first_indices.end();
+  
+  if(ascending_indices)
+    {
+    for(uword i=0; it != it_end; ++it, ++i)  { indices_mem[i] = (*it).second; }
+    
+    std::sort(indices.begin(), indices.end());
+    }
+  else
+    {
+    std::vector< arma_find_unique_packet<eT> > packet_vec(N_unique);
+    
+    for(uword i=0; it != it_end; ++it, ++i)
+      {
+      packet_vec[i].val   = (*it).first;
+      packet_vec[i].index = (*it).second;
+      }
+    
+    arma_find_unique_comparator<eT> comparator;
+    
+    std::sort( packet_vec.begin(), packet_vec.end(), comparator );
+    
+    for(uword i=0; i < N_unique; ++i)  { indices_mem[i] = packet_vec[i].index; }
+    }
+  
+  out.steal_mem(indices);
+  
+  return true;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+op_find_unique::apply_helper_hash(Mat<uword>& out, const Proxy<T1>& P, const bool ascending_indices, const typename arma_real_or_cx_only<typename T1::elem_type>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(out);
+  arma_ignore(P);
+  arma_ignore(ascending_indices);
+  arma_ignore(junk);
+  
+  return false;
+  }
+
+
+
 template<typename T1>
 inline
 bool
@@ -35,6 +137,11 @@ op_find_unique::apply_helper(Mat<uword>& out, const Proxy<T1>& P, const bool asc
   if(n_elem == 0)  { out.set_size(0,1);             return true; }
   if(n_elem == 1)  { out.set_size(1,1); out[0] = 0; return true; }
   
+  if(op_unique::use_hash<eT>(n_elem))
+    {
+    if(op_find_unique::apply_helper_hash(out, P, ascending_indices))  { return true; }
+    }
+  
   uvec indices(n_elem, arma_nozeros_indicator());
   
   std::vector< arma_find_unique_packet<eT> > packet_vec(n_elem);
@@ -76,7 +183,10 @@ op_find_unique::apply_helper(Mat<uword>& out, const Proxy<T1>& P, const bool asc
   
   arma_find_unique_comparator<eT> comparator;
   
-  std::sort( packet_vec.begin(), packet_vec.end(), comparator );
+  // stable sorting keeps equal values in order of position,
+  // so the first occurrence of each value is retained (as in the hash-based path)
+  
+  std::stable_sort( packet_vec.begin(), packet_vec.end(), comparator );
   
   uword* indices_mem = indices.memptr();
   
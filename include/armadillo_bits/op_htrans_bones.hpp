@@ -45,9 +45,15 @@ class op_htrans
   template<typename T>
   arma_hot inline static void block_worker(std::complex<T>* Y, const std::complex<T>* X, const uword X_n_rows, const uword Y_n_rows, const uword n_rows, const uword n_cols);
   
+  template<typename T>
+  arma_hot inline static void stripe_worker(std::complex<T>* Y, const std::complex<T>* X, const uword n_rows, const uword n_cols, const uword row, const uword stripe_n_rows);
+  
   template<typename T>
   arma_hot inline static void apply_mat_noalias_large(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& A);
   
+  template<typename T>
+  arma_hot inline static void apply_mat_inplace_large(Mat< std::complex<T> >& out);
+  
   //
   
   template<typename eT>
@@ -105,6 +105,34 @@ op_htrans::block_worker(std::complex<T>* Y, const std::complex<T>* X, const uwor
 
 
 
+template<typename T>
+inline
+void
+op_htrans::stripe_worker(std::complex<T>* Y, const std::complex<T>* X, const uword n_rows, const uword n_cols, const uword row, const uword stripe_n_rows)
+  {
+  const uword block_size = 64;
+  
+  const uword n_cols_base  = block_size * (n_cols / block_size);
+  const uword n_cols_extra = n_cols - n_cols_base;
+  
+  const uword Y_offset = row * n_cols;
+  
+  for(uword col = 0; col < n_cols_base; col += block_size)
+    {
+    const uword X_offset = col * n_rows;
+    
+    op_htrans::block_worker(&Y[col + Y_offset], &X[row + X_offset], n_rows, n_cols, stripe_n_rows, block_size);
+    }
+  
+  if(n_cols_extra == 0)  { return; }
+  
+  const uword X_offset = n_cols_base * n_rows;
+  
+  op_htrans::block_worker(&Y[n_cols_base + Y_offset], &X[row + X_offset], n_rows, n_cols, stripe_n_rows, n_cols_extra);
+  }
+
+
+
 template<typename T>
 inline
 void
@@ -112,50 +140,101 @@ op_htrans::apply_mat_noalias_large(Mat< std::complex<T> >& out, const Mat< std::
   {
   arma_extra_debug_sigprint();
   
+  typedef std::complex<T> eT;
+  
   const uword n_rows = A.n_rows;
   const uword n_cols = A.n_cols;
   
   const uword block_size = 64;
   
-  const uword n_rows_base = block_size * (n_rows / block_size);
-  const uword n_cols_base = block_size * (n_cols / block_size);
-  
-  const uword n_rows_extra = n_rows - n_rows_base;
-  const uword n_cols_extra = n_cols - n_cols_base;
+  const uword n_stripes = (n_rows / block_size) + ( ((n_rows % block_size) != 0) ? 1 : 0 );
   
-  const std::complex<T>* X =   A.memptr();
-        std::complex<T>* Y = out.memptr();
+  const eT* X =   A.memptr();
+        eT* Y = out.memptr();
   
-  for(uword row = 0; row < n_rows_base; row += block_size)
+  #if defined(ARMA_USE_OPENMP)
     {
-    const uword Y_offset = row * n_cols;
-    
-    for(uword col = 0; col < n_cols_base; col += block_size)
+    if(mp_gate<eT>::eval(A.n_elem))
       {
-      const uword X_offset = col * n_rows;
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword stripe = 0; stripe < n_stripes; ++stripe)
+        {
+        const uword row = stripe * block_size;
+        
+        op_htrans::stripe_worker(Y, X, n_rows, n_cols, row, (std::min)(block_size, n_rows - row));
+        }
       
-      op_htrans::block_worker(&Y[col + Y_offset], &X[row + X_offset], n_rows, n_cols, block_size, block_size);
+      return;
       }
+    }
+  #endif
+  
+  for(uword stripe = 0; stripe < n_stripes; ++stripe)
+    {
+    const uword row = stripe * block_size;
     
-    const uword X_offset = n_cols_base * n_rows;
-    
-    op_htrans::block_worker(&Y[n_cols_base + Y_offset], &X[row + X_offset], n_rows, n_cols, block_size, n_cols_extra);
+    op_htrans::stripe_worker(Y, X, n_rows, n_cols, row, (std::min)(block_size, n_rows - row));
     }
+  }
+
+
 
-  if(n_rows_extra == 0)  { return; }
+template<typename T>
+inline
+void
+op_htrans::apply_mat_inplace_large(Mat< std::complex<T> >& out)
+  {
+  arma_extra_debug_sigprint();
   
-  const uword Y_offset = n_rows_base * n_cols;
+  typedef std::complex<T> eT;
   
-  for(uword col = 0; col < n_cols_base; col += block_size)
+  const uword N = out.n_rows;
+  
+  const uword block_size = 64;
+  
+  const uword n_blocks = (N / block_size) + ( ((N % block_size) != 0) ? 1 : 0 );
+  
+  eT* mem = out.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    const int  n_threads = mp_thread_limit::get();
+    const bool use_mp    = mp_gate<eT>::eval(out.n_elem);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static,1) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword bj = 0; bj < n_blocks; ++bj)
     {
-    const uword X_offset = col * n_rows;
+    const uword col_start = bj * block_size;
+    const uword col_endp1 = (std::min)(col_start + block_size, N);
     
-    op_htrans::block_worker(&Y[col + Y_offset], &X[n_rows_base + X_offset], n_rows, n_cols, n_rows_extra, block_size);
+    for(uword bi = 0; bi <= bj; ++bi)
+      {
+      const uword row_start = bi * block_size;
+      const uword row_endp1 = (std::min)(row_start + block_size, N);
+      
+      for(uword col = col_start; col < col_endp1; ++col)
+        {
+        const uword row_endp1_local = (bi == bj) ? col : row_endp1;
+        
+        eT* colptr = &(mem[col * N]);
+        
+        for(uword row = row_start; row < row_endp1_local; ++row)
+          {
+          const eT val1 = std::conj(colptr[row]);
+          const eT val2 = std::conj(mem[col + row*N]);
+          
+          mem[col + row*N] = val1;
+          colptr[row]      = val2;
+          }
+        
+        if(bi == bj)  { colptr[col] = std::conj(colptr[col]); }
+        }
+      }
     }
-  
-  const uword X_offset = n_cols_base * n_rows;
-  
-  op_htrans::block_worker(&Y[n_cols_base + Y_offset], &X[n_rows_base + X_offset], n_rows, n_cols, n_rows_extra, n_cols_extra);
   }
 
 
@@ -184,6 +263,13 @@ op_htrans::apply_mat_inplace(Mat<eT>& out, const typename arma_cx_only<eT>::resu
   const uword n_rows = out.n_rows;
   const uword n_cols = out.n_cols;
     
+  if( (n_rows == n_cols) && (n_rows >= 512) )
+    {
+    arma_extra_debug_print("doing blocked in-place hermitian transpose of a square matrix");
+    
+    op_htrans::apply_mat_inplace_large(out);
+    }
+  else
   if(n_rows == n_cols)
     {
     arma_extra_debug_print("doing in-place hermitian transpose of a square matrix");
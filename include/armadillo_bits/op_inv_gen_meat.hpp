@@ -151,6 +151,15 @@ op_inv_gen_full::apply_direct(Mat<typename T1::elem_type>& out, const Base<typen
   
   arma_debug_check( (out.is_square() == false), caller_sig, ": given matrix must be square sized", [&](){ out.soft_reset(); } );
   
+  // structure hint set by the user, carried over from expr, as out is a copy of expr at this point
+  
+  uword KL = 0;
+  uword KU = 0;
+  
+  const struct_hint hint = (is_Mat<T1>::value) ? out.get_hint(KL, KU) : struct_hint::none;
+  
+  const bool has_hint = (hint != struct_hint::none);
+  
   const uword N = out.n_rows;
   
   if(N == 0)  { return true; }
@@ -183,7 +192,7 @@ op_inv_gen_full::apply_direct(Mat<typename T1::elem_type>& out, const Base<typen
     // fallthrough if optimisation failed
     }
   
-  if(is_op_diagmat<T1>::value || out.is_diagmat())
+  if(is_op_diagmat<T1>::value || ((has_hint == false) && out.is_diagmat()))
     {
     arma_extra_debug_print("op_inv_gen_full: detected diagonal matrix");
     
@@ -211,15 +220,18 @@ op_inv_gen_full::apply_direct(Mat<typename T1::elem_type>& out, const Base<typen
   const bool is_triu_expr = strip.do_triu;
   const bool is_tril_expr = strip.do_tril;
   
-  const bool is_triu_mat = (is_triu_expr || is_tril_expr) ? false : (                        trimat_helper::is_triu(out));
-  const bool is_tril_mat = (is_triu_expr || is_tril_expr) ? false : ((is_triu_mat) ? false : trimat_helper::is_tril(out));
+  const bool hint_triu = (hint == struct_hint::triu) || ((hint == struct_hint::band) && (KL == 0));
+  const bool hint_tril = (hint == struct_hint::tril) || ((hint == struct_hint::band) && (KU == 0));
+  
+  const bool is_triu_mat = (is_triu_expr || is_tril_expr) ? false : (                        (has_hint ? hint_triu : trimat_helper::is_triu(out)));
+  const bool is_tril_mat = (is_triu_expr || is_tril_expr) ? false : ((is_triu_mat) ? false : (has_hint ? hint_tril : trimat_helper::is_tril(out)));
   
   if(is_triu_expr || is_tril_expr || is_triu_mat || is_tril_mat)
     {
     return auxlib::inv_tr(out, ((is_triu_expr || is_triu_mat) ? uword(0) : uword(1)));
     }
   
-  const bool try_sympd = arma_config::optimise_sym && sym_helper::guess_sympd(out);
+  const bool try_sympd = arma_config::optimise_sym && ((hint == struct_hint::sympd) || sym_helper::guess_sympd(out));
   
   if(try_sympd)
     {
@@ -346,7 +358,14 @@ op_inv_gen_rcond::apply_direct(Mat<typename T1::elem_type>& out, op_inv_gen_stat
   
   arma_debug_check( (out.is_square() == false), "inv(): given matrix must be square sized", [&](){ out.soft_reset(); } );
   
-  if(is_op_diagmat<T1>::value || out.is_diagmat())
+  uword KL = 0;
+  uword KU = 0;
+  
+  const struct_hint hint = (is_Mat<T1>::value) ? out.get_hint(KL, KU) : struct_hint::none;
+  
+  const bool has_hint = (hint != struct_hint::none);
+  
+  if(is_op_diagmat<T1>::value || ((has_hint == false) && out.is_diagmat()))
     {
     arma_extra_debug_print("op_inv_gen_rcond: detected diagonal matrix");
     
@@ -389,15 +408,18 @@ op_inv_gen_rcond::apply_direct(Mat<typename T1::elem_type>& out, op_inv_gen_stat
   const bool is_triu_expr = strip.do_triu;
   const bool is_tril_expr = strip.do_tril;
   
-  const bool is_triu_mat = (is_triu_expr || is_tril_expr) ? false : (                        trimat_helper::is_triu(out));
-  const bool is_tril_mat = (is_triu_expr || is_tril_expr) ? false : ((is_triu_mat) ? false : trimat_helper::is_tril(out));
+  const bool hint_triu = (hint == struct_hint::triu) || ((hint == struct_hint::band) && (KL == 0));
+  const bool hint_tril = (hint == struct_hint::tril) || ((hint == struct_hint::band) && (KU == 0));
+  
+  const bool is_triu_mat = (is_triu_expr || is_tril_expr) ? false : (                        (has_hint ? hint_triu : trimat_helper::is_triu(out)));
+  const bool is_tril_mat = (is_triu_expr || is_tril_expr) ? false : ((is_triu_mat) ? false : (has_hint ? hint_tril : trimat_helper::is_tril(out)));
   
   if(is_triu_expr || is_tril_expr || is_triu_mat || is_tril_mat)
     {
     return auxlib::inv_tr_rcond(out, out_state.rcond, ((is_triu_expr || is_triu_mat) ? uword(0) : uword(1)));
     }
   
-  const bool try_sympd = arma_config::optimise_sym && ((auxlib::crippled_lapack(out)) ? false : sym_helper::guess_sympd(out));
+  const bool try_sympd = arma_config::optimise_sym && ((auxlib::crippled_lapack(out)) ? false : ((hint == struct_hint::sympd) || sym_helper::guess_sympd(out)));
   
   if(try_sympd)
     {
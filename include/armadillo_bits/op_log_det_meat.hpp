@@ -29,7 +29,7 @@ op_log_det::apply_direct(typename T1::elem_type& out_val, typename T1::pod_type&
   arma_extra_debug_sigprint();
   
   typedef typename T1::elem_type eT;
-  // typedef typename T1::pod_type   T;
+  typedef typename T1::pod_type   T;
   
   if(strip_diagmat<T1>::do_diagmat)
     {
@@ -49,6 +49,37 @@ op_log_det::apply_direct(typename T1::elem_type& out_val, typename T1::pod_type&
   
   arma_debug_check( (A.is_square() == false), "log_det(): given matrix must be square sized" );
   
+  // structure hint set by the user, carried over from expr
+  
+  uword KL = 0;
+  uword KU = 0;
+  
+  const struct_hint hint = A.get_hint(KL, KU);
+  
+  if(hint != struct_hint::none)
+    {
+    const bool hint_trimat = (hint == struct_hint::triu) || (hint == struct_hint::tril) || ((hint == struct_hint::band) && ((KL == 0) || (KU == 0)));
+    
+    if(hint_trimat)  { return op_log_det::apply_trimat(out_val, out_sign, A); }
+    
+    if(hint == struct_hint::sympd)
+      {
+      arma_extra_debug_print("op_log_det::apply_direct(): sympd hint");
+      
+      T val = T(0);
+      
+      const bool status = auxlib::log_det_sympd(val, A);
+      
+      if(status)  { out_val = eT(val); out_sign = T(1); return true; }
+      
+      arma_extra_debug_print("op_log_det::apply_direct(): auxlib::log_det_sympd() failed; retrying");
+      
+      A = expr.get_ref();
+      }
+    
+    return auxlib::log_det(out_val, out_sign, A);
+    }
+  
   if(A.is_diagmat())  { return op_log_det::apply_diagmat(out_val, out_sign, A); }
   
   const bool is_triu =                   trimat_helper::is_triu(A);
@@ -97,6 +97,23 @@ op_mean::apply_noalias_unwrap(Mat<typename T1::elem_type>& out, const Proxy<T1>&
     
     eT* out_mem = out.memptr();
     
+    #if defined(ARMA_USE_OPENMP)
+      {
+      if( (X_n_cols > 1) && mp_gate<eT>::eval(X.n_elem) )
+        {
+        const int n_threads = mp_thread_limit::get();
+        
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword col=0; col < X_n_cols; ++col)
+          {
+          out_mem[col] = op_mean::direct_mean( X.colptr(col), X_n_rows );
+          }
+        
+        return;
+        }
+      }
+    #endif
+    
     for(uword col=0; col < X_n_cols; ++col)
       {
       out_mem[col] = op_mean::direct_mean( X.colptr(col), X_n_rows );
@@ -391,7 +408,7 @@ op_mean::direct_mean(const eT* const X, const uword n_elem)
   
   typedef typename get_pod_type<eT>::result T;
   
-  const eT result = arrayops::accumulate(X, n_elem) / T(n_elem);
+  const eT result = arrayops::accumulate_mp(X, n_elem) / T(n_elem);
   
   return arma_isfinite(result) ? result : op_mean::direct_mean_robust(X, n_elem);
   }
@@ -43,11 +43,18 @@ op_nonzeros::apply_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P)
     {
     typename Proxy<T1>::ea_type Pea = P.get_ea();
     
-    for(uword i=0; i<N_max; ++i)
+    if(op_find::use_mp<eT>(N_max))
       {
-      const eT val = Pea[i];
-      
-      if(val != eT(0))  { tmp_mem[N_nz] = val; ++N_nz; }
+      N_nz = op_find::helper_mp(tmp_mem, N_max, [&](eT& dest, const uword i) -> bool { const eT val = Pea[i]; dest = val; return (val != eT(0)); });
+      }
+    else
+      {
+      for(uword i=0; i<N_max; ++i)
+        {
+        const eT val = Pea[i];
+        
+        if(val != eT(0))  { tmp_mem[N_nz] = val; ++N_nz; }
+        }
       }
     }
   else
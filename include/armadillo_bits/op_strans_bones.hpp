@@ -48,15 +48,30 @@ class op_strans
   template<typename eT>
   arma_hot inline static void block_worker(eT* Y, const eT* X, const uword X_n_rows, const uword Y_n_rows, const uword n_rows, const uword n_cols);
   
+  template<typename eT>
+  arma_hot inline static void stripe_worker(eT* Y, const eT* X, const uword n_rows, const uword n_cols, const uword row, const uword stripe_n_rows);
+  
   template<typename eT>
   arma_hot inline static void apply_mat_noalias_large(Mat<eT>& out, const Mat<eT>& A);
   
   template<typename eT, typename TA>
   arma_hot inline static void apply_mat_noalias(Mat<eT>& out, const TA& A);
   
+  template<typename eT>
+  arma_hot inline static void apply_mat_inplace_large(Mat<eT>& out);
+  
   template<typename eT>
   arma_hot inline static void apply_mat_inplace(Mat<eT>& out);
   
+  template<typename eT>
+  inline static void rect_rows_worker(eT* X, const uword m, const uword n, const uword a, const bool final_step, const uword row_start, const uword row_endp1);
+  
+  template<typename eT>
+  inline static void rect_cols_worker(eT* X, const uword m, const uword n, const uword a, const uword g, const uword col_start, const uword col_endp1);
+  
+  template<typename eT>
+  inline static void apply_mat_inplace_rect(Mat<eT>& out);
+  
   template<typename eT, typename TA>
   inline static void apply_mat(Mat<eT>& out, const TA& A);
   
@@ -116,6 +116,35 @@ op_strans::block_worker(eT* Y, const eT* X, const uword X_n_rows, const uword Y_
 
 
 
+//! transpose of a horizontal stripe of X (rows row ... row+stripe_n_rows-1), one block at a time
+template<typename eT>
+inline
+void
+op_strans::stripe_worker(eT* Y, const eT* X, const uword n_rows, const uword n_cols, const uword row, const uword stripe_n_rows)
+  {
+  const uword block_size = 64;
+  
+  const uword n_cols_base  = block_size * (n_cols / block_size);
+  const uword n_cols_extra = n_cols - n_cols_base;
+  
+  const uword Y_offset = row * n_cols;
+  
+  for(uword col = 0; col < n_cols_base; col += block_size)
+    {
+    const uword X_offset = col * n_rows;
+    
+    op_strans::block_worker(&Y[col + Y_offset], &X[row + X_offset], n_rows, n_cols, stripe_n_rows, block_size);
+    }
+  
+  if(n_cols_extra == 0)  { return; }
+  
+  const uword X_offset = n_cols_base * n_rows;
+  
+  op_strans::block_worker(&Y[n_cols_base + Y_offset], &X[row + X_offset], n_rows, n_cols, stripe_n_rows, n_cols_extra);
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -128,45 +157,38 @@ op_strans::apply_mat_noalias_large(Mat<eT>& out, const Mat<eT>& A)
   
   const uword block_size = 64;
   
-  const uword n_rows_base = block_size * (n_rows / block_size);
-  const uword n_cols_base = block_size * (n_cols / block_size);
-  
-  const uword n_rows_extra = n_rows - n_rows_base;
-  const uword n_cols_extra = n_cols - n_cols_base;
+  const uword n_stripes = (n_rows / block_size) + ( ((n_rows % block_size) != 0) ? 1 : 0 );
   
   const eT* X =   A.memptr();
         eT* Y = out.memptr();
   
-  for(uword row = 0; row < n_rows_base; row += block_size)
+  // each stripe of X is written to a separate set of columns in Y
+  
+  #if defined(ARMA_USE_OPENMP)
     {
-    const uword Y_offset = row * n_cols;
-    
-    for(uword col = 0; col < n_cols_base; col += block_size)
+    if(mp_gate<eT>::eval(A.n_elem))
       {
-      const uword X_offset = col * n_rows;
+      const int n_threads = mp_thread_limit::get();
       
-      op_strans::block_worker(&Y[col + Y_offset], &X[row + X_offset], n_rows, n_cols, block_size, block_size);
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword stripe = 0; stripe < n_stripes; ++stripe)
+        {
+        const uword row = stripe * block_size;
+        
+        op_strans::stripe_worker(Y, X, n_rows, n_cols, row, (std::min)(block_size, n_rows - row));
+        }
+      
+      return;
       }
-    
-    const uword X_offset = n_cols_base * n_rows;
-    
-    op_strans::block_worker(&Y[n_cols_base + Y_offset], &X[row + X_offset], n_rows, n_cols, block_size, n_cols_extra);
     }
-
-  if(n_rows_extra == 0)  { return; }
-  
-  const uword Y_offset = n_rows_base * n_cols;
+  #endif
   
-  for(uword col = 0; col < n_cols_base; col += block_size)
+  for(uword stripe = 0; stripe < n_stripes; ++stripe)
     {
-    const uword X_offset = col * n_rows;
+    const uword row = stripe * block_size;
     
-    op_strans::block_worker(&Y[col + Y_offset], &X[n_rows_base + X_offset], n_rows, n_cols, n_rows_extra, block_size);
+    op_strans::stripe_worker(Y, X, n_rows, n_cols, row, (std::min)(block_size, n_rows - row));
     }
-  
-  const uword X_offset = n_cols_base * n_rows;
-  
-  op_strans::block_worker(&Y[n_cols_base + Y_offset], &X[n_rows_base + X_offset], n_rows, n_cols, n_rows_extra, n_cols_extra);
   }
 
 
@@ -228,6 +250,60 @@ op_strans::apply_mat_noalias(Mat<eT>& out, const TA& A)
 
 
 
+//! blocked in-place transpose of a large square matrix;
+//! each block above the diagonal is swapped with the transpose of its mirror block below the diagonal
+template<typename eT>
+inline
+void
+op_strans::apply_mat_inplace_large(Mat<eT>& out)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = out.n_rows;
+  
+  const uword block_size = 64;
+  
+  const uword n_blocks = (N / block_size) + ( ((N % block_size) != 0) ? 1 : 0 );
+  
+  eT* mem = out.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    const int  n_threads = mp_thread_limit::get();
+    const bool use_mp    = mp_gate<eT>::eval(out.n_elem);
+  #endif
+  
+  // block column bj has (bj+1) blocks to process, so the block columns are dealt out round-robin
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static,1) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword bj = 0; bj < n_blocks; ++bj)
+    {
+    const uword col_start = bj * block_size;
+    const uword col_endp1 = (std::min)(col_start + block_size, N);
+    
+    for(uword bi = 0; bi <= bj; ++bi)
+      {
+      const uword row_start = bi * block_size;
+      const uword row_endp1 = (std::min)(row_start + block_size, N);
+      
+      for(uword col = col_start; col < col_endp1; ++col)
+        {
+        const uword row_endp1_local = (bi == bj) ? col : row_endp1;
+        
+        eT* colptr = &(mem[col * N]);
+        
+        for(uword row = row_start; row < row_endp1_local; ++row)
+          {
+          std::swap( colptr[row], mem[col + row*N] );
+          }
+        }
+      }
+    }
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -238,6 +314,13 @@ op_strans::apply_mat_inplace(Mat<eT>& out)
   const uword n_rows = out.n_rows;
   const uword n_cols = out.n_cols;
   
+  if( (n_rows == n_cols) && (n_rows >= 512) )
+    {
+    arma_extra_debug_print("op_strans::apply(): doing blocked in-place transpose of a square matrix");
+    
+    op_strans::apply_mat_inplace_large(out);
+    }
+  else
   if(n_rows == n_cols)
     {
     arma_extra_debug_print("op_strans::apply(): doing in-place transpose of a square matrix");
@@ -278,6 +361,189 @@ op_strans::apply_mat_inplace(Mat<eT>& out)
 
 
 
+//! row operations for op_strans::apply_mat_inplace_rect(), for rows row_start ... row_endp1-1;
+//! first step:  each row i is rotated to the right by i/a positions;
+//! final step:  each element is gathered into its final column
+template<typename eT>
+inline
+void
+op_strans::rect_rows_worker(eT* X, const uword m, const uword n, const uword a, const bool final_step, const uword row_start, const uword row_endp1)
+  {
+  // a few rows are processed at the same time, so that memory is read in contiguous pieces
+  
+  const uword block_n_rows = (std::max)( uword(1), uword(128 / sizeof(eT)) );
+  
+  podarray<eT> tmp(block_n_rows * n);
+  
+  eT* tmp_mem = tmp.memptr();
+  
+  for(uword block_start = row_start; block_start < row_endp1; block_start += block_n_rows)
+    {
+    const uword block_endp1 = (std::min)(block_start + block_n_rows, row_endp1);
+    const uword block_len   = block_endp1 - block_start;
+    
+    for(uword col = 0; col < n; ++col)
+      {
+      arrayops::copy( &(tmp_mem[col * block_len]), &(X[block_start + col*m]), block_len );
+      }
+    
+    for(uword col = 0; col < n; ++col)
+      {
+      eT* X_colptr = &(X[col*m]);
+      
+      for(uword row = block_start; row < block_endp1; ++row)
+        {
+        uword src_col;
+        
+        if(final_step == false)
+          {
+          const uword q = row / a;
+          
+          src_col = (col >= q) ? (col - q) : (col + n - q);
+          }
+        else
+          {
+          const uword k = row + col*m;
+          const uword i = k / n;
+          const uword j = k - i*n;
+          const uword q = i / a;
+          
+          src_col = ((j + q) < n) ? (j + q) : (j + q - n);
+          }
+        
+        X_colptr[row] = tmp_mem[(row - block_start) + src_col * block_len];
+        }
+      }
+    }
+  }
+
+
+
+//! column operations for op_strans::apply_mat_inplace_rect();
+//! each element is scattered into the row it occupies in the transposed matrix
+template<typename eT>
+inline
+void
+op_strans::rect_cols_worker(eT* X, const uword m, const uword n, const uword a, const uword g, const uword col_start, const uword col_endp1)
+  {
+  const uword b = n / g;
+  
+  podarray<eT> tmp(m);
+  
+  eT* tmp_mem = tmp.memptr();
+  
+  for(uword col = col_start; col < col_endp1; ++col)
+    {
+    eT* X_colptr = &(X[col*m]);
+    
+    for(uword i = 0; i < m; ++i)
+      {
+      const uword q = i / a;
+      const uword u = i - q*a;
+      const uword j = (col >= q) ? (col - q) : (col + n - q);
+      
+      const uword dest_row = ( (j % m) + g * ((u * b) % a) ) % m;
+      
+      tmp_mem[dest_row] = X_colptr[i];
+      }
+    
+    arrayops::copy(X_colptr, tmp_mem, m);
+    }
+  }
+
+
+
+//! in-place transpose of a non-square matrix, using O(max(n_rows,n_cols)) extra memory per thread.
+//! algorithm inspired by:
+//! Bryan Catanzaro, Alexander Keller, Michael Garland.
+//! A Decomposition for In-place Matrix Transposition.
+//! Proceedings of the 19th ACM SIGPLAN Symposium on Principles and Practice of Parallel Programming, pp. 193-206, 2014.
+//! 
+//! with g = gcd(m,n) and a = m/g, the transpose is split into three steps,
+//! each of which permutes the elements within rows or within columns only:
+//! (1) row i is rotated by i/a positions (only needed when g > 1),
+//! (2) each column is permuted so that every element is in its final row,
+//! (3) each row is permuted so that every element is in its final column
+template<typename eT>
+inline
+void
+op_strans::apply_mat_inplace_rect(Mat<eT>& out)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword m = out.n_rows;
+  const uword n = out.n_cols;
+  
+  // out.set_size() will check whether we can change the dimensions of out;
+  // out.set_size() will also reuse existing memory, as the number of elements hasn't changed
+  
+  out.set_size(n, m);
+  
+  if( (m <= 1) || (n <= 1) )  { return; }
+  
+  uword g = m;
+  uword h = n;
+  
+  while(h != 0)  { const uword tmp = g % h;  g = h;  h = tmp; }
+  
+  const uword a = m / g;
+  
+  eT* X = out.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(mp_gate<eT>::eval(out.n_elem))
+      {
+      const int   n_threads_max = mp_thread_limit::get();
+      const uword n_threads_use = (std::min)(uword(podarray_prealloc_n_elem::val), uword(n_threads_max));
+      
+      const uword row_chunk_size = m / n_threads_use;
+      const uword col_chunk_size = n / n_threads_use;
+      
+      if(g > 1)
+        {
+        #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+        for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+          {
+          const uword start = (thread_id+0) * row_chunk_size;
+          const uword endp1 = ((thread_id+1) == n_threads_use) ? m : ((thread_id+1) * row_chunk_size);
+          
+          op_strans::rect_rows_worker(X, m, n, a, false, start, endp1);
+          }
+        }
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = (thread_id+0) * col_chunk_size;
+        const uword endp1 = ((thread_id+1) == n_threads_use) ? n : ((thread_id+1) * col_chunk_size);
+        
+        op_strans::rect_cols_worker(X, m, n, a, g, start, endp1);
+        }
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = (thread_id+0) * row_chunk_size;
+        const uword endp1 = ((thread_id+1) == n_threads_use) ? m : ((thread_id+1) * row_chunk_size);
+        
+        op_strans::rect_rows_worker(X, m, n, a, true, start, endp1);
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  if(g > 1)  { op_strans::rect_rows_worker(X, m, n, a, false, 0, m); }
+  
+  op_strans::rect_cols_worker(X, m, n, a, g, 0, n);
+  
+  op_strans::rect_rows_worker(X, m, n, a, true, 0, m);
+  }
+
+
+
 template<typename eT, typename TA>
 inline
 void
@@ -100,6 +100,30 @@ op_sum::apply_noalias_unwrap(Mat<typename T1::elem_type>& out, const Proxy<T1>&
   
   if(dim == 0)
     {
+    if(X_n_cols == 1)
+      {
+      out_mem[0] = arrayops::accumulate_mp( X_colptr, X_n_rows );
+      
+      return;
+      }
+    
+    #if defined(ARMA_USE_OPENMP)
+      {
+      if(mp_gate<eT>::eval(X.n_elem))
+        {
+        const int n_threads = mp_thread_limit::get();
+        
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword col=0; col < X_n_cols; ++col)
+          {
+          out_mem[col] = arrayops::accumulate( X.colptr(col), X_n_rows );
+          }
+        
+        return;
+        }
+      }
+    #endif
+    
     for(uword col=0; col < X_n_cols; ++col)
       {
       out_mem[col] = arrayops::accumulate( X_colptr, X_n_rows );
@@ -109,6 +133,37 @@ op_sum::apply_noalias_unwrap(Mat<typename T1::elem_type>& out, const Proxy<T1>&
     }
   else
     {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      // each thread processes a separate block of rows
+      
+      if( mp_gate<eT>::eval(X.n_elem) && (X_n_rows >= uword(64)) )
+        {
+        const int   n_threads_max = mp_thread_limit::get();
+        const uword n_threads_use = (std::min)(X_n_rows / uword(32), uword(n_threads_max));
+        const uword chunk_size    = X_n_rows / n_threads_use;
+        
+        #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+        for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+          {
+          const uword start = (thread_id+0) * chunk_size;
+          const uword endp1 = ((thread_id+1) == n_threads_use) ? X_n_rows : ((thread_id+1) * chunk_size);
+          
+          const uword N = endp1 - start;
+          
+          arrayops::copy(&(out_mem[start]), &(X.colptr(0)[start]), N);
+          
+          for(uword col=1; col < X_n_cols; ++col)
+            {
+            arrayops::inplace_plus( &(out_mem[start]), &(X.colptr(col)[start]), N );
+            }
+          }
+        
+        return;
+        }
+      }
+    #endif
+    
     arrayops::copy(out_mem, X_colptr, X_n_rows);
     
     X_colptr += X_n_rows;
@@ -27,6 +27,15 @@ class op_unique
   {
   public:
   
+  template<typename eT>
+  arma_inline static bool use_hash(const uword n_elem);
+  
+  template<typename T1>
+  inline static bool apply_helper_hash(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const bool P_is_row, const typename arma_integral_only<typename T1::elem_type>::result* junk = nullptr);
+  
+  template<typename T1>
+  inline static bool apply_helper_hash(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const bool P_is_row, const typename arma_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
   template<typename T1>
   inline static bool apply_helper(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const bool P_is_row);
   
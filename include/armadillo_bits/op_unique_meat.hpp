@@ -22,6 +22,102 @@
 
 
 
+//! hash-based processing is used for integer elements, as these are typically IDs or categories with few unique values
+template<typename eT>
+arma_inline
+bool
+op_unique::use_hash(const uword n_elem)
+  {
+  return ( (is_non_integral<eT>::value == false) && (n_elem >= uword(4096)) );
+  }
+
+
+
+//! collect the unique values via hashing, followed by sorting only the unique values;
+//! returns false (leaving out unchanged) if the number of unique values is too large for hashing to be beneficial
+template<typename T1>
+inline
+bool
+op_unique::apply_helper_hash(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const bool P_is_row, const typename arma_integral_only<typename T1::elem_type>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword n_elem = P.get_n_elem();
+  
+  const uword max_n_unique = n_elem / uword(16);
+  
+  std::unordered_set<eT> values;
+  
+  if(Proxy<T1>::use_at == false)
+    {
+    typename Proxy<T1>::ea_type Pea = P.get_ea();
+    
+    for(uword i=0; i<n_elem; ++i)
+      {
+      values.insert(Pea[i]);
+      
+      if(values.size() > max_n_unique)  { return false; }
+      }
+    }
+  else
+    {
+    const uword n_rows = P.get_n_rows();
+    const uword n_cols = P.get_n_cols();
+    
+    for(uword col=0; col < n_cols; ++col)
+    for(uword row=0; row < n_rows; ++row)
+      {
+      values.insert(P.at(row,col));
+      
+      if(values.size() > max_n_unique)  { return false; }
+      }
+    }
+  
+  const uword N_unique = uword(values.size());
+  
+  Mat<eT> tmp;
+  
+  if(P_is_row)
+    {
+    tmp.set_size(1, N_unique);
+    }
+  else
+    {
+    tmp.set_size(N_unique, 1);
+    }
+  
+  std::copy( values.begin(), values.end(), tmp.begin() );
+  
+  arma_unique_comparator<eT> comparator;
+  
+  std::sort( tmp.begin(), tmp.end(), comparator );
+  
+  out.steal_mem(tmp);
+  
+  return true;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+op_unique::apply_helper_hash(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const bool P_is_row, const typename arma_real_or_cx_only<typename T1::elem_type>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(out);
+  arma_ignore(P);
+  arma_ignore(P_is_row);
+  arma_ignore(junk);
+  
+  return false;
+  }
+
+
+
 template<typename T1>
 inline
 bool
@@ -58,6 +154,11 @@ op_unique::apply_helper(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, co
     return true;
     }
   
+  if(op_unique::use_hash<eT>(n_elem))
+    {
+    if(op_unique::apply_helper_hash(out, P, P_is_row))  { return true; }
+    }
+  
   Mat<eT> X(n_elem, 1, arma_nozeros_indicator());
   
   eT* X_mem = X.memptr();
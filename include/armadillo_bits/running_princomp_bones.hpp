@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup running_princomp
+//! @{
+
+
+
+//! Class for principal component analysis of observations that arrive in batches.
+//! Each batch is merged into the current estimate, so the full history of observations does not need to be kept.
+//! Two modes are available:
+//! - all components:       mean and scatter matrix are merged exactly; components are obtained via eigen decomposition on demand
+//! - first n_components:   the truncated SVD of the centred observations is updated with each batch,
+//!                         optionally via randomised SVD; memory use is O(n_components * dimensionality)
+template<typename eT>
+class running_princomp
+  {
+  public:
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  inline ~running_princomp();
+  inline  running_princomp(const uword in_n_components = 0, const char* method = "std");
+  
+  template<typename T1> inline void operator() (const Base<eT,T1>& X);
+  
+  inline void reset();
+  
+  inline uword count() const;
+  
+  inline const Row<eT>& mean() const;
+  
+  inline const Mat<eT>& coeff();
+  inline const Col<T>&  latent();
+  
+  template<typename T1> inline Mat<eT> score(const Base<eT,T1>& X);
+  
+  
+  private:
+  
+  uword n_components = 0;
+  bool  randomised   = false;
+  bool  is_dirty     = false;
+  uword n_obs        = 0;
+  
+  Row<eT> r_mean;
+  Mat<eT> r_scatter;  // used when keeping all components: sum of outer products of centred observations
+  Mat<eT> r_basis;    // used when keeping first n_components: right singular vectors of the centred observations
+  Col<T>  r_sv;       // used when keeping first n_components: corresponding singular values
+  
+  Mat<eT> r_coeff;
+  Col<T>  r_latent;
+  
+  inline void update_all(const Mat<eT>& Xc, const Row<eT>& batch_mean);
+  inline void update_truncated(const Mat<eT>& Xc, const Row<eT>& batch_mean);
+  inline void finalise();
+  
+  inline static bool svd_right_rand(Mat<eT>& V, Col<T>& s, const Mat<eT>& M, const uword k);
+  };
+
+
+
+//! @}
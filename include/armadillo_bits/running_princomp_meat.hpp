@@ -0,0 +1,396 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup running_princomp
+//! @{
+
+
+
+template<typename eT>
+inline
+running_princomp<eT>::~running_princomp()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+running_princomp<eT>::running_princomp(const uword in_n_components, const char* method)
+  : n_components(in_n_components)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_supported_blas_type<eT>::value == false ));
+  
+  const char sig = (method != nullptr) ? method[0] : char(0);
+  
+  arma_debug_check( ((sig != 's') && (sig != 'r')), "running_princomp: unknown method specified" );
+  
+  randomised = (sig == 'r');
+  
+  if(randomised && (n_components == 0))  { arma_debug_warn_level(1, "running_princomp: method 'randomised' requires n_components > 0; using method 'std'"); randomised = false; }
+  }
+
+
+
+//! add a batch of observations; each row of X is one observation (as in princomp())
+template<typename eT>
+template<typename T1>
+inline
+void
+running_princomp<eT>::operator() (const Base<eT,T1>& X_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X_expr.get_ref());
+  const Mat<eT>& X     = U.M;
+  
+  if(X.n_rows == 0)  { return; }
+  
+  arma_debug_check( ((n_obs > 0) && (X.n_cols != r_mean.n_elem)), "running_princomp: dimensionality of given observations is inconsistent with previous observations" );
+  
+  if(X.internal_has_nonfinite())
+    {
+    arma_debug_warn_level(3, "running_princomp: given observations have non-finite elements; ignoring");
+    return;
+    }
+  
+  const Row<eT> batch_mean = sum(X, 0) / eT(X.n_rows);
+  
+  Mat<eT> Xc = X;
+  
+  Xc.each_row() -= batch_mean;
+  
+  if(n_components == 0)
+    {
+    update_all(Xc, batch_mean);
+    }
+  else
+    {
+    update_truncated(Xc, batch_mean);
+    }
+  
+  is_dirty = true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_princomp<eT>::update_all(const Mat<eT>& Xc, const Row<eT>& batch_mean)
+  {
+  arma_extra_debug_sigprint();
+  
+  // merge of scatter matrices as per:
+  // Chan, Golub, LeVeque. Updating formulae and a pairwise algorithm for computing sample variances.
+  // Technical Report STAN-CS-79-773, Stanford University, 1979.
+  
+  const uword n_old = n_obs;
+  const uword n_new = n_obs + Xc.n_rows;
+  
+  if(n_old == 0)
+    {
+    r_mean    = batch_mean;
+    r_scatter = Xc.t() * Xc;
+    }
+  else
+    {
+    const Row<eT> delta = batch_mean - r_mean;
+    
+    const T weight = T(n_old) * T(Xc.n_rows) / T(n_new);
+    
+    r_scatter += Xc.t() * Xc;
+    r_scatter += weight * (delta.t() * delta);
+    
+    r_mean += (T(Xc.n_rows) / T(n_new)) * delta;
+    }
+  
+  n_obs = n_new;
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_princomp<eT>::update_truncated(const Mat<eT>& Xc, const Row<eT>& batch_mean)
+  {
+  arma_extra_debug_sigprint();
+  
+  // incremental SVD as per:
+  // Ross, Lim, Lin, Yang. Incremental learning for robust visual tracking.
+  // International Journal of Computer Vision, Vol. 77, 2008.
+  
+  const uword n_old = n_obs;
+  const uword n_new = n_obs + Xc.n_rows;
+  
+  Mat<eT> M;
+  
+  if(n_old == 0)
+    {
+    M = Xc;
+    }
+  else
+    {
+    // stack the current components (weighted by singular values), the centred batch,
+    // and a correction for the shift in the mean
+    
+    const uword n_cur = r_sv.n_elem;
+    
+    M.set_size(n_cur + Xc.n_rows + 1, Xc.n_cols);
+    
+    if(n_cur > 0)  { M.head_rows(n_cur) = diagmat(r_sv) * r_basis.t(); }
+    
+    M.rows(n_cur, n_cur + Xc.n_rows - 1) = Xc;
+    
+    M.tail_rows(1) = std::sqrt( T(n_old) * T(Xc.n_rows) / T(n_new) ) * (batch_mean - r_mean);
+    }
+  
+  Mat<eT> U;
+  Mat<eT> V;
+  Col<T>  s;
+  
+  // the randomised method is only worthwhile if the number of components is small compared to the size of M
+  
+  const uword M_min_dim = (std::min)(M.n_rows, M.n_cols);
+  
+  const bool use_rand = randomised && ( (uword(2) * (n_components + uword(10))) < M_min_dim );
+  
+  const bool status = (use_rand) ? svd_right_rand(V, s, M, n_components) : svd_econ(U, s, V, M, "right");
+  
+  if(status == false)  { arma_stop_runtime_error("running_princomp: decomposition failed"); return; }
+  
+  const uword n_keep = (std::min)(n_components, s.n_elem);
+  
+  r_basis = V.head_cols(n_keep);
+  r_sv    = s.head(n_keep);
+  
+  if(n_old == 0)
+    {
+    r_mean = batch_mean;
+    }
+  else
+    {
+    r_mean += (T(Xc.n_rows) / T(n_new)) * (batch_mean - r_mean);
+    }
+  
+  n_obs = n_new;
+  }
+
+
+
+//! top-k right singular vectors and singular values via randomised SVD, as per:
+//! Halko, Martinsson, Tropp. Finding structure with randomness: probabilistic algorithms for constructing approximate matrix decompositions.
+//! SIAM Review, Vol. 53, No. 2, 2011.
+template<typename eT>
+inline
+bool
+running_princomp<eT>::svd_right_rand(Mat<eT>& V, Col<T>& s, const Mat<eT>& M, const uword k)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_oversample = 10;
+  const uword n_power_iter = 2;
+  
+  const uword p = (std::min)( k + n_oversample, (std::min)(M.n_rows, M.n_cols) );
+  
+  Mat<eT> Q;
+  Mat<eT> R;
+  
+  Mat<eT> Z = M.t() * randn< Mat<eT> >(M.n_rows, p);
+  
+  if(qr_econ(Q, R, Z) == false)  { return false; }
+  
+  for(uword iter=0; iter < n_power_iter; ++iter)
+    {
+    Z = M.t() * (M * Q);
+    
+    if(qr_econ(Q, R, Z) == false)  { return false; }
+    }
+  
+  const Mat<eT> B = M * Q;
+  
+  Mat<eT> U;
+  Mat<eT> W;
+  
+  if(svd_econ(U, s, W, B, "right") == false)  { return false; }
+  
+  V = Q * W;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_princomp<eT>::finalise()
+  {
+  arma_extra_debug_sigprint();
+  
+  if(is_dirty == false)  { return; }
+  
+  if(n_components == 0)
+    {
+    const uword N = r_mean.n_elem;
+    
+    if(n_obs <= 1)
+      {
+      r_coeff.eye(N,N);
+      r_latent.zeros(N);
+      }
+    else
+      {
+      const Mat<eT> C = r_scatter / T(n_obs - 1);
+      
+      Col<T>  eigval;
+      Mat<eT> eigvec;
+      
+      const bool status = eig_sym(eigval, eigvec, C);
+      
+      if(status == false)  { arma_stop_runtime_error("running_princomp: decomposition failed"); return; }
+      
+      // eig_sym() provides eigenvalues in ascending order
+      
+      r_latent = reverse(eigval);
+      r_coeff  = fliplr(eigvec);
+      
+      T* r_latent_mem = r_latent.memptr();
+      
+      for(uword i=0; i < r_latent.n_elem; ++i)  { r_latent_mem[i] = (std::max)(T(0), r_latent_mem[i]); }
+      }
+    }
+  else
+    {
+    r_coeff = r_basis;
+    
+    if(n_obs <= 1)
+      {
+      r_latent.zeros(r_sv.n_elem);
+      }
+    else
+      {
+      r_latent = square(r_sv) / T(n_obs - 1);
+      }
+    }
+  
+  is_dirty = false;
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_princomp<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  is_dirty = false;
+  n_obs    = 0;
+  
+  r_mean.reset();
+  r_scatter.reset();
+  r_basis.reset();
+  r_sv.reset();
+  
+  r_coeff.reset();
+  r_latent.reset();
+  }
+
+
+
+//! number of observations so far
+template<typename eT>
+inline
+uword
+running_princomp<eT>::count() const
+  {
+  return n_obs;
+  }
+
+
+
+//! mean of the observations so far
+template<typename eT>
+inline
+const Row<eT>&
+running_princomp<eT>::mean() const
+  {
+  return r_mean;
+  }
+
+
+
+//! principal component coefficients (one component per column)
+template<typename eT>
+inline
+const Mat<eT>&
+running_princomp<eT>::coeff()
+  {
+  arma_extra_debug_sigprint();
+  
+  finalise();
+  
+  return r_coeff;
+  }
+
+
+
+//! eigenvalues of the principal components (variances along each component)
+template<typename eT>
+inline
+const Col<typename running_princomp<eT>::T>&
+running_princomp<eT>::latent()
+  {
+  arma_extra_debug_sigprint();
+  
+  finalise();
+  
+  return r_latent;
+  }
+
+
+
+//! project the given observations onto the principal components
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+running_princomp<eT>::score(const Base<eT,T1>& X_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  finalise();
+  
+  Mat<eT> X = X_expr.get_ref();
+  
+  arma_debug_check( (X.n_cols != r_mean.n_elem), "running_princomp::score(): dimensionality of given observations is inconsistent with previous observations" );
+  
+  X.each_row() -= r_mean;
+  
+  return X * r_coeff;
+  }
+
+
+
+//! @}
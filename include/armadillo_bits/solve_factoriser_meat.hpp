@@ -0,0 +1,300 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup solve_factoriser
+//! @{
+
+
+
+template<typename worker_type>
+inline
+void
+solve_factoriser::delete_worker()
+  {
+  arma_extra_debug_sigprint();
+  
+  if(worker_ptr != nullptr)
+    {
+    worker_type* ptr = reinterpret_cast<worker_type*>(worker_ptr);
+    
+    delete ptr;
+    
+    worker_ptr = nullptr;
+    }
+  }
+
+
+
+inline
+void
+solve_factoriser::cleanup()
+  {
+  arma_extra_debug_sigprint();
+  
+       if(elem_type_indicator == 1)  { delete_worker< dense_factoriser_worker<    float> >(); }
+  else if(elem_type_indicator == 2)  { delete_worker< dense_factoriser_worker<   double> >(); }
+  else if(elem_type_indicator == 3)  { delete_worker< dense_factoriser_worker< cx_float> >(); }
+  else if(elem_type_indicator == 4)  { delete_worker< dense_factoriser_worker<cx_double> >(); }
+  
+  worker_ptr          = nullptr;
+  elem_type_indicator = 0;
+  n_rows              = 0;
+  rcond_value         = double(0);
+  }
+
+
+
+inline
+solve_factoriser::~solve_factoriser()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  cleanup();
+  }
+
+
+
+inline
+solve_factoriser::solve_factoriser()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+inline
+void
+solve_factoriser::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  cleanup();
+  }
+
+
+
+inline
+double
+solve_factoriser::rcond() const
+  {
+  arma_extra_debug_sigprint();
+  
+  return rcond_value;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+solve_factoriser::factorise
+  (
+  const Base<typename T1::elem_type,T1>& A_expr,
+  const char*                            method,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::elem_type            eT;
+    typedef typename get_pod_type<eT>::result  T;
+    
+    typedef dense_factoriser_worker<eT> worker_type;
+    
+    const char sig1 = (method != nullptr) ? method[0] : char(0);
+    const char sig2 = (sig1   == 'l'    ) ? method[1] : char(0);
+    
+    uword method_id = 0;
+    
+         if( (sig1 == 'l') && (sig2 == 'u') )  { method_id = 1; }  // "lu"
+    else if( (sig1 == 'c')                  )  { method_id = 2; }  // "chol"
+    else if( (sig1 == 'l') && (sig2 == 'd') )  { method_id = 3; }  // "ldlt"
+    else if( (sig1 == 'q')                  )  { method_id = 4; }  // "qr"
+    
+    arma_debug_check( (method_id == 0), "solve_factoriser::factorise(): unknown method specified" );
+    
+    //
+    
+    cleanup();
+    
+    //
+    
+    Mat<eT> A(A_expr.get_ref());
+    
+    if( (method_id != 4) && (A.is_square() == false) )
+      {
+      arma_debug_warn_level(1, "solve_factoriser::factorise(): given matrix must be square sized for the specified method");
+      return false;
+      }
+    
+    if( (method_id == 4) && (A.n_rows < A.n_cols) )
+      {
+      arma_debug_warn_level(1, "solve_factoriser::factorise(): solving under-determined systems via QR is currently not supported");
+      return false;
+      }
+    
+    if( (method_id == 2) || (method_id == 3) )
+      {
+      if( (arma_config::debug) && (auxlib::rudimentary_sym_check(A) == false) )
+        {
+        if(is_cx<eT>::no )  { arma_debug_warn_level(1, "solve_factoriser::factorise(): given matrix is not symmetric"); }
+        if(is_cx<eT>::yes)  { arma_debug_warn_level(1, "solve_factoriser::factorise(): given matrix is not hermitian"); }
+        }
+      }
+    
+    n_rows = A.n_rows;
+    
+    //
+    
+    worker_ptr = new(std::nothrow) worker_type;
+    
+    if(worker_ptr == nullptr)
+      {
+      arma_debug_warn_level(3, "solve_factoriser::factorise(): could not construct worker object");
+      return false;
+      }
+    
+    //
+    
+         if(    is_float<eT>::value)  { elem_type_indicator = 1; }
+    else if(   is_double<eT>::value)  { elem_type_indicator = 2; }
+    else if( is_cx_float<eT>::value)  { elem_type_indicator = 3; }
+    else if(is_cx_double<eT>::value)  { elem_type_indicator = 4; }
+    
+    //
+    
+    worker_type* local_worker_ptr = reinterpret_cast<worker_type*>(worker_ptr);
+    worker_type& local_worker_ref = (*local_worker_ptr);
+    
+    //
+    
+    T local_rcond_value = T(0);
+    
+    const bool status = local_worker_ref.factorise(local_rcond_value, A, method_id);
+    
+    rcond_value = double(local_rcond_value);
+    
+    if( (status == false) || arma_isnan(local_rcond_value) || (local_rcond_value < std::numeric_limits<T>::epsilon()) )
+      {
+      arma_debug_warn_level(3, "solve_factoriser::factorise(): factorisation failed; rcond: ", local_rcond_value);
+      delete_worker<worker_type>();
+      return false;
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(A_expr);
+    arma_ignore(method);
+    arma_stop_logic_error("solve_factoriser::factorise(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename T1>
+inline
+bool
+solve_factoriser::solve
+  (
+         Mat<typename T1::elem_type>&    X,
+  const Base<typename T1::elem_type,T1>& B_expr,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::elem_type eT;
+    
+    typedef dense_factoriser_worker<eT> worker_type;
+    
+    if(worker_ptr == nullptr)
+      {
+      arma_debug_warn_level(2, "solve_factoriser::solve(): no factorisation available");
+      X.soft_reset();
+      return false;
+      }
+    
+    bool type_mismatch = false;
+    
+         if(    (is_float<eT>::value) && (elem_type_indicator != 1) )  { type_mismatch = true; }
+    else if(   (is_double<eT>::value) && (elem_type_indicator != 2) )  { type_mismatch = true; }
+    else if( (is_cx_float<eT>::value) && (elem_type_indicator != 3) )  { type_mismatch = true; }
+    else if((is_cx_double<eT>::value) && (elem_type_indicator != 4) )  { type_mismatch = true; }
+    
+    if(type_mismatch)
+      {
+      arma_debug_warn_level(1, "solve_factoriser::solve(): matrix type mismatch");
+      X.soft_reset();
+      return false;
+      }
+    
+    const quasi_unwrap<T1> U(B_expr.get_ref());
+    const Mat<eT>& B     = U.M;
+    
+    if(n_rows != B.n_rows)
+      {
+      arma_debug_warn_level(1, "solve_factoriser::solve(): matrix size mismatch");
+      X.soft_reset();
+      return false;
+      }
+    
+    const bool is_alias = U.is_alias(X);
+    
+    Mat<eT>  tmp;
+    Mat<eT>& out = is_alias ? tmp : X;
+    
+    worker_type* local_worker_ptr = reinterpret_cast<worker_type*>(worker_ptr);
+    worker_type& local_worker_ref = (*local_worker_ptr);
+    
+    const bool status = local_worker_ref.solve(out,B);
+    
+    if(is_alias)  { X.steal_mem(tmp); }
+    
+    if(status == false)
+      {
+      arma_debug_warn_level(3, "solve_factoriser::solve(): solution not found");
+      X.soft_reset();
+      return false;
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(B_expr);
+    arma_stop_logic_error("solve_factoriser::solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! @}
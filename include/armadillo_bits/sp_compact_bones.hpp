@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_compact
+//! @{
+
+
+//! Sparse matrix in compressed sparse column (CSC) format with 32-bit row indices.
+//! When uword is 64 bits, this halves the memory used by the row indices of SpMat,
+//! and reduces the memory traffic of multiplication with dense matrices and vectors.
+//! Other operations use a temporary SpMat, converted without sorting.
+template<typename eT>
+class sp_compact : public SpBase< eT, sp_compact<eT> >
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  static constexpr bool is_row  = false;
+  static constexpr bool is_col  = false;
+  static constexpr bool is_xvec = false;
+  
+  const uword n_rows;     //!< number of rows; must be less than 2^32
+  const uword n_cols;     //!< number of columns
+  const uword n_elem;     //!< number of elements (n_rows * n_cols)
+  const uword n_nonzero;  //!< number of non-zero elements
+  
+  const Col<eT>    values;       //!< non-zero values, stored column by column
+  const Col<u32>   row_indices;  //!< row index of each value
+  const Col<uword> col_ptrs;     //!< start of each column within values and row_indices; col_ptrs[n_cols] = n_nonzero
+  
+  inline ~sp_compact();
+  inline  sp_compact();
+  
+  inline            sp_compact(const sp_compact& x);
+  inline sp_compact& operator=(const sp_compact& x);
+  
+  template<typename T1> inline explicit    sp_compact(const SpBase<eT,T1>& expr);
+  template<typename T1> inline sp_compact& operator=(const SpBase<eT,T1>& expr);
+  
+  
+  private:
+  
+  inline void init(const SpMat<eT>& X);
+  };
+
+
+
+//! @}
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_compact
+//! @{
+
+
+
+template<typename eT>
+inline
+sp_compact<eT>::~sp_compact()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+sp_compact<eT>::sp_compact()
+  : n_rows   (0)
+  , n_cols   (0)
+  , n_elem   (0)
+  , n_nonzero(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  access::rw(col_ptrs).zeros(1);
+  }
+
+
+
+template<typename eT>
+inline
+sp_compact<eT>::sp_compact(const sp_compact<eT>& x)
+  : n_rows     (x.n_rows     )
+  , n_cols     (x.n_cols     )
+  , n_elem     (x.n_elem     )
+  , n_nonzero  (x.n_nonzero  )
+  , values     (x.values     )
+  , row_indices(x.row_indices)
+  , col_ptrs   (x.col_ptrs   )
+  {
+  arma_extra_debug_sigprint(arma_str::format("this = %x   x = %x") % this % &x);
+  }
+
+
+
+template<typename eT>
+inline
+sp_compact<eT>&
+sp_compact<eT>::operator=(const sp_compact<eT>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(this == &x)  { return *this; }
+  
+  access::rw(n_rows)    = x.n_rows;
+  access::rw(n_cols)    = x.n_cols;
+  access::rw(n_elem)    = x.n_elem;
+  access::rw(n_nonzero) = x.n_nonzero;
+  
+  access::rw(values)      = x.values;
+  access::rw(row_indices) = x.row_indices;
+  access::rw(col_ptrs)    = x.col_ptrs;
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+sp_compact<eT>::sp_compact(const SpBase<eT,T1>& expr)
+  : n_rows   (0)
+  , n_cols   (0)
+  , n_elem   (0)
+  , n_nonzero(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const unwrap_spmat<T1> U(expr.get_ref());
+  
+  (*this).init(U.M);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+sp_compact<eT>&
+sp_compact<eT>::operator=(const SpBase<eT,T1>& expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_spmat<T1> U(expr.get_ref());
+  
+  (*this).init(U.M);
+  
+  return *this;
+  }
+
+
+
+//! copy the CSC arrays of X; the elements are already sorted, so only the row indices are narrowed
+template<typename eT>
+inline
+void
+sp_compact<eT>::init(const SpMat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  X.sync();
+  
+  arma_check( (double(X.n_rows) > double(std::numeric_limits<u32>::max())), "sp_compact(): number of rows is too large for 32-bit row indices" );
+  
+  const uword nnz = X.n_nonzero;
+  
+  access::rw(values).set_size(nnz);
+  access::rw(row_indices).set_size(nnz);
+  access::rw(col_ptrs).set_size(X.n_cols + 1);
+  
+  arrayops::copy( access::rw(values).memptr(),   X.values,   nnz         );
+  arrayops::copy( access::rw(col_ptrs).memptr(), X.col_ptrs, X.n_cols + 1);
+  
+        u32*   out_row_indices = access::rw(row_indices).memptr();
+  const uword*   X_row_indices = X.row_indices;
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<u32>::eval(nnz);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword i=0; i < nnz; ++i)  { out_row_indices[i] = u32(X_row_indices[i]); }
+  
+  access::rw(n_rows)    = X.n_rows;
+  access::rw(n_cols)    = X.n_cols;
+  access::rw(n_elem)    = X.n_elem;
+  access::rw(n_nonzero) = nnz;
+  }
+
+
+
+//! @}
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_pattern
+//! @{
+
+
+//! Records where each of a list of (row, column) locations is stored in a sparse matrix,
+//! so that sparse matrices with the same sparsity pattern can be repeatedly assembled from new values
+//! without sorting, searching or synchronising the element cache.
+class sp_pattern
+  {
+  public:
+  
+  const uword n_rows;       //!< number of rows in assembled matrices
+  const uword n_cols;       //!< number of columns in assembled matrices
+  const uword n_nonzero;    //!< number of distinct locations
+  const uword n_locations;  //!< number of given locations, including repeated locations
+  
+  inline sp_pattern();
+  
+  template<typename T1>
+  inline sp_pattern(const Base<uword,T1>& locations, const uword in_n_rows, const uword in_n_cols);
+  
+  template<typename eT, typename T1>
+  inline void assemble(SpMat<eT>& out, const Base<eT,T1>& values) const;
+  
+  template<typename eT>
+  inline bool has_pattern(const SpMat<eT>& X) const;
+  
+  
+  private:
+  
+  arma_aligned Col<uword> row_indices;  //!< row indices of the distinct locations, in compressed sparse column order
+  arma_aligned Col<uword> col_ptrs;     //!< column pointers, in compressed sparse column format
+  arma_aligned Col<uword> order;        //!< indices of the given locations, sorted by storage slot
+  arma_aligned Col<uword> slot_ptrs;    //!< start of each storage slot within order; empty if there are no repeated locations
+  };
+
+
+
+//! @}
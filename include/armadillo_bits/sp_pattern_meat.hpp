@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_pattern
+//! @{
+
+
+
+inline
+sp_pattern::sp_pattern()
+  : n_rows     (0)
+  , n_cols     (0)
+  , n_nonzero  (0)
+  , n_locations(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  col_ptrs.zeros(1);
+  }
+
+
+
+//! locations is a 2xN matrix, with the row of the i-th location in locations(0,i) and the column in locations(1,i);
+//! repeated locations share a storage slot, and their values are added during assembly
+template<typename T1>
+inline
+sp_pattern::sp_pattern(const Base<uword,T1>& locations_expr, const uword in_n_rows, const uword in_n_cols)
+  : n_rows     (in_n_rows)
+  , n_cols     (in_n_cols)
+  , n_nonzero  (0)
+  , n_locations(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const quasi_unwrap<T1> U( locations_expr.get_ref() );
+  
+  const Mat<uword>& locs = U.M;
+  
+  arma_debug_check( ((locs.n_rows != 2) && (locs.n_elem > 0)), "sp_pattern(): locations matrix must have two rows" );
+  
+  const uword  N        = (locs.n_elem > 0) ? locs.n_cols : uword(0);
+  const uword* locs_mem = locs.memptr();
+  
+  // bucket the locations by column, using a stable counting sort
+  
+  col_ptrs.zeros(n_cols + 1);
+  
+  uword* col_ptrs_mem = col_ptrs.memptr();
+  
+  uword n_invalid = 0;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const uword row = locs_mem[2*i    ];
+    const uword col = locs_mem[2*i + 1];
+    
+    if( (row >= n_rows) || (col >= n_cols) )  { ++n_invalid; continue; }
+    
+    ++(col_ptrs_mem[col + 1]);
+    }
+  
+  arma_debug_check( (n_invalid > 0), "sp_pattern(): invalid row or column index" );
+  
+  arrayops::inplace_cumsum_mp(col_ptrs_mem, n_cols + 1);
+  
+  const uword N_valid = col_ptrs_mem[n_cols];
+  
+  podarray<uword> offsets(n_cols);
+  
+  arrayops::copy(offsets.memptr(), col_ptrs_mem, n_cols);
+  
+  order.set_size(N_valid);
+  
+  uword* order_mem = order.memptr();
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const uword row = locs_mem[2*i    ];
+    const uword col = locs_mem[2*i + 1];
+    
+    if( (row >= n_rows) || (col >= n_cols) )  { continue; }
+    
+    order_mem[ offsets[col] ] = i;
+    
+    ++(offsets[col]);
+    }
+  
+  // sort each column by row; the sort is stable, so values at repeated locations are added in the given order
+  
+  const auto row_less = [locs_mem](const uword a, const uword b) -> bool { return (locs_mem[2*a] < locs_mem[2*b]); };
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<uword>::eval(N_valid);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(dynamic,64) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword col=0; col < n_cols; ++col)
+    {
+    uword* col_start = &(order_mem[ col_ptrs_mem[col    ] ]);
+    uword* col_endp1 = &(order_mem[ col_ptrs_mem[col + 1] ]);
+    
+    if(std::is_sorted(col_start, col_endp1, row_less) == false)  { std::stable_sort(col_start, col_endp1, row_less); }
+    }
+  
+  // merge repeated locations into storage slots
+  
+  row_indices.set_size(N_valid);
+  slot_ptrs.set_size(N_valid + 1);
+  
+  uword* row_indices_mem = row_indices.memptr();
+  uword* slot_ptrs_mem   = slot_ptrs.memptr();
+  
+  uword n_slots = 0;
+  uword start   = 0;
+  
+  for(uword col=0; col < n_cols; ++col)
+    {
+    const uword endp1 = col_ptrs_mem[col + 1];
+    
+    for(uword k=start; k < endp1; ++k)
+      {
+      const uword row = locs_mem[ 2*order_mem[k] ];
+      
+      if( (k == start) || (row != row_indices_mem[n_slots-1]) )
+        {
+        row_indices_mem[n_slots] = row;
+        slot_ptrs_mem[n_slots]   = k;
+        
+        ++n_slots;
+        }
+      }
+    
+    col_ptrs_mem[col + 1] = n_slots;
+    
+    start = endp1;
+    }
+  
+  slot_ptrs_mem[n_slots] = N_valid;
+  
+  row_indices.resize(n_slots);
+  
+  if(n_slots == N_valid)  { slot_ptrs.reset(); }  else  { slot_ptrs.resize(n_slots + 1); }
+  
+  access::rw(n_nonzero)   = n_slots;
+  access::rw(n_locations) = N;
+  }
+
+
+
+//! set out to a sparse matrix with the recorded pattern, with the i-th value added into the slot of the i-th location;
+//! the structure of out is only written when it does not already have the recorded pattern
+template<typename eT, typename T1>
+inline
+void
+sp_pattern::assemble(SpMat<eT>& out, const Base<eT,T1>& values_expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U( values_expr.get_ref() );
+  
+  const Mat<eT>& vals = U.M;
+  
+  arma_debug_check( ((vals.is_vec() == false) && (vals.is_empty() == false)), "sp_pattern::assemble(): given 'values' object must be a vector" );
+  arma_debug_check( (vals.n_elem != n_locations), "sp_pattern::assemble(): number of values is different than number of locations" );
+  
+  // all values are overwritten, so any pending changes in the element cache can be discarded
+  
+  out.invalidate_cache();
+  
+  if(has_pattern(out) == false)
+    {
+    out.zeros(n_rows, n_cols);
+    
+    out.mem_resize(n_nonzero);
+    
+    arrayops::copy(access::rwp(out.row_indices), row_indices.memptr(), n_nonzero );
+    arrayops::copy(access::rwp(out.col_ptrs),    col_ptrs.memptr(),    n_cols + 1);
+    }
+  
+        eT*    out_values = access::rwp(out.values);
+  const eT*    vals_mem   = vals.memptr();
+  const uword* order_mem  = order.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<eT>::eval(n_nonzero);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  if(slot_ptrs.n_elem == 0)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+    #endif
+    for(uword slot=0; slot < n_nonzero; ++slot)
+      {
+      out_values[slot] = vals_mem[ order_mem[slot] ];
+      }
+    }
+  else
+    {
+    const uword* slot_ptrs_mem = slot_ptrs.memptr();
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+    #endif
+    for(uword slot=0; slot < n_nonzero; ++slot)
+      {
+      eT acc = eT(0);
+      
+      for(uword k=slot_ptrs_mem[slot]; k < slot_ptrs_mem[slot+1]; ++k)  { acc += vals_mem[ order_mem[k] ]; }
+      
+      out_values[slot] = acc;
+      }
+    }
+  }
+
+
+
+//! check whether the compressed sparse column structure of X is the recorded pattern
+template<typename eT>
+inline
+bool
+sp_pattern::has_pattern(const SpMat<eT>& X) const
+  {
+  arma_extra_debug_sigprint();
+  
+  X.sync_csc();
+  
+  if( (X.n_rows != n_rows) || (X.n_cols != n_cols) || (X.n_nonzero != n_nonzero) )  { return false; }
+  
+  const bool same_col_ptrs    = std::equal(X.col_ptrs,    X.col_ptrs    + (n_cols + 1), col_ptrs.memptr()   );
+  const bool same_row_indices = std::equal(X.row_indices, X.row_indices + n_nonzero,    row_indices.memptr());
+  
+  return (same_col_ptrs && same_row_indices);
+  }
+
+
+
+//! @}
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_reorder
+//! @{
+
+
+//! symmetric reorderings of sparse matrices;
+//! each ordering is a permutation vector p, to be applied as B = A(p,p) via symperm()
+class sp_reorder
+  {
+  public:
+  
+  template<typename eT> inline static void rcm(Col<uword>& out, const SpMat<eT>& A, const char* caller);
+  template<typename eT> inline static void amd(Col<uword>& out, const SpMat<eT>& A, const char* caller);
+  
+  template<typename eT> inline static void symperm(SpMat<eT>& out, const SpMat<eT>& A, const Col<uword>& p);
+  
+  
+  private:
+  
+  template<typename eT> inline static void adjacency(Col<uword>& adj_ptrs, Col<uword>& adj, const SpMat<eT>& A);
+  };
+
+
+
+//! @}
@@ -0,0 +1,562 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_reorder
+//! @{
+
+
+
+//! graph of the structure of A + A.t(), without self loops, in compressed form;
+//! the neighbours of vertex i are adj[ adj_ptrs[i] ] to adj[ adj_ptrs[i+1] - 1 ], sorted in ascending order
+template<typename eT>
+inline
+void
+sp_reorder::adjacency(Col<uword>& adj_ptrs, Col<uword>& adj, const SpMat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  A.sync();
+  
+  const uword N = A.n_cols;
+  
+  podarray<uword> ptrs_tmp(N+1);
+  
+  ptrs_tmp.zeros();
+  
+  uword* ptrs_tmp_mem = ptrs_tmp.memptr();
+  
+  for(uword col=0; col < N; ++col)
+  for(uword k=A.col_ptrs[col]; k < A.col_ptrs[col+1]; ++k)
+    {
+    const uword row = A.row_indices[k];
+    
+    if(row != col)  { ++(ptrs_tmp_mem[row + 1]); ++(ptrs_tmp_mem[col + 1]); }
+    }
+  
+  arrayops::inplace_cumsum_mp(ptrs_tmp_mem, N+1);
+  
+  podarray<uword> adj_tmp( ptrs_tmp_mem[N] );
+  podarray<uword> offsets(N);
+  
+  uword* adj_tmp_mem = adj_tmp.memptr();
+  uword* offsets_mem = offsets.memptr();
+  
+  arrayops::copy(offsets_mem, ptrs_tmp_mem, N);
+  
+  for(uword col=0; col < N; ++col)
+  for(uword k=A.col_ptrs[col]; k < A.col_ptrs[col+1]; ++k)
+    {
+    const uword row = A.row_indices[k];
+    
+    if(row != col)
+      {
+      adj_tmp_mem[ offsets_mem[row] ] = col;  ++(offsets_mem[row]);
+      adj_tmp_mem[ offsets_mem[col] ] = row;  ++(offsets_mem[col]);
+      }
+    }
+  
+  // an entry present in both A and A.t() appears twice
+  
+  adj_ptrs.set_size(N+1);
+  
+  uword* adj_ptrs_mem = adj_ptrs.memptr();
+  
+  adj_ptrs_mem[0] = 0;
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<uword>::eval(ptrs_tmp_mem[N]);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(dynamic,64) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword i=0; i < N; ++i)
+    {
+    uword* start = &(adj_tmp_mem[ ptrs_tmp_mem[i    ] ]);
+    uword* endp1 = &(adj_tmp_mem[ ptrs_tmp_mem[i + 1] ]);
+    
+    std::sort(start, endp1);
+    
+    adj_ptrs_mem[i+1] = uword( std::unique(start, endp1) - start );
+    }
+  
+  arrayops::inplace_cumsum_mp(adj_ptrs_mem, N+1);
+  
+  adj.set_size( adj_ptrs_mem[N] );
+  
+  uword* adj_mem = adj.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword i=0; i < N; ++i)
+    {
+    arrayops::copy( &(adj_mem[ adj_ptrs_mem[i] ]), &(adj_tmp_mem[ ptrs_tmp_mem[i] ]), adj_ptrs_mem[i+1] - adj_ptrs_mem[i] );
+    }
+  }
+
+
+
+//! reverse Cuthill-McKee ordering, which reduces the bandwidth of A(p,p);
+//! each connected component is ordered by a breadth-first search from a pseudo-peripheral vertex,
+//! visiting the neighbours of each vertex in order of increasing degree
+template<typename eT>
+inline
+void
+sp_reorder::rcm(Col<uword>& out, const SpMat<eT>& A, const char* caller)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), caller, ": given matrix must be square sized" );
+  
+  const uword N = A.n_rows;
+  
+  Col<uword> adj_ptrs;
+  Col<uword> adj;
+  
+  sp_reorder::adjacency(adj_ptrs, adj, A);
+  
+  const uword* adj_ptrs_mem = adj_ptrs.memptr();
+  const uword* adj_mem      = adj.memptr();
+  
+  out.set_size(N);
+  
+  uword* order = out.memptr();
+  
+  podarray<uword> degree(N);
+  podarray<uword> placed(N);
+  podarray<uword> mark(N);
+  podarray<uword> level_of(N);
+  podarray<uword> queue(N);
+  
+  for(uword i=0; i < N; ++i)  { degree[i] = adj_ptrs_mem[i+1] - adj_ptrs_mem[i]; }
+  
+  placed.zeros();
+  mark.zeros();
+  
+  uword stamp = 0;
+  
+  // breadth-first search over the vertices not yet placed;
+  // fills queue in visiting order and returns the number of visited vertices
+  
+  const auto bfs = [&](const uword root, uword& out_n_levels) -> uword
+    {
+    ++stamp;
+    
+    mark[root]     = stamp;
+    level_of[root] = 0;
+    queue[0]       = root;
+    
+    uword n_queued = 1;
+    
+    for(uword head=0; head < n_queued; ++head)
+      {
+      const uword u = queue[head];
+      
+      for(uword k=adj_ptrs_mem[u]; k < adj_ptrs_mem[u+1]; ++k)
+        {
+        const uword v = adj_mem[k];
+        
+        if( (placed[v] == 0) && (mark[v] != stamp) )
+          {
+          mark[v]     = stamp;
+          level_of[v] = level_of[u] + 1;
+          
+          queue[n_queued] = v;  ++n_queued;
+          }
+        }
+      }
+    
+    out_n_levels = level_of[ queue[n_queued-1] ] + 1;
+    
+    return n_queued;
+    };
+  
+  // candidate starting vertices, in order of increasing degree
+  
+  podarray<uword> by_degree(N);
+  podarray<uword> bucket_ptrs(N+1);
+  
+  bucket_ptrs.zeros();
+  
+  for(uword i=0; i < N; ++i)  { ++(bucket_ptrs[ degree[i] + 1 ]); }
+  
+  arrayops::inplace_cumsum_mp(bucket_ptrs.memptr(), N+1);
+  
+  for(uword i=0; i < N; ++i)  { by_degree[ bucket_ptrs[ degree[i] ] ] = i;  ++(bucket_ptrs[ degree[i] ]); }
+  
+  const auto degree_less = [&](const uword a, const uword b) -> bool { return (degree[a] < degree[b]); };
+  
+  uword n_placed = 0;
+  
+  for(uword s=0; s < N; ++s)
+    {
+    uword root = by_degree[s];
+    
+    if(placed[root] != 0)  { continue; }
+    
+    // find a pseudo-peripheral vertex in the component of root (George and Liu, 1979)
+    
+    uword n_levels = 0;
+    uword n_reach  = bfs(root, n_levels);
+    
+    for(;;)
+      {
+      uword candidate = queue[n_reach-1];
+      
+      for(uword k=n_reach; k > 0; --k)
+        {
+        const uword v = queue[k-1];
+        
+        if(level_of[v] != (n_levels-1))  { break; }
+        
+        if(degree[v] < degree[candidate])  { candidate = v; }
+        }
+      
+      uword candidate_n_levels = 0;
+      
+      n_reach = bfs(candidate, candidate_n_levels);
+      
+      if(candidate_n_levels <= n_levels)  { break; }
+      
+      root     = candidate;
+      n_levels = candidate_n_levels;
+      }
+    
+    // Cuthill-McKee ordering of the component
+    
+    placed[root]      = 1;
+    order[n_placed]   = root;
+    ++n_placed;
+    
+    for(uword head=n_placed-1; head < n_placed; ++head)
+      {
+      const uword u = order[head];
+      
+      const uword first = n_placed;
+      
+      for(uword k=adj_ptrs_mem[u]; k < adj_ptrs_mem[u+1]; ++k)
+        {
+        const uword v = adj_mem[k];
+        
+        if(placed[v] == 0)  { placed[v] = 1; order[n_placed] = v; ++n_placed; }
+        }
+      
+      std::stable_sort( &(order[first]), &(order[n_placed]), degree_less );
+      }
+    }
+  
+  std::reverse(order, order + N);
+  }
+
+
+
+//! approximate minimum degree ordering, which reduces the fill-in of Cholesky and LU factors of A(p,p).
+//! This follows the quotient graph approach of Amestoy, Davis and Duff (1996),
+//! with approximate external degrees and aggressive element absorption;
+//! supervariable detection and dense row handling are omitted.
+template<typename eT>
+inline
+void
+sp_reorder::amd(Col<uword>& out, const SpMat<eT>& A, const char* caller)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), caller, ": given matrix must be square sized" );
+  
+  const uword N = A.n_rows;
+  
+  out.set_size(N);
+  
+  if(N == 0)  { return; }
+  
+  Col<uword> adj_ptrs;
+  Col<uword> adj;
+  
+  sp_reorder::adjacency(adj_ptrs, adj, A);
+  
+  // quotient graph: for each variable, its adjacent variables and adjacent elements;
+  // for each element (an eliminated variable), the variables it contains
+  
+  std::vector< std::vector<uword> > var_adj(N);
+  std::vector< std::vector<uword> > elem_adj(N);
+  std::vector< std::vector<uword> > elem_vars(N);
+  
+  for(uword i=0; i < N; ++i)  { var_adj[i].assign( adj.memptr() + adj_ptrs[i], adj.memptr() + adj_ptrs[i+1] ); }
+  
+  adj.reset();
+  
+  // state: 0 = variable, 1 = element, 2 = absorbed element
+  
+  podarray<uword> state(N);
+  podarray<uword> degree(N);
+  podarray<uword> mark(N);
+  podarray<sword> w(N);
+  
+  state.zeros();
+  mark.zeros();
+  w.fill(sword(-1));
+  
+  // doubly linked list of variables for each degree
+  
+  const uword none = N;
+  
+  podarray<uword> head(N);
+  podarray<uword> next(N);
+  podarray<uword> prev(N);
+  
+  head.fill(none);
+  
+  uword min_degree = 0;
+  
+  const auto list_insert = [&](const uword i, const uword d)
+    {
+    degree[i] = d;
+    prev[i]   = none;
+    next[i]   = head[d];
+    
+    if(head[d] != none)  { prev[ head[d] ] = i; }
+    
+    head[d] = i;
+    
+    if(d < min_degree)  { min_degree = d; }
+    };
+  
+  const auto list_remove = [&](const uword i)
+    {
+    const uword d = degree[i];
+    
+    if(prev[i] != none)  { next[ prev[i] ] = next[i]; }  else  { head[d] = next[i]; }
+    if(next[i] != none)  { prev[ next[i] ] = prev[i]; }
+    };
+  
+  for(uword i=0; i < N; ++i)  { list_insert(i, uword(var_adj[i].size())); }
+  
+  std::vector<uword> touched;
+  
+  uword stamp = 0;
+  
+  for(uword k=0; k < N; ++k)
+    {
+    while(head[min_degree] == none)  { ++min_degree; }
+    
+    const uword p = head[min_degree];
+    
+    list_remove(p);
+    
+    out[k] = p;
+    
+    state[p] = 1;
+    
+    // the new element contains the variables adjacent to p, and the variables of the elements adjacent to p;
+    // those elements are absorbed into the new element
+    
+    ++stamp;
+    
+    mark[p] = stamp;
+    
+    std::vector<uword>& Lp = elem_vars[p];
+    
+    for(const uword v : var_adj[p])
+      {
+      if( (state[v] == 0) && (mark[v] != stamp) )  { mark[v] = stamp; Lp.push_back(v); }
+      }
+    
+    for(const uword e : elem_adj[p])
+      {
+      if(state[e] != 1)  { continue; }
+      
+      for(const uword v : elem_vars[e])
+        {
+        if( (state[v] == 0) && (mark[v] != stamp) )  { mark[v] = stamp; Lp.push_back(v); }
+        }
+      
+      state[e] = 2;
+      
+      std::vector<uword>().swap(elem_vars[e]);
+      }
+    
+    std::vector<uword>().swap(var_adj[p]);
+    std::vector<uword>().swap(elem_adj[p]);
+    
+    const uword n_live = N - k - 1;
+    const uword Lp_len = uword(Lp.size());
+    
+    // variables covered by the new element are no longer needed in the variable lists
+    
+    for(const uword i : Lp)
+      {
+      list_remove(i);
+      
+      std::vector<uword>& Ai = var_adj[i];
+      std::vector<uword>& Ei = elem_adj[i];
+      
+      uword count = 0;
+      
+      for(const uword v : Ai)  { if( (state[v] == 0) && (mark[v] != stamp) )  { Ai[count] = v; ++count; } }
+      
+      Ai.resize(count);
+      
+      count = 0;
+      
+      for(const uword e : Ei)  { if(state[e] == 1)  { Ei[count] = e; ++count; } }
+      
+      Ei.resize(count);
+      
+      Ei.push_back(p);
+      }
+    
+    // w(e) = |L_e \ L_p| for each element e adjacent to the new element
+    
+    for(const uword i : Lp)
+    for(const uword e : elem_adj[i])
+      {
+      if(e == p)  { continue; }
+      
+      if(w[e] < 0)
+        {
+        // drop variables eliminated since the element was formed
+        
+        std::vector<uword>& Le = elem_vars[e];
+        
+        uword count = 0;
+        
+        for(const uword v : Le)  { if(state[v] == 0)  { Le[count] = v; ++count; } }
+        
+        Le.resize(count);
+        
+        w[e] = sword(count);
+        
+        touched.push_back(e);
+        }
+      
+      --(w[e]);
+      }
+    
+    for(const uword i : Lp)
+      {
+      uword ext_degree = uword(var_adj[i].size()) + (Lp_len - 1);
+      
+      for(const uword e : elem_adj[i])
+        {
+        if( (e == p) || (state[e] != 1) )  { continue; }
+        
+        // an element contained in the new element is absorbed
+        if(w[e] == 0)  { state[e] = 2; std::vector<uword>().swap(elem_vars[e]); continue; }
+        
+        ext_degree += uword(w[e]);
+        }
+      
+      const uword d = (std::min)( (std::min)(ext_degree, degree[i] + (Lp_len - 1)), n_live - 1 );
+      
+      list_insert(i, d);
+      }
+    
+    for(const uword e : touched)  { w[e] = sword(-1); }
+    
+    touched.clear();
+    }
+  }
+
+
+
+//! out = A(p,p); each column is copied once and its row indices are mapped and sorted, without using the element cache
+template<typename eT>
+inline
+void
+sp_reorder::symperm(SpMat<eT>& out, const SpMat<eT>& A, const Col<uword>& p)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "symperm(): given matrix must be square sized" );
+  
+  const uword N = A.n_rows;
+  
+  arma_debug_check( (p.n_elem != N), "symperm(): number of elements in permutation vector must be the same as the number of rows in given matrix" );
+  
+  const uword* p_mem = p.memptr();
+  
+  // inverse permutation
+  
+  podarray<uword> q(N);
+  
+  uword* q_mem = q.memptr();
+  
+  arrayops::inplace_set(q_mem, N, N);
+  
+  bool is_permutation = true;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const uword j = p_mem[i];
+    
+    if( (j >= N) || (q_mem[j] != N) )  { is_permutation = false; break; }
+    
+    q_mem[j] = i;
+    }
+  
+  arma_debug_check( (is_permutation == false), "symperm(): given vector is not a permutation" );
+  
+  A.sync();
+  
+  out.reserve(N, N, A.n_nonzero);
+  
+  uword* out_col_ptrs    = access::rwp(out.col_ptrs);
+  uword* out_row_indices = access::rwp(out.row_indices);
+  eT*    out_values      = access::rwp(out.values);
+  
+  out_col_ptrs[0] = 0;
+  
+  for(uword j=0; j < N; ++j)  { out_col_ptrs[j+1] = A.col_ptrs[ p_mem[j] + 1 ] - A.col_ptrs[ p_mem[j] ]; }
+  
+  arrayops::inplace_cumsum_mp(out_col_ptrs, N+1);
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<eT>::eval(A.n_nonzero);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(dynamic,64) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword j=0; j < N; ++j)
+    {
+    const uword A_start = A.col_ptrs[ p_mem[j] ];
+    const uword start   = out_col_ptrs[j];
+    const uword length  = out_col_ptrs[j+1] - start;
+    
+    uword* rows = &(out_row_indices[start]);
+    eT*    vals = &(out_values     [start]);
+    
+    for(uword k=0; k < length; ++k)
+      {
+      rows[k] = q_mem[ A.row_indices[A_start + k] ];
+      vals[k] = A.values[A_start + k];
+      }
+    
+    uword n_duplicates = 0;
+    
+    SpMat<eT>::init_batch_col(rows, vals, length, false, false, n_duplicates);
+    }
+  }
+
+
+
+//! @}
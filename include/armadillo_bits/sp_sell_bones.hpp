@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_sell
+//! @{
+
+
+//! Sparse matrix in the SELL-C-sigma format, for fast repeated multiplication with dense vectors.
+//! Rows are sorted by length within windows of sigma rows, then grouped into chunks of C rows;
+//! each chunk is padded to its longest row and stored column by column,
+//! so that one chunk is processed with C independent accumulators;
+//! padding is skipped during multiplication, so non-finite values in x don't leak into other rows.
+template<typename eT>
+class sp_sell
+  {
+  public:
+  
+  typedef eT elem_type;
+  
+  static constexpr uword chunk_size = 8;  //!< rows per chunk (C)
+  
+  const uword n_rows;     //!< number of rows
+  const uword n_cols;     //!< number of columns
+  const uword n_nonzero;  //!< number of non-zero elements
+  const uword n_stored;   //!< number of stored elements, including padding
+  const uword n_chunks;   //!< number of chunks
+  const uword sigma;      //!< size of the row sorting window; a multiple of chunk_size
+  
+  inline sp_sell();
+  
+  template<typename T1>
+  inline explicit sp_sell(const SpBase<eT,T1>& expr, const uword in_sigma = 256);
+  
+  template<typename T1>
+  inline void mul(Mat<eT>& out, const Base<eT,T1>& X) const;
+  
+  inline void mul_raw(eT* y, const eT* x) const;
+  
+  
+  private:
+  
+  arma_aligned Col<eT>    values;       //!< values of each chunk, stored column by column, padded with zeros
+  arma_aligned Col<uword> col_indices;  //!< column index of each stored value; zero for padding
+  arma_aligned Col<uword> chunk_ptrs;   //!< start of each chunk within values and col_indices
+  arma_aligned Col<uword> slot_lens;    //!< number of non-padding values in each row slot
+  arma_aligned Col<uword> perm;         //!< row of the matrix held by each row slot
+  };
+
+
+
+//! @}
@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_sell
+//! @{
+
+
+
+template<typename eT>
+inline
+sp_sell<eT>::sp_sell()
+  : n_rows   (0)
+  , n_cols   (0)
+  , n_nonzero(0)
+  , n_stored (0)
+  , n_chunks (0)
+  , sigma    (chunk_size)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  chunk_ptrs.zeros(1);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+sp_sell<eT>::sp_sell(const SpBase<eT,T1>& expr, const uword in_sigma)
+  : n_rows   (0)
+  , n_cols   (0)
+  , n_nonzero(0)
+  , n_stored (0)
+  , n_chunks (0)
+  , sigma    ( (std::max)(uword(1), (in_sigma + chunk_size - 1) / chunk_size) * chunk_size )
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const unwrap_spmat<T1> U(expr.get_ref());
+  
+  const SpMat<eT>& A = U.M;
+  
+  // row access is needed; use the CSR mirror of A if it already exists
+  
+  SpMat<eT> At;
+  
+  const eT*    A_values;
+  const uword* A_col_indices;
+  const uword* A_row_ptrs;
+  
+  if(A.has_csr())
+    {
+    const SpMat_csr<eT>& A_csr = A.csr();
+    
+    A_values      = A_csr.values;
+    A_col_indices = A_csr.col_indices;
+    A_row_ptrs    = A_csr.row_ptrs;
+    }
+  else
+    {
+    A.sync();
+    
+    spop_strans::apply_noalias(At, A);
+    
+    A_values      = At.values;
+    A_col_indices = At.row_indices;
+    A_row_ptrs    = At.col_ptrs;
+    }
+  
+  const uword C = chunk_size;
+  
+  const uword local_n_rows   = A.n_rows;
+  const uword local_n_chunks = (local_n_rows + C - 1) / C;
+  
+  access::rw(n_rows)    = local_n_rows;
+  access::rw(n_cols)    = A.n_cols;
+  access::rw(n_nonzero) = A.n_nonzero;
+  access::rw(n_chunks)  = local_n_chunks;
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<eT>::eval(A.n_nonzero);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  // sort rows by decreasing length within each window; the sort is stable, so rows of equal length keep their order
+  
+  perm.set_size(local_n_rows);
+  
+  uword* perm_mem = perm.memptr();
+  
+  const uword n_windows = (local_n_rows + sigma - 1) / sigma;
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword w=0; w < n_windows; ++w)
+    {
+    const uword start = w * sigma;
+    const uword endp1 = (std::min)(start + sigma, local_n_rows);
+    
+    for(uword row=start; row < endp1; ++row)  { perm_mem[row] = row; }
+    
+    std::stable_sort( &(perm_mem[start]), &(perm_mem[endp1]), [A_row_ptrs](const uword a, const uword b) -> bool
+      {
+      return ( (A_row_ptrs[a+1] - A_row_ptrs[a]) > (A_row_ptrs[b+1] - A_row_ptrs[b]) );
+      } );
+    }
+  
+  // each chunk is padded to the length of its first (longest) row
+  
+  chunk_ptrs.set_size(local_n_chunks + 1);
+  
+  uword* chunk_ptrs_mem = chunk_ptrs.memptr();
+  
+  chunk_ptrs_mem[0] = 0;
+  
+  for(uword k=0; k < local_n_chunks; ++k)
+    {
+    const uword row = perm_mem[k*C];
+    
+    chunk_ptrs_mem[k+1] = C * (A_row_ptrs[row+1] - A_row_ptrs[row]);
+    }
+  
+  arrayops::inplace_cumsum_mp(chunk_ptrs_mem, local_n_chunks + 1);
+  
+  const uword local_n_stored = chunk_ptrs_mem[local_n_chunks];
+  
+  access::rw(n_stored) = local_n_stored;
+  
+  values.set_size(local_n_stored);
+  col_indices.set_size(local_n_stored);
+  slot_lens.set_size(local_n_chunks * C);
+  
+  eT*    values_mem      = values.memptr();
+  uword* col_indices_mem = col_indices.memptr();
+  uword* slot_lens_mem   = slot_lens.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword k=0; k < local_n_chunks; ++k)
+    {
+    const uword chunk_start = chunk_ptrs_mem[k];
+    const uword chunk_len   = (chunk_ptrs_mem[k+1] - chunk_start) / C;
+    
+    for(uword i=0; i < C; ++i)
+      {
+      const uword slot = k*C + i;
+      
+      uword row_start = 0;
+      uword row_len   = 0;
+      
+      if(slot < local_n_rows)
+        {
+        const uword row = perm_mem[slot];
+        
+        row_start = A_row_ptrs[row];
+        row_len   = A_row_ptrs[row+1] - row_start;
+        }
+      
+      slot_lens_mem[slot] = row_len;
+      
+      for(uword j=0; j < chunk_len; ++j)
+        {
+        const uword pos = chunk_start + j*C + i;
+        
+        if(j < row_len)
+          {
+          values_mem[pos]      = A_values     [row_start + j];
+          col_indices_mem[pos] = A_col_indices[row_start + j];
+          }
+        else
+          {
+          values_mem[pos]      = eT(0);
+          col_indices_mem[pos] = 0;
+          }
+        }
+      }
+    }
+  }
+
+
+
+//! out = A * X, where each column of X is processed by mul_raw()
+template<typename eT>
+template<typename T1>
+inline
+void
+sp_sell<eT>::mul(Mat<eT>& out, const Base<eT,T1>& X_expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X_expr.get_ref());
+  
+  const Mat<eT>& X = U.M;
+  
+  arma_debug_assert_mul_size(n_rows, n_cols, X.n_rows, X.n_cols, "matrix multiplication");
+  
+  if(U.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    (*this).mul(tmp, X);
+    
+    out.steal_mem(tmp);
+    
+    return;
+    }
+  
+  out.set_size(n_rows, X.n_cols);
+  
+  for(uword col=0; col < X.n_cols; ++col)
+    {
+    (*this).mul_raw(out.colptr(col), X.colptr(col));
+    }
+  }
+
+
+
+//! y = A * x, where x has n_cols elements and y has n_rows elements; x and y must not overlap
+template<typename eT>
+inline
+void
+sp_sell<eT>::mul_raw(eT* y, const eT* x) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword C = chunk_size;
+  
+  const eT*    values_mem      = values.memptr();
+  const uword* col_indices_mem = col_indices.memptr();
+  const uword* chunk_ptrs_mem  = chunk_ptrs.memptr();
+  const uword* slot_lens_mem   = slot_lens.memptr();
+  const uword* perm_mem        = perm.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = (n_chunks >= 2) && (mp_thread_limit::in_parallel() == false) && mp_gate<eT>::eval(n_stored);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword k=0; k < n_chunks; ++k)
+    {
+    const uword chunk_start = chunk_ptrs_mem[k];
+    const uword chunk_len   = (chunk_ptrs_mem[k+1] - chunk_start) / C;
+    
+    const eT*    vals = &(values_mem[chunk_start]);
+    const uword* cols = &(col_indices_mem[chunk_start]);
+    
+    const uword* lens = &(slot_lens_mem[k*C]);
+    
+    eT acc[C];
+    
+    for(uword i=0; i < C; ++i)  { acc[i] = eT(0); }
+    
+    // the row slots within a chunk are sorted by decreasing length,
+    // so the slots holding a real value at position j form a prefix of length n_active;
+    // padding is not multiplied, as 0*x[0] would give NaN for non-finite x[0]
+    
+    uword n_active = C;
+    
+    for(uword j=0; j < chunk_len; ++j)
+      {
+      while( (n_active > 0) && (lens[n_active-1] <= j) )  { --n_active; }
+      
+      if(n_active == C)
+        {
+        for(uword i=0; i < C; ++i)  { acc[i] += vals[i] * x[ cols[i] ]; }
+        }
+      else
+        {
+        for(uword i=0; i < n_active; ++i)  { acc[i] += vals[i] * x[ cols[i] ]; }
+        }
+      
+      vals += C;
+      cols += C;
+      }
+    
+    const uword slot_start = k*C;
+    const uword n_slots    = (std::min)(C, n_rows - slot_start);
+    
+    for(uword i=0; i < n_slots; ++i)  { y[ perm_mem[slot_start + i] ] = acc[i]; }
+    }
+  }
+
+
+
+//! @}
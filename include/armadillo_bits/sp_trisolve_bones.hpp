@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_trisolve
+//! @{
+
+
+//! Solver for systems with a sparse triangular matrix, via forward or backward substitution.
+//! The constructor groups the rows into levels (wavefronts): the unknowns in each level
+//! depend only on unknowns in earlier levels, so each level can be solved in parallel.
+//! The analysis is kept, so that many systems with the same matrix can be solved.
+template<typename eT>
+class sp_trisolve
+  {
+  public:
+  
+  typedef eT elem_type;
+  
+  const uword n_rows;    //!< size of the square matrix
+  const uword n_levels;  //!< number of levels
+  const bool  is_lower;  //!< true if the matrix is lower triangular; a diagonal matrix is treated as lower triangular
+  
+  inline sp_trisolve();
+  
+  template<typename T1>
+  inline explicit sp_trisolve(const SpBase<eT,T1>& expr);
+  
+  inline sp_trisolve(const SpMat<eT>& A, const bool A_is_lower);  //!< for internal use; A is already known to be triangular (eg. via is_trimat())
+  
+  template<typename T1>
+  inline bool solve(Mat<eT>& X, const Base<eT,T1>& B) const;
+  
+  inline static bool is_trimat(const SpMat<eT>& A, bool& out_is_lower);
+  
+  
+  private:
+  
+  bool singular;  //!< true if there is a zero on the diagonal
+  
+  arma_aligned Col<eT>    values;       //!< off-diagonal values, stored row by row, with rows in level order
+  arma_aligned Col<uword> col_indices;  //!< column index of each off-diagonal value
+  arma_aligned Col<uword> row_ptrs;     //!< start of each row (in level order) within values and col_indices
+  arma_aligned Col<eT>    diag_values;  //!< diagonal value of each row (in level order)
+  arma_aligned Col<uword> order;        //!< rows sorted by level
+  arma_aligned Col<uword> level_ptrs;   //!< start of each level within order
+  
+  inline void init(const SpMat<eT>& A, const bool lower);
+  };
+
+
+
+//! @}
@@ -0,0 +1,355 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_trisolve
+//! @{
+
+
+
+template<typename eT>
+inline
+sp_trisolve<eT>::sp_trisolve()
+  : n_rows  (0)
+  , n_levels(0)
+  , is_lower(true)
+  , singular(false)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  row_ptrs.zeros(1);
+  level_ptrs.zeros(1);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+sp_trisolve<eT>::sp_trisolve(const SpBase<eT,T1>& expr)
+  : n_rows  (0)
+  , n_levels(0)
+  , is_lower(true)
+  , singular(false)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const unwrap_spmat<T1> U(expr.get_ref());
+  
+  const SpMat<eT>& A = U.M;
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "sp_trisolve(): given matrix must be square sized" );
+  
+  bool lower = true;
+  
+  if(is_trimat(A, lower) == false)  { arma_stop_logic_error("sp_trisolve(): given matrix must be triangular"); return; }
+  
+  (*this).init(A, lower);
+  }
+
+
+
+template<typename eT>
+inline
+sp_trisolve<eT>::sp_trisolve(const SpMat<eT>& A, const bool A_is_lower)
+  : n_rows  (0)
+  , n_levels(0)
+  , is_lower(true)
+  , singular(false)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  A.sync();
+  
+  (*this).init(A, A_is_lower);
+  }
+
+
+
+//! return true if A is square and lower or upper triangular, using a single pass over the CSC arrays
+template<typename eT>
+inline
+bool
+sp_trisolve<eT>::is_trimat(const SpMat<eT>& A, bool& out_is_lower)
+  {
+  arma_extra_debug_sigprint();
+  
+  out_is_lower = true;
+  
+  if(A.n_rows != A.n_cols)  { return false; }
+  
+  A.sync();
+  
+  bool has_lower = false;
+  bool has_upper = false;
+  
+  for(uword col=0; col < A.n_cols; ++col)
+    {
+    const uword start = A.col_ptrs[col    ];
+    const uword endp1 = A.col_ptrs[col + 1];
+    
+    if(start == endp1)  { continue; }
+    
+    // row indices are sorted within each column
+    if(A.row_indices[start    ] < col)  { has_upper = true; }
+    if(A.row_indices[endp1 - 1] > col)  { has_lower = true; }
+    
+    if(has_lower && has_upper)  { return false; }
+    }
+  
+  out_is_lower = (has_upper == false);
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_trisolve<eT>::init(const SpMat<eT>& A, const bool lower)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  access::rw(n_rows)   = N;
+  access::rw(is_lower) = lower;
+  
+  // split A into its diagonal and its off-diagonal part in compressed sparse row format;
+  // columns are visited in order, so the column indices within each row are sorted
+  
+  podarray<eT>    diag_tmp(N);
+  podarray<uword> ptrs_tmp(N+1);
+  
+  diag_tmp.zeros();
+  ptrs_tmp.zeros();
+  
+  eT*    diag_tmp_mem = diag_tmp.memptr();
+  uword* ptrs_tmp_mem = ptrs_tmp.memptr();
+  
+  for(uword col=0; col < N; ++col)
+  for(uword k=A.col_ptrs[col]; k < A.col_ptrs[col+1]; ++k)
+    {
+    const uword row = A.row_indices[k];
+    
+    if(row == col)  { diag_tmp_mem[row] = A.values[k]; }  else  { ++(ptrs_tmp_mem[row + 1]); }
+    }
+  
+  arrayops::inplace_cumsum_mp(ptrs_tmp_mem, N+1);
+  
+  const uword n_offdiag = ptrs_tmp_mem[N];
+  
+  podarray<eT>    vals_tmp(n_offdiag);
+  podarray<uword> cols_tmp(n_offdiag);
+  podarray<uword> offsets(N);
+  
+  arrayops::copy(offsets.memptr(), ptrs_tmp_mem, N);
+  
+  for(uword col=0; col < N; ++col)
+  for(uword k=A.col_ptrs[col]; k < A.col_ptrs[col+1]; ++k)
+    {
+    const uword row = A.row_indices[k];
+    
+    if(row == col)  { continue; }
+    
+    const uword pos = offsets[row];
+    
+    vals_tmp[pos] = A.values[k];
+    cols_tmp[pos] = col;
+    
+    ++(offsets[row]);
+    }
+  
+  // the level of each row is one more than the highest level of the rows it depends on
+  
+  podarray<uword> level(N);
+  
+  uword* level_mem = level.memptr();
+  
+  uword max_level = 0;
+  
+  for(uword count=0; count < N; ++count)
+    {
+    const uword row = (lower) ? count : (N - 1 - count);
+    
+    uword row_level = 0;
+    
+    for(uword k=ptrs_tmp_mem[row]; k < ptrs_tmp_mem[row+1]; ++k)
+      {
+      row_level = (std::max)(row_level, level_mem[ cols_tmp[k] ] + 1);
+      }
+    
+    level_mem[row] = row_level;
+    
+    max_level = (std::max)(max_level, row_level);
+    }
+  
+  const uword local_n_levels = (N > 0) ? (max_level + 1) : uword(0);
+  
+  access::rw(n_levels) = local_n_levels;
+  
+  // group the rows by level, using a counting sort
+  
+  level_ptrs.zeros(local_n_levels + 1);
+  
+  uword* level_ptrs_mem = level_ptrs.memptr();
+  
+  for(uword row=0; row < N; ++row)  { ++(level_ptrs_mem[ level_mem[row] + 1 ]); }
+  
+  arrayops::inplace_cumsum_mp(level_ptrs_mem, local_n_levels + 1);
+  
+  order.set_size(N);
+  
+  uword* order_mem = order.memptr();
+  
+  podarray<uword> level_offsets(local_n_levels);
+  
+  arrayops::copy(level_offsets.memptr(), level_ptrs_mem, local_n_levels);
+  
+  for(uword row=0; row < N; ++row)
+    {
+    order_mem[ level_offsets[ level_mem[row] ] ] = row;
+    
+    ++(level_offsets[ level_mem[row] ]);
+    }
+  
+  // store the rows in level order, so that each level is a contiguous block of memory
+  
+  row_ptrs.set_size(N+1);
+  diag_values.set_size(N);
+  
+  uword* row_ptrs_mem    = row_ptrs.memptr();
+  eT*    diag_values_mem = diag_values.memptr();
+  
+  row_ptrs_mem[0] = 0;
+  
+  for(uword p=0; p < N; ++p)
+    {
+    const uword row = order_mem[p];
+    
+    row_ptrs_mem[p+1] = ptrs_tmp_mem[row+1] - ptrs_tmp_mem[row];
+    
+    diag_values_mem[p] = diag_tmp_mem[row];
+    
+    if(diag_tmp_mem[row] == eT(0))  { singular = true; }
+    }
+  
+  arrayops::inplace_cumsum_mp(row_ptrs_mem, N+1);
+  
+  values.set_size(n_offdiag);
+  col_indices.set_size(n_offdiag);
+  
+  eT*    values_mem      = values.memptr();
+  uword* col_indices_mem = col_indices.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<eT>::eval(n_offdiag);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword p=0; p < N; ++p)
+    {
+    const uword row    = order_mem[p];
+    const uword length = row_ptrs_mem[p+1] - row_ptrs_mem[p];
+    
+    arrayops::copy( &(values_mem     [ row_ptrs_mem[p] ]), &(vals_tmp[ ptrs_tmp_mem[row] ]), length );
+    arrayops::copy( &(col_indices_mem[ row_ptrs_mem[p] ]), &(cols_tmp[ ptrs_tmp_mem[row] ]), length );
+    }
+  }
+
+
+
+//! solve A*X = B; return false if A has a zero on its diagonal
+template<typename eT>
+template<typename T1>
+inline
+bool
+sp_trisolve<eT>::solve(Mat<eT>& X, const Base<eT,T1>& B_expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(B_expr.get_ref());
+  
+  const Mat<eT>& B = U.M;
+  
+  arma_debug_check( (B.n_rows != n_rows), "sp_trisolve::solve(): number of rows in given matrices must be the same" );
+  
+  if(singular)  { X.soft_reset(); return false; }
+  
+  X = B;  // no-op if X is an alias of B
+  
+  const uword n_rhs = X.n_cols;
+  
+  const eT*    values_mem      = values.memptr();
+  const uword* col_indices_mem = col_indices.memptr();
+  const uword* row_ptrs_mem    = row_ptrs.memptr();
+  const eT*    diag_values_mem = diag_values.memptr();
+  const uword* order_mem       = order.memptr();
+  const uword* level_ptrs_mem  = level_ptrs.memptr();
+  
+  eT* X_mem = X.memptr();
+  
+  const uword X_n_rows = X.n_rows;
+  
+  #if defined(ARMA_USE_OPENMP)
+    const int n_threads = mp_thread_limit::get();
+  #endif
+  
+  for(uword level=0; level < n_levels; ++level)
+    {
+    const uword start = level_ptrs_mem[level    ];
+    const uword endp1 = level_ptrs_mem[level + 1];
+    
+    #if defined(ARMA_USE_OPENMP)
+      const uword level_work = (row_ptrs_mem[endp1] - row_ptrs_mem[start] + (endp1 - start)) * n_rhs;
+      const bool  use_mp     = ((endp1 - start) >= 2) && mp_gate<eT>::eval(level_work);
+    #endif
+    
+    #if defined(ARMA_USE_OPENMP)
+      #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+    #endif
+    for(uword p=start; p < endp1; ++p)
+      {
+      const uword row       = order_mem[p];
+      const uword row_start = row_ptrs_mem[p    ];
+      const uword row_endp1 = row_ptrs_mem[p + 1];
+      const eT    diag_val  = diag_values_mem[p];
+      
+      for(uword k=0; k < n_rhs; ++k)
+        {
+        eT* X_col = &(X_mem[k * X_n_rows]);
+        
+        eT acc = X_col[row];
+        
+        for(uword i=row_start; i < row_endp1; ++i)  { acc -= values_mem[i] * X_col[ col_indices_mem[i] ]; }
+        
+        X_col[row] = acc / diag_val;
+        }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+//! @}
@@ -60,6 +60,8 @@ spglue_max::apply_noalias(SpMat<eT>& out, const SpProxy<T1>& pa, const SpProxy<T
   
   arma_debug_assert_same_size(pa.get_n_rows(), pa.get_n_cols(), pb.get_n_rows(), pb.get_n_cols(), "element-wise max()");
   
+  if(spglue_merge::merge_mp<true>(out, pa, pb, [](const eT a, const eT b) -> eT { return spglue_max::elem_max(a, b); }))  { return; }
+  
   const uword max_n_nonzero = pa.get_n_nonzero() + pb.get_n_nonzero();
   
   // Resize memory to upper bound
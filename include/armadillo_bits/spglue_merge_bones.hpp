@@ -36,6 +36,12 @@ class spglue_merge
   
   template<typename eT>
   inline static void diagview_merge(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B);
+  
+  template<bool is_union, typename eT, typename T1, typename T2, typename functor>
+  inline static bool merge_mp(SpMat<eT>& out, const SpProxy<T1>& pa, const SpProxy<T2>& pb, const functor& func);
+  
+  template<bool do_fill, bool is_union, typename eT, typename functor>
+  arma_hot inline static uword merge_col(eT* out_values, uword* out_row_indices, const eT* a_values, const uword* a_row_indices, const uword a_n, const eT* b_values, const uword* b_row_indices, const uword b_n, const functor& func);
   };
 
 
@@ -551,4 +551,160 @@ spglue_merge::diagview_merge(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>
 
 
 
+//! column-parallel element-wise merge of two sparse matrices, done in two passes:
+//! the first pass counts the non-zero results in each column, and the second pass writes the results;
+//! with is_union = true, func(a,b) is evaluated at locations that are non-zero in either matrix (with zero for the missing element),
+//! otherwise only at locations that are non-zero in both matrices.
+//! returns false if the merge is not worth parallelising, or if the elements can only be accessed via iterators
+template<bool is_union, typename eT, typename T1, typename T2, typename functor>
+inline
+bool
+spglue_merge::merge_mp(SpMat<eT>& out, const SpProxy<T1>& pa, const SpProxy<T2>& pb, const functor& func)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( SpProxy<T1>::use_iterator || SpProxy<T2>::use_iterator )  { return false; }
+    
+    const uword n_nonzero_sum = pa.get_n_nonzero() + pb.get_n_nonzero();
+    
+    if( (n_nonzero_sum < (arma_config::mp_threshold * uword(32))) || (mp_gate<eT>::eval(n_nonzero_sum) == false) )  { return false; }
+    
+    const uword n_cols = pa.get_n_cols();
+    
+    const int n_threads = mp_thread_limit::get();
+    
+    const eT*    a_values      = pa.get_values();
+    const uword* a_row_indices = pa.get_row_indices();
+    const uword* a_col_ptrs    = pa.get_col_ptrs();
+    
+    const eT*    b_values      = pb.get_values();
+    const uword* b_row_indices = pb.get_row_indices();
+    const uword* b_col_ptrs    = pb.get_col_ptrs();
+    
+    out.zeros(pa.get_n_rows(), n_cols);
+    
+    uword* out_col_ptrs = access::rwp(out.col_ptrs);
+    
+    #pragma omp parallel for schedule(dynamic,64) num_threads(n_threads)
+    for(uword col=0; col < n_cols; ++col)
+      {
+      const uword a_start = a_col_ptrs[col];
+      const uword b_start = b_col_ptrs[col];
+      
+      out_col_ptrs[col + 1] = spglue_merge::merge_col<false, is_union>
+        (
+        static_cast<eT*>(nullptr), static_cast<uword*>(nullptr),
+        &(a_values[a_start]), &(a_row_indices[a_start]), a_col_ptrs[col + 1] - a_start,
+        &(b_values[b_start]), &(b_row_indices[b_start]), b_col_ptrs[col + 1] - b_start,
+        func
+        );
+      }
+    
+    arrayops::inplace_cumsum_mp(out_col_ptrs, n_cols + 1);
+    
+    out.mem_resize(out_col_ptrs[n_cols]);
+    
+    eT*    out_values      = access::rwp(out.values);
+    uword* out_row_indices = access::rwp(out.row_indices);
+    
+    #pragma omp parallel for schedule(dynamic,64) num_threads(n_threads)
+    for(uword col=0; col < n_cols; ++col)
+      {
+      const uword a_start   = a_col_ptrs[col];
+      const uword b_start   = b_col_ptrs[col];
+      const uword out_start = out_col_ptrs[col];
+      
+      spglue_merge::merge_col<true, is_union>
+        (
+        &(out_values[out_start]), &(out_row_indices[out_start]),
+        &(a_values[a_start]), &(a_row_indices[a_start]), a_col_ptrs[col + 1] - a_start,
+        &(b_values[b_start]), &(b_row_indices[b_start]), b_col_ptrs[col + 1] - b_start,
+        func
+        );
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(pa);
+    arma_ignore(pb);
+    arma_ignore(func);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! merge one column of two sparse matrices; returns the number of non-zero results,
+//! which are only written when do_fill is true
+template<bool do_fill, bool is_union, typename eT, typename functor>
+arma_hot
+inline
+uword
+spglue_merge::merge_col(eT* out_values, uword* out_row_indices, const eT* a_values, const uword* a_row_indices, const uword a_n, const eT* b_values, const uword* b_row_indices, const uword b_n, const functor& func)
+  {
+  uword count = 0;
+  
+  uword i = 0;
+  uword j = 0;
+  
+  while( is_union ? ((i < a_n) || (j < b_n)) : ((i < a_n) && (j < b_n)) )
+    {
+    const uword a_row = (i < a_n) ? a_row_indices[i] : std::numeric_limits<uword>::max();
+    const uword b_row = (j < b_n) ? b_row_indices[j] : std::numeric_limits<uword>::max();
+    
+    eT    out_val;
+    uword out_row;
+    
+    if(a_row == b_row)
+      {
+      out_val = func(a_values[i], b_values[j]);
+      out_row = a_row;
+      
+      ++i;
+      ++j;
+      }
+    else
+    if(a_row < b_row)
+      {
+      if(is_union == false)  { ++i; continue; }
+      
+      out_val = func(a_values[i], eT(0));
+      out_row = a_row;
+      
+      ++i;
+      }
+    else
+      {
+      if(is_union == false)  { ++j; continue; }
+      
+      out_val = func(eT(0), b_values[j]);
+      out_row = b_row;
+      
+      ++j;
+      }
+    
+    if(out_val != eT(0))
+      {
+      if(do_fill)
+        {
+        out_values[count]      = out_val;
+        out_row_indices[count] = out_row;
+        }
+      
+      ++count;
+      }
+    }
+  
+  return count;
+  }
+
+
+
 //! @}
@@ -63,6 +63,8 @@ spglue_minus::apply_noalias(SpMat<eT>& out, const SpProxy<T1>& pa, const SpProxy
   if(pa.get_n_nonzero() == 0)  { out = pb.Q; out *= eT(-1); return; }
   if(pb.get_n_nonzero() == 0)  { out = pa.Q;                return; }
   
+  if(spglue_merge::merge_mp<true>(out, pa, pb, [](const eT a, const eT b) -> eT { return a - b; }))  { return; }
+  
   const uword max_n_nonzero = pa.get_n_nonzero() + pb.get_n_nonzero();
   
   // Resize memory to upper bound
@@ -66,6 +66,8 @@ spglue_schur::apply_noalias(SpMat<eT>& out, const SpProxy<T1>& pa, const SpProxy
     return;
     }
   
+  if(spglue_merge::merge_mp<false>(out, pa, pb, [](const eT a, const eT b) -> eT { return a * b; }))  { return; }
+  
   const uword max_n_nonzero = (std::min)(pa.get_n_nonzero(), pb.get_n_nonzero());
   
   // Resize memory to upper bound
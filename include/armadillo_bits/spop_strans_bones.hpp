@@ -37,6 +37,9 @@ class spop_strans
   template<typename eT>
   inline static void apply_noalias(SpMat<eT>& B, const SpMat<eT>& A);
   
+  template<typename eT>
+  inline static bool apply_noalias_mp(SpMat<eT>& B, const SpMat<eT>& A);
+  
   template<typename T1>
   inline static void apply(SpMat<typename T1::elem_type>& out, const SpOp<T1,spop_strans>& in);
   
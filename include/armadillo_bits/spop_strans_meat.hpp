@@ -32,6 +32,8 @@ spop_strans::apply_noalias(SpMat<eT>& B, const SpMat<eT>& A)
   
   if(A.n_nonzero == 0)  { return; }
   
+  if(spop_strans::apply_noalias_mp(B, A))  { return; }
+  
   // This follows the TRANSP algorithm described in
   // 'Sparse Matrix Multiplication Package (SMMP)'
   // (R.E. Bank and C.C. Douglas, 2001)
@@ -94,6 +96,127 @@ spop_strans::apply_noalias(SpMat<eT>& B, const SpMat<eT>& A)
 
 
 
+//! parallel version of the TRANSP algorithm:
+//! each thread takes a contiguous range of columns of A with about the same number of non-zero elements,
+//! counts the elements in each row within its range, and then scatters its elements into the rows of B;
+//! as the ranges are in order, the row indices in each column of B remain sorted.
+//! B must be freshly reserved with swapped dimensions; returns false if A is too small to be worth parallelising
+template<typename eT>
+inline
+bool
+spop_strans::apply_noalias_mp(SpMat<eT>& B, const SpMat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const uword m   = A.n_rows;
+    const uword n   = A.n_cols;
+    const uword nnz = A.n_nonzero;
+    
+    // each thread has its own row histogram, so the number of threads is also limited by the size of the histograms
+    
+    if( (nnz < (arma_config::mp_threshold * uword(32))) || (mp_gate<eT>::eval(nnz) == false) )  { return false; }
+    
+    const uword n_threads_max = uword(mp_thread_limit::get());
+    const uword n_threads_fit = nnz / (std::max)(m + 1, arma_config::mp_threshold);
+    
+    const uword n_threads = (std::min)(n_threads_max, n_threads_fit);
+    
+    if(n_threads < 2)  { return false; }
+    
+    const eT*    a  = A.values;
+    const uword* ia = A.col_ptrs;
+    const uword* ja = A.row_indices;
+    
+          eT*    b  = access::rwp(B.values);
+          uword* ib = access::rwp(B.col_ptrs);
+          uword* jb = access::rwp(B.row_indices);
+    
+    podarray<uword> col_bounds(n_threads + 1);
+    
+    col_bounds[0]         = 0;
+    col_bounds[n_threads] = n;
+    
+    for(uword t=1; t < n_threads; ++t)
+      {
+      const uword target = (nnz / n_threads) * t;
+      
+      col_bounds[t] = uword( std::upper_bound(ia, ia + n, target) - ia ) - 1;
+      
+      col_bounds[t] = (std::max)(col_bounds[t], col_bounds[t-1]);
+      }
+    
+    podarray<uword> counts(n_threads * m);
+    
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+    for(uword t=0; t < n_threads; ++t)
+      {
+      uword* t_counts = &(counts[t * m]);
+      
+      arrayops::fill_zeros(t_counts, m);
+      
+      const uword j_start = ia[ col_bounds[t  ] ];
+      const uword j_endp1 = ia[ col_bounds[t+1] ];
+      
+      for(uword j=j_start; j < j_endp1; ++j)  { ++(t_counts[ ja[j] ]); }
+      }
+    
+    ib[0] = 0;
+    
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+    for(uword row=0; row < m; ++row)
+      {
+      uword acc = 0;
+      
+      for(uword t=0; t < n_threads; ++t)
+        {
+        uword& count = counts[t * m + row];
+        
+        const uword tmp = count;
+        
+        count = acc;
+        
+        acc += tmp;
+        }
+      
+      ib[row + 1] = acc;
+      }
+    
+    arrayops::inplace_cumsum_mp(ib, m + 1);
+    
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+    for(uword t=0; t < n_threads; ++t)
+      {
+      uword* t_offsets = &(counts[t * m]);
+      
+      for(uword col = col_bounds[t]; col < col_bounds[t+1]; ++col)
+      for(uword j = ia[col]; j < ia[col+1]; ++j)
+        {
+        const uword row = ja[j];
+        const uword pos = ib[row] + t_offsets[row];
+        
+        ++(t_offsets[row]);
+        
+        jb[pos] = col;
+        b[pos]  = a[j];
+        }
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(B);
+    arma_ignore(A);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
 template<typename T1>
 inline
 void
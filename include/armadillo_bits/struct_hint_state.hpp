@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup struct_hint
+//! @{
+
+
+// structure hint attached to a dense matrix;
+// the kind of structure and both bandwidths are packed into one word, so that a hint is always read and written in one go.
+// a plain word is used instead of std::atomic, as the hint is reset by every non-const element accessor,
+// and atomic operations in those accessors prevent the compiler from vectorising element-wise loops;
+// reset() only writes if a hint is present, so that accessors called from parallel loops on a matrix without a hint only read the word
+
+class struct_hint_state
+  {
+  public:
+  
+  inline struct_hint_state();
+  
+  arma_inline void reset();
+  
+  inline bool set(const struct_hint in_kind, const uword in_KL, const uword in_KU);
+  
+  arma_warn_unused inline struct_hint get(uword& out_KL, uword& out_KU) const;
+  
+  
+  private:
+  
+  static constexpr uword n_kind_bits = 4;
+  static constexpr uword n_band_bits = ( (sizeof(uword) * 8) - n_kind_bits ) / 2;
+  static constexpr uword kind_mask   = (uword(1) << n_kind_bits) - 1;
+  static constexpr uword band_mask   = (uword(1) << n_band_bits) - 1;
+  
+  arma_aligned uword bits;
+  };
+
+
+
+inline
+struct_hint_state::struct_hint_state()
+  : bits(0)
+  {
+  }
+
+
+
+//! called on every potential modification of the matrix
+arma_inline
+void
+struct_hint_state::reset()
+  {
+  if(bits != uword(0))  { bits = uword(0); }
+  }
+
+
+
+//! returns false if the bandwidths can't be represented, in which case the hint is reset
+inline
+bool
+struct_hint_state::set(const struct_hint in_kind, const uword in_KL, const uword in_KU)
+  {
+  const bool is_band = (in_kind == struct_hint::band);
+  
+  const uword KL = (is_band) ? in_KL : uword(0);
+  const uword KU = (is_band) ? in_KU : uword(0);
+  
+  if( (KL > band_mask) || (KU > band_mask) )  { bits = uword(0); return false; }
+  
+  const uword val = uword(in_kind) | (KL << n_kind_bits) | (KU << (n_kind_bits + n_band_bits));
+  
+  bits = val;
+  
+  return true;
+  }
+
+
+
+inline
+struct_hint
+struct_hint_state::get(uword& out_KL, uword& out_KU) const
+  {
+  const uword val = bits;
+  
+  out_KL = (val >>  n_kind_bits                ) & band_mask;
+  out_KU = (val >> (n_kind_bits + n_band_bits) ) & band_mask;
+  
+  return struct_hint(val & kind_mask);
+  }
+
+
+
+//! @}
@@ -813,25 +813,64 @@ subview_elem1<eT,T1>::extract(Mat<eT>& actual_out, const subview_elem1<eT,T1>& i
   
   eT* out_mem = out.memptr();
   
-  uword i,j;
-  for(i=0, j=1; j<aa_n_elem; i+=2, j+=2)
+  if(op_find::use_mp<eT>(aa_n_elem))
     {
-    const uword ii = aa_mem[i];
-    const uword jj = aa_mem[j];
-    
-    arma_debug_check_bounds( ( (ii >= m_n_elem) || (jj >= m_n_elem) ), "Mat::elem(): index out of bounds" );
-    
-    out_mem[i] = m_mem[ii];
-    out_mem[j] = m_mem[jj];
+    #if defined(ARMA_USE_OPENMP)
+      {
+      // exceptions can't be thrown from within a parallel region, so out of bounds indices are only flagged here
+      
+      const int   n_threads_max = mp_thread_limit::get();
+      const uword n_threads_use = (std::min)(uword(podarray_prealloc_n_elem::val), uword(n_threads_max));
+      const uword chunk_size    = aa_n_elem / n_threads_use;
+      
+      podarray<uword> bad_flags(n_threads_use);
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads_use))
+      for(uword thread_id=0; thread_id < n_threads_use; ++thread_id)
+        {
+        const uword start = (thread_id+0) * chunk_size;
+        const uword endp1 = ((thread_id+1) == n_threads_use) ? aa_n_elem : ((thread_id+1) * chunk_size);
+        
+        uword bad = 0;
+        
+        for(uword i=start; i < endp1; ++i)
+          {
+          const uword ii = aa_mem[i];
+          
+          if(ii < m_n_elem)  { out_mem[i] = m_mem[ii]; }  else  { bad = 1; }
+          }
+        
+        bad_flags[thread_id] = bad;
+        }
+      
+      const bool any_bad = (arrayops::accumulate(bad_flags.memptr(), n_threads_use) > 0);
+      
+      arma_debug_check_bounds( any_bad, "Mat::elem(): index out of bounds" );
+      }
+    #endif
     }
-  
-  if(i < aa_n_elem)
+  else
     {
-    const uword ii = aa_mem[i];
-    
-    arma_debug_check_bounds( (ii >= m_n_elem) , "Mat::elem(): index out of bounds" );
+    uword i,j;
+    for(i=0, j=1; j<aa_n_elem; i+=2, j+=2)
+      {
+      const uword ii = aa_mem[i];
+      const uword jj = aa_mem[j];
+      
+      arma_debug_check_bounds( ( (ii >= m_n_elem) || (jj >= m_n_elem) ), "Mat::elem(): index out of bounds" );
+      
+      out_mem[i] = m_mem[ii];
+      out_mem[j] = m_mem[jj];
+      }
     
-    out_mem[i] = m_mem[ii];
+    if(i < aa_n_elem)
+      {
+      const uword ii = aa_mem[i];
+      
+      arma_debug_check_bounds( (ii >= m_n_elem) , "Mat::elem(): index out of bounds" );
+      
+      out_mem[i] = m_mem[ii];
+      }
     }
   
   if(alias)
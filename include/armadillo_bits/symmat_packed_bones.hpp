@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup symmat_packed
+//! @{
+
+
+//! Dense square symmetric (or hermitian) matrix, with only the lower triangle stored column by column
+//! in LAPACK packed storage: element A(i,j) with i >= j is held at position i + j*(2*n-j-1)/2.
+//! Memory use is n*(n+1)/2 elements.
+template<typename eT>
+class symmat_packed
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  const uword n_rows;  //!< number of rows (same as n_cols)
+  const uword n_cols;  //!< number of columns
+  
+  inline symmat_packed();
+  inline symmat_packed(const symmat_packed& x);
+  inline symmat_packed& operator=(const symmat_packed& x);
+  
+  inline explicit symmat_packed(const uword in_n);
+  
+  template<typename T1> inline explicit symmat_packed(const Base<eT,T1>& expr);
+  
+  arma_inline       eT& at(const uword in_row, const uword in_col);
+  arma_inline const eT& at(const uword in_row, const uword in_col) const;
+  
+  inline StructValProxy< symmat_packed<eT> > operator()(const uword in_row, const uword in_col);
+  inline eT                                  operator()(const uword in_row, const uword in_col) const;
+  
+  inline       eT* memptr();
+  inline const eT* memptr() const;
+  
+  inline Mat<eT> as_dense() const;
+  
+  template<typename T1> inline void mul(Mat<eT>& out, const Base<eT,T1>& X) const;
+  
+  template<typename T1> inline bool solve(Mat<eT>& X, const Base<eT,T1>& B) const;
+  
+  
+  private:
+  
+  friend class StructValProxy< symmat_packed<eT> >;
+  
+  inline eT   get_elem(const uword in_row, const uword in_col) const;
+  inline void set_elem(const uword in_row, const uword in_col, const eT val);
+  
+  arma_aligned Col<eT> AP;  //!< packed lower triangle
+  
+  arma_inline uword offset(const uword in_row, const uword in_col) const;
+  };
+
+
+
+//! @}
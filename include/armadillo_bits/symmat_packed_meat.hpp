@@ -0,0 +1,373 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup symmat_packed
+//! @{
+
+
+
+template<typename eT>
+inline
+symmat_packed<eT>::symmat_packed()
+  : n_rows(0)
+  , n_cols(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+symmat_packed<eT>::symmat_packed(const symmat_packed<eT>& x)
+  : n_rows(x.n_rows)
+  , n_cols(x.n_cols)
+  , AP    (x.AP    )
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+symmat_packed<eT>&
+symmat_packed<eT>::operator=(const symmat_packed<eT>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(this != &x)
+    {
+    access::rw(n_rows) = x.n_rows;
+    access::rw(n_cols) = x.n_cols;
+    
+    AP = x.AP;
+    }
+  
+  return *this;
+  }
+
+
+
+//! n x n matrix with all elements set to zero
+template<typename eT>
+inline
+symmat_packed<eT>::symmat_packed(const uword in_n)
+  : n_rows(in_n)
+  , n_cols(in_n)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  AP.zeros( (in_n * (in_n + 1)) / 2 );
+  }
+
+
+
+//! copy of the lower triangle of a square dense matrix; the upper triangle is ignored
+template<typename eT>
+template<typename T1>
+inline
+symmat_packed<eT>::symmat_packed(const Base<eT,T1>& expr)
+  : n_rows(0)
+  , n_cols(0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const quasi_unwrap<T1> U(expr.get_ref());
+  
+  const Mat<eT>& A = U.M;
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "symmat_packed(): given matrix must be square sized" );
+  
+  const uword N = A.n_rows;
+  
+  access::rw(n_rows) = N;
+  access::rw(n_cols) = N;
+  
+  AP.set_size( (N * (N + 1)) / 2 );
+  
+  eT* AP_mem = AP.memptr();
+  
+  for(uword col=0; col < N; ++col)
+    {
+    arrayops::copy( &(AP_mem[ offset(col,col) ]), &(A.at(col,col)), N - col );
+    }
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+symmat_packed<eT>::offset(const uword in_row, const uword in_col) const
+  {
+  return in_row + (in_col * (2*n_rows - in_col - 1)) / 2;
+  }
+
+
+
+//! element A(in_row,in_col) of the lower triangle, without bounds checks; in_row must be >= in_col
+template<typename eT>
+arma_inline
+eT&
+symmat_packed<eT>::at(const uword in_row, const uword in_col)
+  {
+  return AP[ offset(in_row, in_col) ];
+  }
+
+
+
+template<typename eT>
+arma_inline
+const eT&
+symmat_packed<eT>::at(const uword in_row, const uword in_col) const
+  {
+  return AP[ offset(in_row, in_col) ];
+  }
+
+
+
+template<typename eT>
+inline
+StructValProxy< symmat_packed<eT> >
+symmat_packed<eT>::operator()(const uword in_row, const uword in_col)
+  {
+  arma_debug_check_bounds( ((in_row >= n_rows) || (in_col >= n_cols)), "symmat_packed::operator(): index out of bounds" );
+  
+  return StructValProxy< symmat_packed<eT> >(in_row, in_col, *this);
+  }
+
+
+
+template<typename eT>
+inline
+eT
+symmat_packed<eT>::operator()(const uword in_row, const uword in_col) const
+  {
+  arma_debug_check_bounds( ((in_row >= n_rows) || (in_col >= n_cols)), "symmat_packed::operator(): index out of bounds" );
+  
+  return (*this).get_elem(in_row, in_col);
+  }
+
+
+
+//! element A(in_row,in_col); elements of the upper triangle are taken from the lower triangle (conjugated for complex matrices)
+template<typename eT>
+inline
+eT
+symmat_packed<eT>::get_elem(const uword in_row, const uword in_col) const
+  {
+  return (in_row >= in_col) ? (*this).at(in_row, in_col) : eT( access::alt_conj( (*this).at(in_col, in_row) ) );
+  }
+
+
+
+//! set element A(in_row,in_col), and by symmetry A(in_col,in_row)
+template<typename eT>
+inline
+void
+symmat_packed<eT>::set_elem(const uword in_row, const uword in_col, const eT val)
+  {
+  if(in_row >= in_col)
+    {
+    (*this).at(in_row, in_col) = val;
+    }
+  else
+    {
+    (*this).at(in_col, in_row) = eT( access::alt_conj(val) );
+    }
+  }
+
+
+
+//! packed storage, as used by LAPACK with uplo = 'L'
+template<typename eT>
+inline
+eT*
+symmat_packed<eT>::memptr()
+  {
+  return AP.memptr();
+  }
+
+
+
+template<typename eT>
+inline
+const eT*
+symmat_packed<eT>::memptr() const
+  {
+  return AP.memptr();
+  }
+
+
+
+template<typename eT>
+inline
+Mat<eT>
+symmat_packed<eT>::as_dense() const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = n_rows;
+  
+  Mat<eT> out(N, N, arma_nozeros_indicator());
+  
+  const eT* AP_mem = AP.memptr();
+  
+  for(uword col=0; col < N; ++col)
+    {
+    const eT* AP_col = &(AP_mem[ offset(col,col) ]);
+    
+    arrayops::copy( &(out.at(col,col)), AP_col, N - col );
+    
+    for(uword row=(col+1); row < N; ++row)  { out.at(col,row) = access::alt_conj( AP_col[row - col] ); }
+    }
+  
+  return out;
+  }
+
+
+
+//! out = A * X; each row of the result reads row i of the lower triangle and column i below the diagonal
+template<typename eT>
+template<typename T1>
+inline
+void
+symmat_packed<eT>::mul(Mat<eT>& out, const Base<eT,T1>& X_expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X_expr.get_ref());
+  
+  const Mat<eT>& X = U.M;
+  
+  arma_debug_assert_mul_size(n_rows, n_cols, X.n_rows, X.n_cols, "matrix multiplication");
+  
+  if(U.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    (*this).mul(tmp, X);
+    
+    out.steal_mem(tmp);
+    
+    return;
+    }
+  
+  out.set_size(n_rows, X.n_cols);
+  
+  const uword N      = n_rows;
+  const uword X_cols = X.n_cols;
+  
+  const eT* AP_mem = AP.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<eT>::eval(AP.n_elem * X_cols);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword row=0; row < N; ++row)
+    {
+    const eT* AP_col = &(AP_mem[ offset(row,row) ]);  // A(row:N-1, row)
+    
+    for(uword c=0; c < X_cols; ++c)
+      {
+      const eT* X_col = X.colptr(c);
+      
+      eT acc = eT(0);
+      
+      // A(row,col) for col < row: moving to the next column skips N-col-1 elements
+      
+      uword k = row;
+      
+      for(uword col=0; col < row; ++col)
+        {
+        acc += AP_mem[k] * X_col[col];
+        
+        k += N - col - 1;
+        }
+      
+      acc += AP_col[0] * X_col[row];
+      
+      for(uword col=(row+1); col < N; ++col)
+        {
+        acc += access::alt_conj( AP_col[col - row] ) * X_col[col];
+        }
+      
+      out.at(row, c) = acc;
+      }
+    }
+  }
+
+
+
+//! solve A*X = B via Cholesky decomposition in packed storage (pptrf and pptrs);
+//! returns false if A is not positive definite
+template<typename eT>
+template<typename T1>
+inline
+bool
+symmat_packed<eT>::solve(Mat<eT>& X, const Base<eT,T1>& B_expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    X = B_expr.get_ref();
+    
+    arma_debug_check( (X.n_rows != n_rows), "solve(): number of rows in given matrices must be the same", [&](){ X.soft_reset(); } );
+    
+    if( (n_rows == 0) || X.is_empty() )  { X.zeros(n_rows, X.n_cols); return true; }
+    
+    arma_debug_assert_blas_size(X);
+    
+    Col<eT> AF(AP);
+    
+    char     uplo = 'L';
+    blas_int n    = blas_int(n_rows);
+    blas_int nrhs = blas_int(X.n_cols);
+    blas_int ldb  = blas_int(X.n_rows);
+    blas_int info = blas_int(0);
+    
+    arma_extra_debug_print("lapack::pptrf()");
+    lapack::pptrf(&uplo, &n, AF.memptr(), &info);
+    
+    if(info != 0)  { return false; }
+    
+    arma_extra_debug_print("lapack::pptrs()");
+    lapack::pptrs(&uplo, &n, &nrhs, AF.memptr(), X.memptr(), &ldb, &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(B_expr);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! @}
@@ -698,6 +698,15 @@ struct is_spdiagview< spdiagview<eT> >
   { static constexpr bool value = true; };
 
 
+template<typename T>
+struct is_sp_compact
+  { static constexpr bool value = false; };
+
+template<typename eT>
+struct is_sp_compact< sp_compact<eT> >
+  { static constexpr bool value = true; };
+
+
 template<typename T>
 struct is_SpOp
   { static constexpr bool value = false; };
@@ -745,6 +754,7 @@ struct is_arma_sparse_type
   || is_SpSubview_col_list<T1>::value
   || is_SpSubview_row<T1>::value
   || is_spdiagview<T1>::value
+  || is_sp_compact<T1>::value
   || is_SpOp<T1>::value
   || is_SpGlue<T1>::value
   || is_mtSpOp<T1>::value
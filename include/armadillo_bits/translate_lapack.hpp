@@ -373,6 +373,94 @@ namespace lapack
   
   
   
+  template<typename eT>
+  inline
+  void
+  pbtrs(char* uplo, blas_int* n, blas_int* kd, blas_int* nrhs, const eT* ab, blas_int* ldab, eT* b, blas_int* ldb, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if(    is_float<eT>::value)  { typedef float    T; arma_fortran(arma_spbtrs)(uplo, n, kd, nrhs, (const T*)ab, ldab, (T*)b, ldb, info, 1); }
+      else if(   is_double<eT>::value)  { typedef double   T; arma_fortran(arma_dpbtrs)(uplo, n, kd, nrhs, (const T*)ab, ldab, (T*)b, ldb, info, 1); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_cpbtrs)(uplo, n, kd, nrhs, (const T*)ab, ldab, (T*)b, ldb, info, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zpbtrs)(uplo, n, kd, nrhs, (const T*)ab, ldab, (T*)b, ldb, info, 1); }
+    #else
+           if(    is_float<eT>::value)  { typedef float    T; arma_fortran(arma_spbtrs)(uplo, n, kd, nrhs, (const T*)ab, ldab, (T*)b, ldb, info); }
+      else if(   is_double<eT>::value)  { typedef double   T; arma_fortran(arma_dpbtrs)(uplo, n, kd, nrhs, (const T*)ab, ldab, (T*)b, ldb, info); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_cpbtrs)(uplo, n, kd, nrhs, (const T*)ab, ldab, (T*)b, ldb, info); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zpbtrs)(uplo, n, kd, nrhs, (const T*)ab, ldab, (T*)b, ldb, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  pptrf(char* uplo, blas_int* n, eT* ap, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if(    is_float<eT>::value)  { typedef float    T; arma_fortran(arma_spptrf)(uplo, n, (T*)ap, info, 1); }
+      else if(   is_double<eT>::value)  { typedef double   T; arma_fortran(arma_dpptrf)(uplo, n, (T*)ap, info, 1); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_cpptrf)(uplo, n, (T*)ap, info, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zpptrf)(uplo, n, (T*)ap, info, 1); }
+    #else
+           if(    is_float<eT>::value)  { typedef float    T; arma_fortran(arma_spptrf)(uplo, n, (T*)ap, info); }
+      else if(   is_double<eT>::value)  { typedef double   T; arma_fortran(arma_dpptrf)(uplo, n, (T*)ap, info); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_cpptrf)(uplo, n, (T*)ap, info); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zpptrf)(uplo, n, (T*)ap, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  pptrs(char* uplo, blas_int* n, blas_int* nrhs, const eT* ap, eT* b, blas_int* ldb, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if(    is_float<eT>::value)  { typedef float    T; arma_fortran(arma_spptrs)(uplo, n, nrhs, (const T*)ap, (T*)b, ldb, info, 1); }
+      else if(   is_double<eT>::value)  { typedef double   T; arma_fortran(arma_dpptrs)(uplo, n, nrhs, (const T*)ap, (T*)b, ldb, info, 1); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_cpptrs)(uplo, n, nrhs, (const T*)ap, (T*)b, ldb, info, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zpptrs)(uplo, n, nrhs, (const T*)ap, (T*)b, ldb, info, 1); }
+    #else
+           if(    is_float<eT>::value)  { typedef float    T; arma_fortran(arma_spptrs)(uplo, n, nrhs, (const T*)ap, (T*)b, ldb, info); }
+      else if(   is_double<eT>::value)  { typedef double   T; arma_fortran(arma_dpptrs)(uplo, n, nrhs, (const T*)ap, (T*)b, ldb, info); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_cpptrs)(uplo, n, nrhs, (const T*)ap, (T*)b, ldb, info); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zpptrs)(uplo, n, nrhs, (const T*)ap, (T*)b, ldb, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  tptrs(char* uplo, char* trans, char* diag, blas_int* n, blas_int* nrhs, const eT* ap, eT* b, blas_int* ldb, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if(    is_float<eT>::value)  { typedef float    T; arma_fortran(arma_stptrs)(uplo, trans, diag, n, nrhs, (const T*)ap, (T*)b, ldb, info, 1, 1, 1); }
+      else if(   is_double<eT>::value)  { typedef double   T; arma_fortran(arma_dtptrs)(uplo, trans, diag, n, nrhs, (const T*)ap, (T*)b, ldb, info, 1, 1, 1); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_ctptrs)(uplo, trans, diag, n, nrhs, (const T*)ap, (T*)b, ldb, info, 1, 1, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_ztptrs)(uplo, trans, diag, n, nrhs, (const T*)ap, (T*)b, ldb, info, 1, 1, 1); }
+    #else
+           if(    is_float<eT>::value)  { typedef float    T; arma_fortran(arma_stptrs)(uplo, trans, diag, n, nrhs, (const T*)ap, (T*)b, ldb, info); }
+      else if(   is_double<eT>::value)  { typedef double   T; arma_fortran(arma_dtptrs)(uplo, trans, diag, n, nrhs, (const T*)ap, (T*)b, ldb, info); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_ctptrs)(uplo, trans, diag, n, nrhs, (const T*)ap, (T*)b, ldb, info); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_ztptrs)(uplo, trans, diag, n, nrhs, (const T*)ap, (T*)b, ldb, info); }
+    #endif
+    }
+  
+  
+  
   template<typename eT>
   inline
   void
@@ -1241,6 +1329,82 @@ namespace lapack
   
   
   
+  template<typename eT>
+  inline
+  void
+  pbcon(char* uplo, blas_int* n, blas_int* kd, const eT* ab, blas_int* ldab, const eT* anorm, eT* rcond, eT* work, blas_int* iwork, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_spbcon)(uplo, n, kd, (T*)ab, ldab, (T*)anorm, (T*)rcond, (T*)work, iwork, info, 1); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dpbcon)(uplo, n, kd, (T*)ab, ldab, (T*)anorm, (T*)rcond, (T*)work, iwork, info, 1); }
+    #else
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_spbcon)(uplo, n, kd, (T*)ab, ldab, (T*)anorm, (T*)rcond, (T*)work, iwork, info); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dpbcon)(uplo, n, kd, (T*)ab, ldab, (T*)anorm, (T*)rcond, (T*)work, iwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename T>
+  inline
+  void
+  cx_pbcon(char* uplo, blas_int* n, blas_int* kd, const std::complex<T>* ab, blas_int* ldab, const T* anorm, T* rcond, std::complex<T>* work, T* rwork, blas_int* info)
+    {
+    typedef typename std::complex<T> eT;
+    
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_cx_float<eT>::value)  { typedef float  pod_T; typedef blas_cxf cx_T; arma_fortran(arma_cpbcon)(uplo, n, kd, (cx_T*)ab, ldab, (pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info, 1); }
+      else if(is_cx_double<eT>::value)  { typedef double pod_T; typedef blas_cxd cx_T; arma_fortran(arma_zpbcon)(uplo, n, kd, (cx_T*)ab, ldab, (pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info, 1); }
+    #else
+           if( is_cx_float<eT>::value)  { typedef float  pod_T; typedef blas_cxf cx_T; arma_fortran(arma_cpbcon)(uplo, n, kd, (cx_T*)ab, ldab, (pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info); }
+      else if(is_cx_double<eT>::value)  { typedef double pod_T; typedef blas_cxd cx_T; arma_fortran(arma_zpbcon)(uplo, n, kd, (cx_T*)ab, ldab, (pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  tpcon(char* norm, char* uplo, char* diag, blas_int* n, const eT* ap, eT* rcond, eT* work, blas_int* iwork, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_stpcon)(norm, uplo, diag, n, (T*)ap, (T*)rcond, (T*)work, iwork, info, 1, 1, 1); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dtpcon)(norm, uplo, diag, n, (T*)ap, (T*)rcond, (T*)work, iwork, info, 1, 1, 1); }
+    #else
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_stpcon)(norm, uplo, diag, n, (T*)ap, (T*)rcond, (T*)work, iwork, info); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dtpcon)(norm, uplo, diag, n, (T*)ap, (T*)rcond, (T*)work, iwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename T>
+  inline
+  void
+  cx_tpcon(char* norm, char* uplo, char* diag, blas_int* n, const std::complex<T>* ap, T* rcond, std::complex<T>* work, T* rwork, blas_int* info)
+    {
+    typedef typename std::complex<T> eT;
+    
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_cx_float<eT>::value)  { typedef float  pod_T; typedef blas_cxf cx_T; arma_fortran(arma_ctpcon)(norm, uplo, diag, n, (cx_T*)ap, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info, 1, 1, 1); }
+      else if(is_cx_double<eT>::value)  { typedef double pod_T; typedef blas_cxd cx_T; arma_fortran(arma_ztpcon)(norm, uplo, diag, n, (cx_T*)ap, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info, 1, 1, 1); }
+    #else
+           if( is_cx_float<eT>::value)  { typedef float  pod_T; typedef blas_cxf cx_T; arma_fortran(arma_ctpcon)(norm, uplo, diag, n, (cx_T*)ap, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info); }
+      else if(is_cx_double<eT>::value)  { typedef double pod_T; typedef blas_cxd cx_T; arma_fortran(arma_ztpcon)(norm, uplo, diag, n, (cx_T*)ap, (pod_T*)rcond, (cx_T*)work, (pod_T*)rwork, info); }
+    #endif
+    }
+  
+  
+  
   inline
   blas_int
   laenv(blas_int* ispec, char* name, char* opts, blas_int* n1, blas_int* n2, blas_int* n3, blas_int* n4, blas_len name_len, blas_len opts_len)
@@ -1341,6 +1505,152 @@ namespace lapack
     }
   
   
+  
+  template<typename eT>
+  inline
+  void
+  sytrf(char* uplo, blas_int* n, eT* a, blas_int* lda, blas_int* ipiv, eT* work, blas_int* lwork, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssytrf)(uplo, n, (T*)a, lda, ipiv, (T*)work, lwork, info, 1); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsytrf)(uplo, n, (T*)a, lda, ipiv, (T*)work, lwork, info, 1); }
+    #else
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssytrf)(uplo, n, (T*)a, lda, ipiv, (T*)work, lwork, info); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsytrf)(uplo, n, (T*)a, lda, ipiv, (T*)work, lwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  hetrf(char* uplo, blas_int* n, eT* a, blas_int* lda, blas_int* ipiv, eT* work, blas_int* lwork, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_chetrf)(uplo, n, (T*)a, lda, ipiv, (T*)work, lwork, info, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zhetrf)(uplo, n, (T*)a, lda, ipiv, (T*)work, lwork, info, 1); }
+    #else
+           if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_chetrf)(uplo, n, (T*)a, lda, ipiv, (T*)work, lwork, info); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zhetrf)(uplo, n, (T*)a, lda, ipiv, (T*)work, lwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  sytrs(char* uplo, blas_int* n, blas_int* nrhs, const eT* a, blas_int* lda, const blas_int* ipiv, eT* b, blas_int* ldb, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssytrs)(uplo, n, nrhs, (const T*)a, lda, ipiv, (T*)b, ldb, info, 1); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsytrs)(uplo, n, nrhs, (const T*)a, lda, ipiv, (T*)b, ldb, info, 1); }
+    #else
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssytrs)(uplo, n, nrhs, (const T*)a, lda, ipiv, (T*)b, ldb, info); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsytrs)(uplo, n, nrhs, (const T*)a, lda, ipiv, (T*)b, ldb, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  hetrs(char* uplo, blas_int* n, blas_int* nrhs, const eT* a, blas_int* lda, const blas_int* ipiv, eT* b, blas_int* ldb, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_chetrs)(uplo, n, nrhs, (const T*)a, lda, ipiv, (T*)b, ldb, info, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zhetrs)(uplo, n, nrhs, (const T*)a, lda, ipiv, (T*)b, ldb, info, 1); }
+    #else
+           if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_chetrs)(uplo, n, nrhs, (const T*)a, lda, ipiv, (T*)b, ldb, info); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zhetrs)(uplo, n, nrhs, (const T*)a, lda, ipiv, (T*)b, ldb, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  sycon(char* uplo, blas_int* n, const eT* a, blas_int* lda, const blas_int* ipiv, const eT* anorm, eT* rcond, eT* work, blas_int* iwork, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssycon)(uplo, n, (const T*)a, lda, ipiv, (const T*)anorm, (T*)rcond, (T*)work, iwork, info, 1); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsycon)(uplo, n, (const T*)a, lda, ipiv, (const T*)anorm, (T*)rcond, (T*)work, iwork, info, 1); }
+    #else
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssycon)(uplo, n, (const T*)a, lda, ipiv, (const T*)anorm, (T*)rcond, (T*)work, iwork, info); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsycon)(uplo, n, (const T*)a, lda, ipiv, (const T*)anorm, (T*)rcond, (T*)work, iwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename T>
+  inline
+  void
+  cx_hecon(char* uplo, blas_int* n, const std::complex<T>* a, blas_int* lda, const blas_int* ipiv, const T* anorm, T* rcond, std::complex<T>* work, blas_int* info)
+    {
+    typedef typename std::complex<T> eT;
+    
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_cx_float<eT>::value)  { typedef float  pod_T; typedef blas_cxf cx_T; arma_fortran(arma_checon)(uplo, n, (const cx_T*)a, lda, ipiv, (const pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, info, 1); }
+      else if(is_cx_double<eT>::value)  { typedef double pod_T; typedef blas_cxd cx_T; arma_fortran(arma_zhecon)(uplo, n, (const cx_T*)a, lda, ipiv, (const pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, info, 1); }
+    #else
+           if( is_cx_float<eT>::value)  { typedef float  pod_T; typedef blas_cxf cx_T; arma_fortran(arma_checon)(uplo, n, (const cx_T*)a, lda, ipiv, (const pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, info); }
+      else if(is_cx_double<eT>::value)  { typedef double pod_T; typedef blas_cxd cx_T; arma_fortran(arma_zhecon)(uplo, n, (const cx_T*)a, lda, ipiv, (const pod_T*)anorm, (pod_T*)rcond, (cx_T*)work, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  ormqr(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, const eT* a, blas_int* lda, const eT* tau, eT* c, blas_int* ldc, eT* work, blas_int* lwork, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_sormqr)(side, trans, m, n, k, (const T*)a, lda, (const T*)tau, (T*)c, ldc, (T*)work, lwork, info, 1, 1); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dormqr)(side, trans, m, n, k, (const T*)a, lda, (const T*)tau, (T*)c, ldc, (T*)work, lwork, info, 1, 1); }
+    #else
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_sormqr)(side, trans, m, n, k, (const T*)a, lda, (const T*)tau, (T*)c, ldc, (T*)work, lwork, info); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dormqr)(side, trans, m, n, k, (const T*)a, lda, (const T*)tau, (T*)c, ldc, (T*)work, lwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  unmqr(char* side, char* trans, blas_int* m, blas_int* n, blas_int* k, const eT* a, blas_int* lda, const eT* tau, eT* c, blas_int* ldc, eT* work, blas_int* lwork, blas_int* info)
+    {
+    arma_type_check(( is_supported_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_cunmqr)(side, trans, m, n, k, (const T*)a, lda, (const T*)tau, (T*)c, ldc, (T*)work, lwork, info, 1, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zunmqr)(side, trans, m, n, k, (const T*)a, lda, (const T*)tau, (T*)c, ldc, (T*)work, lwork, info, 1, 1); }
+    #else
+           if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_cunmqr)(side, trans, m, n, k, (const T*)a, lda, (const T*)tau, (T*)c, ldc, (T*)work, lwork, info); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zunmqr)(side, trans, m, n, k, (const T*)a, lda, (const T*)tau, (T*)c, ldc, (T*)work, lwork, info); }
+    #endif
+    }
+  
+  
   }
 
 
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup trimat_packed
+//! @{
+
+
+//! Dense square upper or lower triangular matrix, with the triangle stored column by column in LAPACK packed storage:
+//! element A(i,j) is held at position i + j*(j+1)/2 (upper, i <= j) or i + j*(2*n-j-1)/2 (lower, i >= j).
+//! Memory use is n*(n+1)/2 elements.
+template<typename eT>
+class trimat_packed
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  const uword n_rows;    //!< number of rows (same as n_cols)
+  const uword n_cols;    //!< number of columns
+  const bool  is_lower;  //!< true if the lower triangle is stored
+  
+  inline trimat_packed();
+  inline trimat_packed(const trimat_packed& x);
+  inline trimat_packed& operator=(const trimat_packed& x);
+  
+  inline explicit trimat_packed(const uword in_n, const char* layout = "upper");
+  
+  template<typename T1> inline explicit trimat_packed(const Base<eT,T1>& expr, const char* layout = "upper");
+  
+  arma_inline       eT& at(const uword in_row, const uword in_col);
+  arma_inline const eT& at(const uword in_row, const uword in_col) const;
+  
+  inline StructValProxy< trimat_packed<eT> > operator()(const uword in_row, const uword in_col);
+  inline eT                                  operator()(const uword in_row, const uword in_col) const;
+  
+  inline bool in_triangle(const uword in_row, const uword in_col) const;
+  
+  inline       eT* memptr();
+  inline const eT* memptr() const;
+  
+  inline Mat<eT> as_dense() const;
+  
+  template<typename T1> inline void mul(Mat<eT>& out, const Base<eT,T1>& X) const;
+  
+  template<typename T1> inline bool solve(Mat<eT>& X, const Base<eT,T1>& B, const uword flags = uword(0)) const;
+  
+  
+  private:
+  
+  friend class StructValProxy< trimat_packed<eT> >;
+  
+  inline eT   get_elem(const uword in_row, const uword in_col) const;
+  inline void set_elem(const uword in_row, const uword in_col, const eT val);
+  
+  arma_aligned Col<eT> AP;  //!< packed triangle
+  
+  arma_inline uword offset(const uword in_row, const uword in_col) const;
+  
+  inline static bool parse_layout(const char* layout);
+  };
+
+
+
+//! @}
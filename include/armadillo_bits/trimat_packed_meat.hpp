@@ -0,0 +1,434 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup trimat_packed
+//! @{
+
+
+
+template<typename eT>
+inline
+trimat_packed<eT>::trimat_packed()
+  : n_rows  (0    )
+  , n_cols  (0    )
+  , is_lower(false)
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+trimat_packed<eT>::trimat_packed(const trimat_packed<eT>& x)
+  : n_rows  (x.n_rows  )
+  , n_cols  (x.n_cols  )
+  , is_lower(x.is_lower)
+  , AP      (x.AP      )
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+trimat_packed<eT>&
+trimat_packed<eT>::operator=(const trimat_packed<eT>& x)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(this != &x)
+    {
+    access::rw(n_rows)   = x.n_rows;
+    access::rw(n_cols)   = x.n_cols;
+    access::rw(is_lower) = x.is_lower;
+    
+    AP = x.AP;
+    }
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+trimat_packed<eT>::parse_layout(const char* layout)
+  {
+  const char sig = (layout != nullptr) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "trimat_packed(): layout must be \"upper\" or \"lower\"" );
+  
+  return (sig == 'l');
+  }
+
+
+
+//! n x n matrix with all elements set to zero
+template<typename eT>
+inline
+trimat_packed<eT>::trimat_packed(const uword in_n, const char* layout)
+  : n_rows  (in_n)
+  , n_cols  (in_n)
+  , is_lower(trimat_packed<eT>::parse_layout(layout))
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  AP.zeros( (in_n * (in_n + 1)) / 2 );
+  }
+
+
+
+//! copy of the upper or lower triangle of a square dense matrix; the other triangle is ignored
+template<typename eT>
+template<typename T1>
+inline
+trimat_packed<eT>::trimat_packed(const Base<eT,T1>& expr, const char* layout)
+  : n_rows  (0)
+  , n_cols  (0)
+  , is_lower(trimat_packed<eT>::parse_layout(layout))
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const quasi_unwrap<T1> U(expr.get_ref());
+  
+  const Mat<eT>& A = U.M;
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "trimat_packed(): given matrix must be square sized" );
+  
+  const uword N = A.n_rows;
+  
+  access::rw(n_rows) = N;
+  access::rw(n_cols) = N;
+  
+  AP.set_size( (N * (N + 1)) / 2 );
+  
+  eT* AP_mem = AP.memptr();
+  
+  for(uword col=0; col < N; ++col)
+    {
+    if(is_lower)
+      {
+      arrayops::copy( &(AP_mem[ offset(col,col) ]), &(A.at(col,col)), N - col );
+      }
+    else
+      {
+      arrayops::copy( &(AP_mem[ offset(0,col) ]), A.colptr(col), col + 1 );
+      }
+    }
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+trimat_packed<eT>::offset(const uword in_row, const uword in_col) const
+  {
+  return (is_lower) ? ( in_row + (in_col * (2*n_rows - in_col - 1)) / 2 ) : ( in_row + (in_col * (in_col + 1)) / 2 );
+  }
+
+
+
+template<typename eT>
+inline
+bool
+trimat_packed<eT>::in_triangle(const uword in_row, const uword in_col) const
+  {
+  return (is_lower) ? (in_row >= in_col) : (in_row <= in_col);
+  }
+
+
+
+//! element A(in_row,in_col) of the stored triangle, without bounds checks
+template<typename eT>
+arma_inline
+eT&
+trimat_packed<eT>::at(const uword in_row, const uword in_col)
+  {
+  return AP[ offset(in_row, in_col) ];
+  }
+
+
+
+template<typename eT>
+arma_inline
+const eT&
+trimat_packed<eT>::at(const uword in_row, const uword in_col) const
+  {
+  return AP[ offset(in_row, in_col) ];
+  }
+
+
+
+template<typename eT>
+inline
+StructValProxy< trimat_packed<eT> >
+trimat_packed<eT>::operator()(const uword in_row, const uword in_col)
+  {
+  arma_debug_check_bounds( ((in_row >= n_rows) || (in_col >= n_cols)), "trimat_packed::operator(): index out of bounds" );
+  
+  return StructValProxy< trimat_packed<eT> >(in_row, in_col, *this);
+  }
+
+
+
+template<typename eT>
+inline
+eT
+trimat_packed<eT>::operator()(const uword in_row, const uword in_col) const
+  {
+  arma_debug_check_bounds( ((in_row >= n_rows) || (in_col >= n_cols)), "trimat_packed::operator(): index out of bounds" );
+  
+  return (*this).get_elem(in_row, in_col);
+  }
+
+
+
+//! element A(in_row,in_col); elements outside of the stored triangle are zero
+template<typename eT>
+inline
+eT
+trimat_packed<eT>::get_elem(const uword in_row, const uword in_col) const
+  {
+  return ((*this).in_triangle(in_row, in_col)) ? (*this).at(in_row, in_col) : eT(0);
+  }
+
+
+
+//! set element A(in_row,in_col); only zero can be written to elements outside of the stored triangle
+template<typename eT>
+inline
+void
+trimat_packed<eT>::set_elem(const uword in_row, const uword in_col, const eT val)
+  {
+  if((*this).in_triangle(in_row, in_col))
+    {
+    (*this).at(in_row, in_col) = val;
+    }
+  else
+    {
+    arma_debug_check( (val != eT(0)), "trimat_packed::operator(): element is outside of the stored triangle" );
+    }
+  }
+
+
+
+//! packed storage, as used by LAPACK with uplo = 'U' or 'L'
+template<typename eT>
+inline
+eT*
+trimat_packed<eT>::memptr()
+  {
+  return AP.memptr();
+  }
+
+
+
+template<typename eT>
+inline
+const eT*
+trimat_packed<eT>::memptr() const
+  {
+  return AP.memptr();
+  }
+
+
+
+template<typename eT>
+inline
+Mat<eT>
+trimat_packed<eT>::as_dense() const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = n_rows;
+  
+  Mat<eT> out(N, N, arma_zeros_indicator());
+  
+  const eT* AP_mem = AP.memptr();
+  
+  for(uword col=0; col < N; ++col)
+    {
+    if(is_lower)
+      {
+      arrayops::copy( &(out.at(col,col)), &(AP_mem[ offset(col,col) ]), N - col );
+      }
+    else
+      {
+      arrayops::copy( out.colptr(col), &(AP_mem[ offset(0,col) ]), col + 1 );
+      }
+    }
+  
+  return out;
+  }
+
+
+
+//! out = A * X
+template<typename eT>
+template<typename T1>
+inline
+void
+trimat_packed<eT>::mul(Mat<eT>& out, const Base<eT,T1>& X_expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X_expr.get_ref());
+  
+  const Mat<eT>& X = U.M;
+  
+  arma_debug_assert_mul_size(n_rows, n_cols, X.n_rows, X.n_cols, "matrix multiplication");
+  
+  if(U.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    (*this).mul(tmp, X);
+    
+    out.steal_mem(tmp);
+    
+    return;
+    }
+  
+  out.set_size(n_rows, X.n_cols);
+  
+  const uword N      = n_rows;
+  const uword X_cols = X.n_cols;
+  
+  const eT* AP_mem = AP.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp    = mp_gate<eT>::eval(AP.n_elem * X_cols);
+    const int  n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #endif
+  
+  // the rows have different lengths, so they are handed out in small blocks
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(dynamic,64) num_threads(n_threads) if(use_mp)
+  #endif
+  for(uword row=0; row < N; ++row)
+    {
+    const uword col_start = (is_lower) ? uword(0) : row;
+    const uword col_endp1 = (is_lower) ? (row+1)  : N;
+    
+    for(uword c=0; c < X_cols; ++c)
+      {
+      const eT* X_col = X.colptr(c);
+      
+      eT acc = eT(0);
+      
+      uword k = offset(row, col_start);
+      
+      for(uword col=col_start; col < col_endp1; ++col)
+        {
+        acc += AP_mem[k] * X_col[col];
+        
+        // distance to A(row,col+1)
+        k += (is_lower) ? (N - col - 1) : (col + 1);
+        }
+      
+      out.at(row, c) = acc;
+      }
+    }
+  }
+
+
+
+//! solve A*X = B via forward or backward substitution (tptrs);
+//! unless solve_opts::flag_fast is given, the reciprocal condition number is estimated (tpcon),
+//! and systems with rcond below machine epsilon are rejected, unless solve_opts::flag_allow_ugly is given
+template<typename eT>
+template<typename T1>
+inline
+bool
+trimat_packed<eT>::solve(Mat<eT>& X, const Base<eT,T1>& B_expr, const uword flags) const
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename get_pod_type<eT>::result T;
+    
+    const bool fast       = bool(flags & solve_opts::flag_fast      );
+    const bool allow_ugly = bool(flags & solve_opts::flag_allow_ugly);
+    
+    if(flags & solve_opts::flag_equilibrate )  { arma_debug_warn_level(2, "solve(): option 'equilibrate' ignored for triangular matrix" ); }
+    if(flags & solve_opts::flag_refine      )  { arma_debug_warn_level(2, "solve(): option 'refine' ignored for triangular matrix"      ); }
+    if(flags & solve_opts::flag_likely_sympd)  { arma_debug_warn_level(2, "solve(): option 'likely_sympd' ignored for triangular matrix"); }
+    if(flags & solve_opts::flag_force_approx)  { arma_debug_warn_level(2, "solve(): option 'force_approx' ignored for triangular matrix"); }
+    if(flags & solve_opts::flag_mixed       )  { arma_debug_warn_level(2, "solve(): option 'mixed' ignored for triangular matrix"       ); }
+    if(flags & solve_opts::flag_no_trimat   )  { arma_debug_warn_level(2, "solve(): option 'no_trimat' ignored for triangular matrix"   ); }
+    
+    X = B_expr.get_ref();
+    
+    arma_debug_check( (X.n_rows != n_rows), "solve(): number of rows in given matrices must be the same", [&](){ X.soft_reset(); } );
+    
+    if( (n_rows == 0) || X.is_empty() )  { X.zeros(n_rows, X.n_cols); return true; }
+    
+    arma_debug_assert_blas_size(X);
+    
+    char     uplo  = (is_lower) ? 'L' : 'U';
+    char     trans = 'N';
+    char     diag  = 'N';
+    blas_int n     = blas_int(n_rows);
+    blas_int nrhs  = blas_int(X.n_cols);
+    blas_int ldb   = blas_int(X.n_rows);
+    blas_int info  = blas_int(0);
+    
+    arma_extra_debug_print("lapack::tptrs()");
+    lapack::tptrs(&uplo, &trans, &diag, &n, &nrhs, AP.memptr(), X.memptr(), &ldb, &info);
+    
+    if(info != 0)
+      {
+      arma_debug_warn_level(2, "solve(): system is singular");
+      return false;
+      }
+    
+    if(fast == false)
+      {
+      // tptrs only detects an exact zero on the diagonal
+      const T rcond = auxlib::rcond_trimat_packed(AP, n_rows, ((is_lower) ? uword(1) : uword(0)));
+      
+      if( (allow_ugly == false) && ((rcond < std::numeric_limits<T>::epsilon()) || arma_isnan(rcond)) )
+        {
+        arma_debug_warn_level(2, "solve(): system is singular (rcond: ", rcond, ")");
+        return false;
+        }
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(B_expr);
+    arma_ignore(flags);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! @}
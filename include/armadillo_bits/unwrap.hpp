@@ -2390,6 +2390,129 @@ struct partial_unwrap< eOp<subview_row<eT>, eop_neg> >
 
 
 
+//! partial_unwrap_strided is a variant of partial_unwrap for use with BLAS functions that accept a leading dimension;
+//! a non-contiguous subview is described by a pointer to its first element and the number of rows in the parent matrix,
+//! instead of being copied into a temporary matrix; all other expressions are handled by partial_unwrap
+template<typename T1>
+struct partial_unwrap_strided
+  {
+  typedef typename T1::elem_type eT;
+  
+  inline
+  partial_unwrap_strided(const T1& A)
+    : U     (A           )
+    , mem   (U.M.memptr())
+    , n_rows(U.M.n_rows  )
+    , n_cols(U.M.n_cols  )
+    , ld    (U.M.n_rows  )
+    {
+    arma_extra_debug_sigprint();
+    }
+  
+  inline eT get_val() const { return U.get_val(); }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return U.is_alias(X); }
+  
+  static constexpr bool use_strided(const T1&) { return false; }
+  
+  static constexpr bool do_trans   = partial_unwrap<T1>::do_trans;
+  static constexpr bool do_times   = partial_unwrap<T1>::do_times;
+  static constexpr bool is_strided = false;
+  
+  const partial_unwrap<T1> U;
+  
+  const eT*   mem;
+  const uword n_rows;
+  const uword n_cols;
+  const uword ld;
+  };
+
+
+
+template<typename eT>
+struct partial_unwrap_strided_subview
+  {
+  inline
+  partial_unwrap_strided_subview(const subview<eT>& A)
+    : sv    (A       )
+    , mem   ( (A.n_elem > 0) ? A.colptr(0) : nullptr )
+    , n_rows(A.n_rows)
+    , n_cols(A.n_cols)
+    , ld    (A.m.n_rows)
+    {
+    arma_extra_debug_sigprint();
+    }
+  
+  //! worthwhile only when partial_unwrap would need to copy the subview, and the copy is not trivially small
+  inline static bool use_subview(const subview<eT>& A) { return ( (A.n_rows != A.m.n_rows) && (A.n_cols > 1) && (A.n_elem >= uword(64)) ); }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return (void_ptr(&(sv.m)) == void_ptr(&X)); }
+  
+  static constexpr bool is_strided = true;
+  
+  const subview<eT>& sv;
+  
+  const eT*   mem;
+  const uword n_rows;
+  const uword n_cols;
+  const uword ld;
+  };
+
+
+
+template<typename eT>
+struct partial_unwrap_strided< subview<eT> > : public partial_unwrap_strided_subview<eT>
+  {
+  inline partial_unwrap_strided(const subview<eT>& A) : partial_unwrap_strided_subview<eT>(A) {}
+  
+  inline static bool use_strided(const subview<eT>& A) { return partial_unwrap_strided_subview<eT>::use_subview(A); }
+  
+  constexpr eT get_val() const { return eT(1); }
+  
+  static constexpr bool do_trans = false;
+  static constexpr bool do_times = false;
+  };
+
+
+
+template<typename eT>
+struct partial_unwrap_strided< Op<subview<eT>, op_htrans> > : public partial_unwrap_strided_subview<eT>
+  {
+  inline partial_unwrap_strided(const Op<subview<eT>, op_htrans>& A) : partial_unwrap_strided_subview<eT>(A.m) {}
+  
+  inline static bool use_strided(const Op<subview<eT>, op_htrans>& A) { return partial_unwrap_strided_subview<eT>::use_subview(A.m); }
+  
+  constexpr eT get_val() const { return eT(1); }
+  
+  static constexpr bool do_trans = true;
+  static constexpr bool do_times = false;
+  };
+
+
+
+template<typename eT>
+struct partial_unwrap_strided< Op<subview<eT>, op_htrans2> > : public partial_unwrap_strided_subview<eT>
+  {
+  inline partial_unwrap_strided(const Op<subview<eT>, op_htrans2>& A) : partial_unwrap_strided_subview<eT>(A.m), val(A.aux) {}
+  
+  inline static bool use_strided(const Op<subview<eT>, op_htrans2>& A) { return partial_unwrap_strided_subview<eT>::use_subview(A.m); }
+  
+  inline eT get_val() const { return val; }
+  
+  static constexpr bool do_trans = true;
+  static constexpr bool do_times = true;
+  
+  const eT val;
+  };
+
+
+
+//
+
+
+
 template<typename T1>
 struct partial_unwrap_check_default
   {
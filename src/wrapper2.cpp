@@ -418,6 +418,94 @@ extern "C"
     
     
     
+    void arma_fortran_with_prefix(arma_spbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const    float* ab, const blas_int* ldab,    float* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_spbtrs)(uplo, n, kd, nrhs, ab, ldab, b, ldb, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_dpbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const   double* ab, const blas_int* ldab,   double* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_dpbtrs)(uplo, n, kd, nrhs, ab, ldab, b, ldb, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_cpbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const blas_cxf* ab, const blas_int* ldab, blas_cxf* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_cpbtrs)(uplo, n, kd, nrhs, ab, ldab, b, ldb, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_zpbtrs)(const char* uplo, const blas_int* n, const blas_int* kd, const blas_int* nrhs, const blas_cxd* ab, const blas_int* ldab, blas_cxd* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_zpbtrs)(uplo, n, kd, nrhs, ab, ldab, b, ldb, info, uplo_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_spptrf)(const char* uplo, const blas_int* n,    float* ap, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_spptrf)(uplo, n, ap, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_dpptrf)(const char* uplo, const blas_int* n,   double* ap, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_dpptrf)(uplo, n, ap, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_cpptrf)(const char* uplo, const blas_int* n, blas_cxf* ap, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_cpptrf)(uplo, n, ap, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_zpptrf)(const char* uplo, const blas_int* n, blas_cxd* ap, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_zpptrf)(uplo, n, ap, info, uplo_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_spptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const    float* ap,    float* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_spptrs)(uplo, n, nrhs, ap, b, ldb, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_dpptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const   double* ap,   double* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_dpptrs)(uplo, n, nrhs, ap, b, ldb, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_cpptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxf* ap, blas_cxf* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_cpptrs)(uplo, n, nrhs, ap, b, ldb, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_zpptrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxd* ap, blas_cxd* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_zpptrs)(uplo, n, nrhs, ap, b, ldb, info, uplo_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_stptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const    float* ap,    float* b, const blas_int* ldb, blas_int* info, blas_len uplo_len, blas_len trans_len, blas_len diag_len)
+      {
+      arma_fortran_sans_prefix(arma_stptrs)(uplo, trans, diag, n, nrhs, ap, b, ldb, info, uplo_len, trans_len, diag_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_dtptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const   double* ap,   double* b, const blas_int* ldb, blas_int* info, blas_len uplo_len, blas_len trans_len, blas_len diag_len)
+      {
+      arma_fortran_sans_prefix(arma_dtptrs)(uplo, trans, diag, n, nrhs, ap, b, ldb, info, uplo_len, trans_len, diag_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_ctptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const blas_cxf* ap, blas_cxf* b, const blas_int* ldb, blas_int* info, blas_len uplo_len, blas_len trans_len, blas_len diag_len)
+      {
+      arma_fortran_sans_prefix(arma_ctptrs)(uplo, trans, diag, n, nrhs, ap, b, ldb, info, uplo_len, trans_len, diag_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_ztptrs)(const char* uplo, const char* trans, const char* diag, const blas_int* n, const blas_int* nrhs, const blas_cxd* ap, blas_cxd* b, const blas_int* ldb, blas_int* info, blas_len uplo_len, blas_len trans_len, blas_len diag_len)
+      {
+      arma_fortran_sans_prefix(arma_ztptrs)(uplo, trans, diag, n, nrhs, ap, b, ldb, info, uplo_len, trans_len, diag_len);
+      }
+    
+    
+    
     void arma_fortran_with_prefix(arma_spotri)(const char* uplo, const blas_int* n,    float* a, const blas_int* lda, blas_int* info, blas_len uplo_len)
       {
       arma_fortran_sans_prefix(arma_spotri)(uplo, n, a, lda, info, uplo_len);
@@ -1156,6 +1244,102 @@ extern "C"
       arma_fortran_sans_prefix(arma_zpstrf)(uplo, n, a, lda, piv, rank, tol, work, info, uplo_len);
       }
     
+    
+    
+    void arma_fortran_with_prefix(arma_ssytrf)(const char* uplo, const blas_int* n,  float* a, const blas_int* lda, blas_int* ipiv,  float* work, const blas_int* lwork, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_ssytrf)(uplo, n, a, lda, ipiv, work, lwork, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_dsytrf)(const char* uplo, const blas_int* n, double* a, const blas_int* lda, blas_int* ipiv, double* work, const blas_int* lwork, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_dsytrf)(uplo, n, a, lda, ipiv, work, lwork, info, uplo_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_chetrf)(const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda, blas_int* ipiv, blas_cxf* work, const blas_int* lwork, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_chetrf)(uplo, n, a, lda, ipiv, work, lwork, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_zhetrf)(const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, blas_int* ipiv, blas_cxd* work, const blas_int* lwork, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_zhetrf)(uplo, n, a, lda, ipiv, work, lwork, info, uplo_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_ssytrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const  float* a, const blas_int* lda, const blas_int* ipiv,  float* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_ssytrs)(uplo, n, nrhs, a, lda, ipiv, b, ldb, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_dsytrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const double* a, const blas_int* lda, const blas_int* ipiv, double* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_dsytrs)(uplo, n, nrhs, a, lda, ipiv, b, ldb, info, uplo_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_chetrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxf* a, const blas_int* lda, const blas_int* ipiv, blas_cxf* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_chetrs)(uplo, n, nrhs, a, lda, ipiv, b, ldb, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_zhetrs)(const char* uplo, const blas_int* n, const blas_int* nrhs, const blas_cxd* a, const blas_int* lda, const blas_int* ipiv, blas_cxd* b, const blas_int* ldb, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_zhetrs)(uplo, n, nrhs, a, lda, ipiv, b, ldb, info, uplo_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_ssycon)(const char* uplo, const blas_int* n, const  float* a, const blas_int* lda, const blas_int* ipiv, const  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_ssycon)(uplo, n, a, lda, ipiv, anorm, rcond, work, iwork, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_dsycon)(const char* uplo, const blas_int* n, const double* a, const blas_int* lda, const blas_int* ipiv, const double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_dsycon)(uplo, n, a, lda, ipiv, anorm, rcond, work, iwork, info, uplo_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_checon)(const char* uplo, const blas_int* n, const blas_cxf* a, const blas_int* lda, const blas_int* ipiv, const  float* anorm,  float* rcond, blas_cxf* work, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_checon)(uplo, n, a, lda, ipiv, anorm, rcond, work, info, uplo_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_zhecon)(const char* uplo, const blas_int* n, const blas_cxd* a, const blas_int* lda, const blas_int* ipiv, const double* anorm, double* rcond, blas_cxd* work, blas_int* info, blas_len uplo_len)
+      {
+      arma_fortran_sans_prefix(arma_zhecon)(uplo, n, a, lda, ipiv, anorm, rcond, work, info, uplo_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_sormqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const  float* a, const blas_int* lda, const  float* tau,  float* c, const blas_int* ldc,  float* work, const blas_int* lwork, blas_int* info, blas_len side_len, blas_len trans_len)
+      {
+      arma_fortran_sans_prefix(arma_sormqr)(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info, side_len, trans_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_dormqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const double* a, const blas_int* lda, const double* tau, double* c, const blas_int* ldc, double* work, const blas_int* lwork, blas_int* info, blas_len side_len, blas_len trans_len)
+      {
+      arma_fortran_sans_prefix(arma_dormqr)(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info, side_len, trans_len);
+      }
+    
+    
+    
+    void arma_fortran_with_prefix(arma_cunmqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const blas_cxf* a, const blas_int* lda, const blas_cxf* tau, blas_cxf* c, const blas_int* ldc, blas_cxf* work, const blas_int* lwork, blas_int* info, blas_len side_len, blas_len trans_len)
+      {
+      arma_fortran_sans_prefix(arma_cunmqr)(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info, side_len, trans_len);
+      }
+    
+    void arma_fortran_with_prefix(arma_zunmqr)(const char* side, const char* trans, const blas_int* m, const blas_int* n, const blas_int* k, const blas_cxd* a, const blas_int* lda, const blas_cxd* tau, blas_cxd* c, const blas_int* ldc, blas_cxd* work, const blas_int* lwork, blas_int* info, blas_len side_len, blas_len trans_len)
+      {
+      arma_fortran_sans_prefix(arma_zunmqr)(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info, side_len, trans_len);
+      }
+    
   #endif
   
   
@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("band_mat_conversion")
+  {
+  const uword N = 20;
+  
+  mat A(N, N, fill::randu);
+  
+  // 3 subdiagonals and 2 superdiagonals
+  
+  mat D = A;
+  
+  for(uword j=0; j < N; ++j)
+  for(uword i=0; i < N; ++i)
+    {
+    if( (i > j+3) || (j > i+2) )  { D(i,j) = 0.0; }
+    }
+  
+  band_mat<double> B(D);
+  
+  REQUIRE( B.n_rows == N );
+  REQUIRE( B.kl     == 3 );
+  REQUIRE( B.ku     == 2 );
+  
+  REQUIRE( approx_equal(B.as_dense(), D, "absdiff", 0.0) );
+  
+  // explicit band: elements outside of the band are ignored
+  
+  band_mat<double> C(A, 1, 1);
+  
+  REQUIRE( approx_equal(C.as_dense(), mat(trimatl(trimatu(A, -1), 1)), "absdiff", 0.0) );
+  
+  REQUIRE( B(5,2) == D(5,2) );
+  REQUIRE( B(0,10) == 0.0 );
+  
+  B(4,6) = 7.0;
+  
+  REQUIRE( B.as_dense()(4,6) == 7.0 );
+  
+  REQUIRE_THROWS( B(10,0) = 1.0 );
+  
+  B(10,0) = 0.0;  // writing a zero outside of the band is allowed
+  
+  B(6,5) += 1.0;
+  
+  REQUIRE( B(6,5) == (D(6,5) + 1.0) );
+  
+  // diagonals
+  
+  const mat BD = B.as_dense();
+  
+  REQUIRE( approx_equal(vec(B.diag( 0).t()), vec(BD.diag( 0)), "absdiff", 0.0) );
+  REQUIRE( approx_equal(vec(B.diag(-3).t()), vec(BD.diag(-3)), "absdiff", 0.0) );
+  REQUIRE( approx_equal(vec(B.diag( 2).t()), vec(BD.diag( 2)), "absdiff", 0.0) );
+  
+  B.diag(1).fill(5.0);
+  
+  REQUIRE( all(B.as_dense().diag(1) == 5.0) );
+  
+  REQUIRE_THROWS( B.diag(3) );
+  REQUIRE_THROWS( B.diag(-4) );
+  
+  band_mat<double> E(N, 1, 1);
+  
+  REQUIRE( accu(abs(E.as_dense())) == 0.0 );
+  
+  REQUIRE_THROWS( band_mat<double>(4, 4, 1) );
+  REQUIRE_THROWS( band_mat<double>(mat(4, 5, fill::zeros)) );
+  }
+
+
+
+TEST_CASE("band_mat_mul")
+  {
+  const uword N = 300;
+  
+  band_mat<double> B(N, 2, 1);
+  
+  B.diag(-2).randu();
+  B.diag(-1).randu();
+  B.diag( 0).randu();
+  B.diag( 1).randu();
+  
+  const mat D = B.as_dense();
+  
+  const mat X(N, 3, fill::randu);
+  
+  mat Y;
+  
+  B.mul(Y, X);
+  
+  REQUIRE( approx_equal(Y, D*X, "reldiff", 1e-12) );
+  
+  vec x(N, fill::randu);
+  
+  const vec y = D*x;
+  
+  B.mul(x, x);  // aliasing
+  
+  REQUIRE( approx_equal(x, y, "reldiff", 1e-12) );
+  
+  REQUIRE_THROWS( B.mul(Y, mat(N+1, 1)) );
+  }
+
+
+
+TEST_CASE("band_mat_solve")
+  {
+  const uword N = 500;
+  
+  // pentadiagonal, diagonally dominant
+  
+  band_mat<double> A(N, 2, 2);
+  
+  A.diag(-2).fill(-1.0);
+  A.diag(-1).fill(-2.0);
+  A.diag( 0).fill(10.0);
+  A.diag( 1).fill(-2.0);
+  A.diag( 2).fill(-1.0);
+  
+  const mat D = A.as_dense();
+  
+  const mat B(N, 2, fill::randu);
+  
+  const mat X1 = solve(A, B);
+  const mat X2 = solve(A, B, solve_opts::likely_sympd);
+  const mat X3 = solve(D, B);
+  
+  REQUIRE( approx_equal(X1, X3, "reldiff", 1e-10) );
+  REQUIRE( approx_equal(X2, X3, "reldiff", 1e-10) );
+  
+  // unsymmetric band
+  
+  band_mat<double> U(N, 1, 3);
+  
+  U.diag(-1).randu();
+  U.diag( 0).fill(5.0);
+  U.diag( 1).randu();
+  U.diag( 3).randu();
+  
+  mat X4;
+  
+  REQUIRE( solve(X4, U, B) );
+  
+  REQUIRE( approx_equal(U.as_dense()*X4, B, "reldiff", 1e-10) );
+  
+  // symmetric but indefinite: falls back to LU decomposition
+  
+  band_mat<double> S(N, 1, 1);
+  
+  S.diag(-1).fill(1.0);
+  S.diag( 0).fill(0.5);
+  S.diag( 1).fill(1.0);
+  
+  mat X5;
+  
+  REQUIRE( solve(X5, S, B, solve_opts::likely_sympd) );
+  
+  REQUIRE( approx_equal(S.as_dense()*X5, B, "reldiff", 1e-8) );
+  
+  // singular
+  
+  band_mat<double> Z(N, 1, 1);
+  
+  mat X6;
+  
+  REQUIRE( solve(X6, Z, B) == false );
+  REQUIRE( X6.n_elem == 0 );
+  
+  REQUIRE_THROWS( X6 = solve(Z, B) );
+  }
+
+
+
+TEST_CASE("band_mat_solve_rcond")
+  {
+  const mat A =
+    {
+    { 1.0,   0.0, 0.0 },
+    { 0.0, 1e-20, 0.0 },
+    { 0.0,   0.0, 1.0 }
+    };
+  
+  const band_mat<double> S(A, 1, 1);
+  
+  const vec b = { 1.0, 1.0, 1.0 };
+  
+  vec x;
+  
+  // nearly singular: tptrs and gbtrs would succeed, but rcond is below epsilon
+  
+  REQUIRE( solve(x, S, b) == false );
+  REQUIRE( x.n_elem == 0 );
+  
+  REQUIRE( solve(x, S, b, solve_opts::likely_sympd) == false );
+  
+  REQUIRE( solve(x, S, b, solve_opts::allow_ugly) );
+  REQUIRE( x(1) == Approx(1e20) );
+  
+  REQUIRE( solve(x, S, b, solve_opts::likely_sympd + solve_opts::allow_ugly) );
+  REQUIRE( x(1) == Approx(1e20) );
+  
+  REQUIRE( solve(x, S, b, solve_opts::fast) );
+  }
+
+
+
+TEST_CASE("band_mat_cx")
+  {
+  const uword N = 100;
+  
+  band_mat<cx_double> A(N, 1, 2);
+  
+  A.diag(-1).randu();
+  A.diag( 0).fill(cx_double(6.0, 1.0));
+  A.diag( 1).randu();
+  A.diag( 2).randn();
+  
+  const cx_mat B(N, 2, fill::randu);
+  
+  const cx_mat X = solve(A, B);
+  
+  cx_mat AX;
+  
+  A.mul(AX, X);
+  
+  REQUIRE( approx_equal(AX, B, "reldiff", 1e-10) );
+  }
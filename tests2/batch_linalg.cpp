@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+template<typename eT>
+inline
+Cube<eT>
+batch_linalg_make_sympd(const uword N, const uword n_slices)
+  {
+  Cube<eT> X(N, N, n_slices);
+  
+  for(uword s=0; s < n_slices; ++s)
+    {
+    const Mat<eT> B(N, N, fill::randu);
+  
+    X.slice(s) = B.t()*B + Mat<eT>(N, N, fill::eye) * eT(N);
+    }
+  
+  return X;
+  }
+
+
+
+TEST_CASE("batch_linalg_chol")
+  {
+  const uword sizes[] = { 1, 5, 10, 11, 40 };
+  
+  for(const uword N : sizes)
+    {
+    const cube X = batch_linalg_make_sympd<double>(N, 12);
+  
+    const cube R = chol(X);
+  
+    cube L;
+  
+    const bool status = chol(L, X, "lower");
+  
+    REQUIRE( status == true );
+    REQUIRE( R.n_slices == X.n_slices );
+  
+    for(uword s=0; s < X.n_slices; ++s)
+      {
+      REQUIRE( approx_equal(R.slice(s), chol(X.slice(s)),          "reldiff", 1e-10) );
+      REQUIRE( approx_equal(L.slice(s), chol(X.slice(s), "lower"), "reldiff", 1e-10) );
+      }
+    }
+  
+  const cx_cube Y = batch_linalg_make_sympd<cx_double>(6, 4);
+  
+  const cx_cube RY = chol(Y);
+  
+  for(uword s=0; s < Y.n_slices; ++s)
+    {
+    REQUIRE( approx_equal(RY.slice(s), chol(Y.slice(s)), "reldiff", 1e-10) );
+    }
+  }
+
+
+
+TEST_CASE("batch_linalg_chol_fail")
+  {
+  const uword sizes[] = { 5, 40 };
+  
+  for(const uword N : sizes)
+    {
+    cube X = batch_linalg_make_sympd<double>(N, 6);
+  
+    X.slice(2) *= -1.0;
+  
+    cube R;
+  
+    const bool status = chol(R, X);
+  
+    REQUIRE( status == false );
+    REQUIRE( R.n_slices == X.n_slices );
+    REQUIRE( R.slice(2).has_nan() );
+  
+    for(uword s=0; s < X.n_slices; ++s)
+      {
+      if(s == 2)  { continue; }
+  
+      REQUIRE( approx_equal(R.slice(s), chol(X.slice(s)), "reldiff", 1e-10) );
+      }
+  
+    cube R2;
+  
+    REQUIRE_THROWS( R2 = chol(X) );
+    }
+  }
+
+
+
+TEST_CASE("batch_linalg_inv_sympd")
+  {
+  const uword sizes[] = { 1, 8, 12, 13, 40 };
+  
+  for(const uword N : sizes)
+    {
+    const cube X = batch_linalg_make_sympd<double>(N, 10);
+  
+    const cube Y = inv_sympd(X);
+  
+    for(uword s=0; s < X.n_slices; ++s)
+      {
+      REQUIRE( approx_equal(Y.slice(s), inv_sympd(X.slice(s)), "reldiff", 1e-8) );
+      }
+    }
+  
+  const cx_cube Z = batch_linalg_make_sympd<cx_double>(7, 3);
+  
+  cx_cube Zinv;
+  
+  REQUIRE( inv_sympd(Zinv, Z) );
+  
+  for(uword s=0; s < Z.n_slices; ++s)
+    {
+    REQUIRE( approx_equal(Zinv.slice(s), inv_sympd(Z.slice(s)), "reldiff", 1e-8) );
+    }
+  
+  cube W = batch_linalg_make_sympd<double>(8, 3);
+  
+  W.slice(1).zeros();
+  
+  cube Winv;
+  
+  REQUIRE( inv_sympd(Winv, W) == false );
+  REQUIRE( Winv.slice(1).has_nan() );
+  REQUIRE( Winv.slice(0).is_finite() );
+  REQUIRE( Winv.slice(2).is_finite() );
+  }
+
+
+
+TEST_CASE("batch_linalg_solve")
+  {
+  const uword sizes[] = { 1, 6, 10, 11, 40 };
+  
+  for(const uword N : sizes)
+    {
+    const cube A(N, N, 9, fill::randu);
+    const cube B(N, 3, 9, fill::randu);
+  
+    const cube X = solve(A, B);
+  
+    REQUIRE( X.n_rows == N );
+    REQUIRE( X.n_cols == 3 );
+  
+    for(uword s=0; s < A.n_slices; ++s)
+      {
+      REQUIRE( approx_equal(X.slice(s), solve(A.slice(s), B.slice(s)), "reldiff", 1e-6) );
+      }
+    }
+  
+  const fcube F = batch_linalg_make_sympd<float>(9, 4);
+  const fcube G(9, 1, 4, fill::randu);
+  
+  const fcube FX = solve(F, G);
+  
+  for(uword s=0; s < F.n_slices; ++s)
+    {
+    REQUIRE( approx_equal(FX.slice(s), solve(F.slice(s), G.slice(s)), "reldiff", 1e-4) );
+    }
+  
+  const cx_cube A(5, 5, 4, fill::randu);
+  const cx_cube B(5, 2, 4, fill::randu);
+  
+  const cx_cube X = solve(A, B);
+  
+  for(uword s=0; s < A.n_slices; ++s)
+    {
+    REQUIRE( approx_equal(A.slice(s) * X.slice(s), B.slice(s), "absdiff", 1e-10) );
+    }
+  }
+
+
+
+TEST_CASE("batch_linalg_solve_fail_and_alias")
+  {
+  cube A(6, 6, 4, fill::randu);
+  cube B(6, 2, 4, fill::randu);
+  
+  const cube B_orig = B;
+  
+  A.slice(3).zeros();
+  
+  REQUIRE( solve(B, A, B) == false );
+  
+  REQUIRE( B.slice(3).has_nan() );
+  
+  for(uword s=0; s < 3; ++s)
+    {
+    REQUIRE( approx_equal(A.slice(s) * B.slice(s), B_orig.slice(s), "absdiff", 1e-10) );
+    }
+  }
+
+
+
+TEST_CASE("batch_linalg_solve_singular")
+  {
+  // singular, but the pivots of the LU decomposition aren't exactly zero
+  
+  const mat S = { { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }, { 7.0, 8.0, 9.0 } };
+  
+  const uword sizes[] = { 3, 40 };  // unblocked kernel and LAPACK
+  
+  for(const uword N : sizes)
+    {
+    cube A(N, N, 5, fill::randu);
+    
+    for(uword s=0; s < A.n_slices; ++s)  { A.slice(s).diag() += double(N); }
+    
+    A.slice(2).eye();
+    A.slice(2).submat(0, 0, 2, 2) = S;
+    
+    const cube B(N, 2, 5, fill::randu);
+    
+    cube X;
+    
+    REQUIRE( solve(X, A, B) == false );
+    
+    REQUIRE( X.slice(2).has_nan() );
+    
+    for(uword s=0; s < A.n_slices; ++s)
+      {
+      if(s == 2)  { continue; }
+      
+      REQUIRE( approx_equal(A.slice(s) * X.slice(s), B.slice(s), "absdiff", 1e-10) );
+      }
+    }
+  }
+
+
+
+TEST_CASE("batch_linalg_eig_sym")
+  {
+  const uword sizes[] = { 1, 4, 6, 7, 40 };
+  
+  for(const uword N : sizes)
+    {
+    const cube X = batch_linalg_make_sympd<double>(N, 7);
+  
+    mat  eigval;
+    cube eigvec;
+  
+    REQUIRE( eig_sym(eigval, eigvec, X) );
+  
+    const mat eigval2 = eig_sym(X);
+  
+    REQUIRE( eigval.n_rows == N );
+    REQUIRE( eigval.n_cols == X.n_slices );
+  
+    for(uword s=0; s < X.n_slices; ++s)
+      {
+      const vec expected = eig_sym(X.slice(s));
+  
+      REQUIRE( approx_equal(eigval.col(s),  expected, "reldiff", 1e-10) );
+      REQUIRE( approx_equal(eigval2.col(s), expected, "reldiff", 1e-10) );
+  
+      const mat& V = eigvec.slice(s);
+  
+      REQUIRE( approx_equal(X.slice(s) * V, V * diagmat(eigval.col(s)), "absdiff", 1e-9 * N) );
+      REQUIRE( approx_equal(V.t() * V, eye<mat>(N, N), "absdiff", 1e-10) );
+      }
+    }
+  
+  const cx_cube Y = batch_linalg_make_sympd<cx_double>(5, 3);
+  
+  mat     eigval;
+  cx_cube eigvec;
+  
+  REQUIRE( eig_sym(eigval, eigvec, Y) );
+  
+  for(uword s=0; s < Y.n_slices; ++s)
+    {
+    REQUIRE( approx_equal(eigval.col(s), eig_sym(Y.slice(s)), "reldiff", 1e-10) );
+  
+    const cx_mat& V = eigvec.slice(s);
+  
+    REQUIRE( approx_equal(Y.slice(s) * V, V * diagmat(conv_to<cx_vec>::from(eigval.col(s))), "absdiff", 1e-9) );
+    }
+  
+  const fcube F = batch_linalg_make_sympd<float>(5, 3);
+  
+  const fmat F_eigval = eig_sym(F);
+  
+  for(uword s=0; s < F.n_slices; ++s)
+    {
+    REQUIRE( approx_equal(F_eigval.col(s), eig_sym(F.slice(s)), "reldiff", 1e-4) );
+    }
+  
+  // diagonal input and a non-finite slice
+  cube Z(3, 3, 2, fill::zeros);
+  
+  Z.slice(0).diag() = vec({ 3.0, 1.0, 2.0 });
+  Z.slice(1)(0,1)   = datum::nan;
+  
+  mat Z_eigval;
+  
+  REQUIRE( eig_sym(Z_eigval, Z) == false );
+  REQUIRE( approx_equal(Z_eigval.col(0), vec({ 1.0, 2.0, 3.0 }), "absdiff", 1e-15) );
+  REQUIRE( Z_eigval.col(1).has_nan() );
+  }
@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2008-2023 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2023 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("decomp_cholupdate_1")
+  {
+  arma_rng::set_seed(123);
+  
+  const uword N = 20;
+  
+  mat B = randn<mat>(N,N);
+  mat A = B.t()*B + N*eye<mat>(N,N);
+  mat V = randn<mat>(N,3);
+  
+  // rank-3 update
+  
+  mat R1 = chol(A);
+  mat L1 = chol(A, "lower");
+  
+  REQUIRE( cholupdate(R1, V)          == true );
+  REQUIRE( cholupdate(L1, V, "lower") == true );
+  
+  mat R2 = chol(A + V*V.t());
+  
+  REQUIRE( norm(R1 - R2, "inf")     <= 1e-10 * norm(R2, "inf") );
+  REQUIRE( norm(L1 - R2.t(), "inf") <= 1e-10 * norm(R2, "inf") );
+  
+  // downdate back to the original factor
+  
+  REQUIRE( choldowndate(R1, V)          == true );
+  REQUIRE( choldowndate(L1, V, "lower") == true );
+  
+  mat R3 = chol(A);
+  
+  REQUIRE( norm(R1 - R3, "inf")     <= 1e-10 * norm(R3, "inf") );
+  REQUIRE( norm(L1 - R3.t(), "inf") <= 1e-10 * norm(R3, "inf") );
+  
+  // downdate to an indefinite matrix must fail and leave the factor unchanged
+  
+  mat R4 = R3;
+  
+  vec w = 10.0 * std::sqrt(norm(A,2)) * normalise(randn<vec>(N));
+  
+  REQUIRE( choldowndate(R4, w) == false );
+  
+  REQUIRE( norm(R4 - R3, "inf") == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("decomp_cholupdate_2")
+  {
+  arma_rng::set_seed(123);
+  
+  const uword N = 20;
+  
+  cx_mat B = randn<cx_mat>(N,N);
+  cx_mat A = B.t()*B + N*eye<cx_mat>(N,N);
+  cx_mat V = randn<cx_mat>(N,2);
+  
+  cx_mat R1 = chol(A);
+  cx_mat L1 = chol(A, "lower");
+  
+  REQUIRE( cholupdate(R1, V)          == true );
+  REQUIRE( cholupdate(L1, V, "lower") == true );
+  
+  cx_mat R2 = chol(A + V*V.t());
+  
+  REQUIRE( norm(R1 - R2, "inf")     <= 1e-10 * norm(R2, "inf") );
+  REQUIRE( norm(L1 - R2.t(), "inf") <= 1e-10 * norm(R2, "inf") );
+  
+  REQUIRE( choldowndate(R1, V)          == true );
+  REQUIRE( choldowndate(L1, V, "lower") == true );
+  
+  cx_mat R3 = chol(A);
+  
+  REQUIRE( norm(R1 - R3, "inf")     <= 1e-10 * norm(R3, "inf") );
+  REQUIRE( norm(L1 - R3.t(), "inf") <= 1e-10 * norm(R3, "inf") );
+  }
+
+
+
+template<typename eT>
+void
+check_qr(const Mat<eT>& Q, const Mat<eT>& R, const Mat<eT>& A, const bool econ)
+  {
+  Mat<eT> Q_ref;
+  Mat<eT> R_ref;
+  
+  if(econ)  { qr_econ(Q_ref, R_ref, A); }  else  { qr(Q_ref, R_ref, A); }
+  
+  REQUIRE( Q.n_rows == Q_ref.n_rows );
+  REQUIRE( Q.n_cols == Q_ref.n_cols );
+  REQUIRE( R.n_rows == R_ref.n_rows );
+  REQUIRE( R.n_cols == R_ref.n_cols );
+  
+  const double A_norm = norm(A, "inf");
+  
+  REQUIRE( norm(Q*R - A, "inf") <= 1e-12 * A_norm );
+  
+  REQUIRE( norm(Q.t()*Q - eye< Mat<eT> >(Q.n_cols, Q.n_cols), "inf") <= 1e-12 );
+  
+  double lower_max = 0.0;
+  
+  for(uword col=0; col < R.n_cols; ++col)
+  for(uword row=col+1; row < R.n_rows; ++row)
+    {
+    lower_max = (std::max)(lower_max, double(std::abs(R(row,col))));
+    }
+  
+  REQUIRE( lower_max == Approx(0.0) );
+  
+  // R is unique up to the phase of each row
+  
+  REQUIRE( norm(abs(R) - abs(R_ref), "inf") <= 1e-10 * A_norm );
+  }
+
+
+
+TEST_CASE("decomp_qrinsert_qrdelete_1")
+  {
+  arma_rng::set_seed(123);
+  
+  const uword m = 12;
+  const uword n = 7;
+  
+  mat A = randn<mat>(m,n);
+  vec c = randn<vec>(m);
+  rowvec r = randn<rowvec>(n);
+  
+  for(uword econ=0; econ <= 1; ++econ)
+    {
+    mat Q;
+    mat R;
+    
+    mat B = A;
+    
+    if(econ)  { qr_econ(Q, R, B); }  else  { qr(Q, R, B); }
+    
+    REQUIRE( qrinsert(Q, R, 3, c) == true );  B.insert_cols(3, c);
+    check_qr(Q, R, B, bool(econ));
+    
+    REQUIRE( qrinsert(Q, R, B.n_cols, c+1.0) == true );  B.insert_cols(B.n_cols, c+1.0);
+    check_qr(Q, R, B, bool(econ));
+    
+    qrdelete(Q, R, 0);  B.shed_col(0);
+    check_qr(Q, R, B, bool(econ));
+    
+    qrdelete(Q, R, 4);  B.shed_col(4);
+    check_qr(Q, R, B, bool(econ));
+    
+    REQUIRE( qrinsert(Q, R, 5, r, "row") == true );  B.insert_rows(5, r);
+    check_qr(Q, R, B, bool(econ));
+    
+    REQUIRE( qrinsert(Q, R, 0, r-1.0, "row") == true );  B.insert_rows(0, r-1.0);
+    check_qr(Q, R, B, bool(econ));
+    
+    qrdelete(Q, R, 2, "row");  B.shed_row(2);
+    check_qr(Q, R, B, bool(econ));
+    
+    qrdelete(Q, R, B.n_rows-1, "row");  B.shed_row(B.n_rows-1);
+    check_qr(Q, R, B, bool(econ));
+    }
+  }
+
+
+
+TEST_CASE("decomp_qrinsert_qrdelete_2")
+  {
+  arma_rng::set_seed(123);
+  
+  const uword m = 9;
+  const uword n = 5;
+  
+  cx_mat   A = randn<cx_mat>(m,n);
+  cx_vec   c = randn<cx_vec>(m);
+  cx_rowvec r = randn<cx_rowvec>(n);
+  
+  for(uword econ=0; econ <= 1; ++econ)
+    {
+    cx_mat Q;
+    cx_mat R;
+    
+    cx_mat B = A;
+    
+    if(econ)  { qr_econ(Q, R, B); }  else  { qr(Q, R, B); }
+    
+    REQUIRE( qrinsert(Q, R, 2, c) == true );  B.insert_cols(2, c);
+    check_qr(Q, R, B, bool(econ));
+    
+    qrdelete(Q, R, 1);  B.shed_col(1);
+    check_qr(Q, R, B, bool(econ));
+    
+    REQUIRE( qrinsert(Q, R, 4, r, "row") == true );  B.insert_rows(4, r);
+    check_qr(Q, R, B, bool(econ));
+    
+    qrdelete(Q, R, 0, "row");  B.shed_row(0);
+    check_qr(Q, R, B, bool(econ));
+    }
+  }
+
+
+
+TEST_CASE("decomp_qrinsert_qrdelete_3")
+  {
+  // growing and shrinking a wide matrix one row at a time
+  
+  arma_rng::set_seed(123);
+  
+  mat A = randn<mat>(3,6);
+  
+  mat Q;
+  mat R;
+  
+  qr(Q, R, A);
+  
+  for(uword i=0; i < 5; ++i)
+    {
+    rowvec r = randn<rowvec>(6);
+    
+    REQUIRE( qrinsert(Q, R, A.n_rows, r, "row") == true );  A.insert_rows(A.n_rows, r);
+    check_qr(Q, R, A, false);
+    }
+  
+  for(uword i=0; i < 5; ++i)
+    {
+    qrdelete(Q, R, 1, "row");  A.shed_row(1);
+    check_qr(Q, R, A, false);
+    }
+  }
@@ -132,3 +132,31 @@ TEST_CASE("fn_accu_spmat")
   REQUIRE( accu(b) == 52 );
   REQUIRE( accu(b.submat(1, 1, 3, 3)) == 41 );
   }
+
+
+
+TEST_CASE("fn_accu_5")
+  {
+  // large enough to use the parallelised and blocked code paths
+  
+  vec a = randu<vec>(100000);
+  
+  double acc = 0.0;
+  
+  for(uword i=0; i < a.n_elem; ++i)  { acc += a(i); }
+  
+  REQUIRE( accu(a)         == Approx(acc)       );
+  REQUIRE( accu(2.0*a)     == Approx(2.0*acc)   );
+  REQUIRE( mean(a)         == Approx(acc / double(a.n_elem)) );
+  REQUIRE( dot(a, a)       == Approx(accu(square(a))) );
+  
+  mat A = reshape(a, 1000, 100);
+  
+  REQUIRE( accu(abs( sum(A,0).t() - sum(A.t(),1) )) == Approx(0.0).margin(1e-8) );
+  REQUIRE( accu(sum(A,1)) == Approx(acc) );
+  
+  fvec b(100000);
+  b.fill(0.5f);
+  
+  REQUIRE( accu(b) == Approx(50000.0f) );
+  }
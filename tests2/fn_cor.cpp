@@ -75,3 +75,31 @@ TEST_CASE("fn_cor_2")
   REQUIRE( accu(abs(cor(A,B) - AA)) == Approx(0.0).margin(0.0001) );
   REQUIRE( accu(abs(cor(A,C) - AC)) == Approx(0.0).margin(0.0001) );
   }
+
+
+
+TEST_CASE("fn_cor_3")
+  {
+  // tall data, spanning several blocks of observations
+  
+  mat A = randn<mat>(5000, 6);  A.each_row() += linspace<rowvec>(1e3, 6e3, 6);
+  mat B = randn<mat>(5000, 2);  B.col(1) -= 0.5 * A.col(4);
+  
+  const mat A_c = A.each_row() - mean(A);
+  const mat B_c = B.each_row() - mean(B);
+  
+  const mat AA = (A_c.t() * A_c) / (stddev(A).t() * stddev(A)) / double(A.n_rows - 1);
+  const mat AB = (A_c.t() * B_c) / (stddev(A).t() * stddev(B)) / double(A.n_rows - 1);
+  
+  const mat At = A.t();
+  
+  REQUIRE( approx_equal(cor(A),      AA, "reldiff", 1e-8) );
+  REQUIRE( approx_equal(cor(At.t()), AA, "reldiff", 1e-8) );
+  REQUIRE( approx_equal(cor(A,B),    AB, "reldiff", 1e-8) );
+  
+  mat C = A;
+  
+  C = cor(C,B);
+  
+  REQUIRE( approx_equal(C, AB, "reldiff", 1e-8) );
+  }
@@ -75,3 +75,36 @@ TEST_CASE("fn_cov_2")
   REQUIRE( accu(abs(cov(A,B) - AB)) == Approx(0.0).margin(0.001) );
   REQUIRE( accu(abs(cov(A,C) - AC)) == Approx(0.0).margin(0.001) );
   }
+
+
+
+TEST_CASE("fn_cov_3")
+  {
+  // tall data, spanning several blocks of observations
+  
+  mat A = randn<mat>(5000, 7);  A.each_row() += linspace<rowvec>(1e3, 7e3, 7);
+  mat B = randn<mat>(5000, 3);  B.col(0) += 0.5 * A.col(2);
+  
+  const mat A_c = A.each_row() - mean(A);
+  const mat B_c = B.each_row() - mean(B);
+  
+  const mat AA = (A_c.t() * A_c) / double(A.n_rows - 1);
+  const mat AB = (A_c.t() * B_c) / double(A.n_rows);
+  
+  const mat At = A.t();
+  
+  REQUIRE( approx_equal(cov(A),      AA, "reldiff", 1e-8) );
+  REQUIRE( approx_equal(cov(At.t()), AA, "reldiff", 1e-8) );
+  REQUIRE( approx_equal(cov(A,A),    AA, "reldiff", 1e-8) );
+  REQUIRE( approx_equal(cov(A,B,1),  AB, "reldiff", 1e-8) );
+  
+  cx_mat X = randn<cx_mat>(3000, 4);
+  
+  const cx_mat X_c = X.each_row() - mean(X);
+  const cx_mat XX  = (X_c.t() * X_c) / double(X.n_rows - 1);
+  
+  const cx_mat Xt = X.t();
+  
+  REQUIRE( approx_equal(cov(X),      XX, "reldiff", 1e-8) );
+  REQUIRE( approx_equal(cov(Xt.t()), XX, "reldiff", 1e-8) );
+  }
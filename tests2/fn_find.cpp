@@ -61,3 +61,87 @@ TEST_CASE("fn_find_1")
   
   // REQUIRE_THROWS(  );
   }
+
+
+
+TEST_CASE("fn_find_2")
+  {
+  // large enough to exercise the multi-threaded code paths when OpenMP is enabled
+  
+  const uword N = 100000;
+  
+  vec A(N);
+  vec B(N);
+  
+  for(uword i=0; i < N; ++i)
+    {
+    A(i) = (i % 7 == 0) ? 0.0 : std::sin(double(i));
+    B(i) = std::cos(double(i));
+    }
+  
+  A(17)  = datum::nan;
+  A(N-1) = datum::inf;
+  
+  std::vector<uword> ref_nonzero;
+  std::vector<uword> ref_gt;
+  std::vector<uword> ref_lteq;
+  std::vector<uword> ref_finite;
+  
+  std::vector<double> ref_vals;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    if(A(i) != 0.0)           { ref_nonzero.push_back(i); ref_vals.push_back(A(i)); }
+    if(A(i) >  0.5)           { ref_gt.push_back(i);      }
+    if(A(i) <= B(i))          { ref_lteq.push_back(i);    }
+    if(std::isfinite(A(i)))   { ref_finite.push_back(i);  }
+    }
+  
+  REQUIRE( all( uvec(find(A))        == uvec(ref_nonzero) ) );
+  REQUIRE( all( uvec(find(A > 0.5))  == uvec(ref_gt)      ) );
+  REQUIRE( all( uvec(find(A <= B))   == uvec(ref_lteq)    ) );
+  REQUIRE( all( uvec(find_finite(A)) == uvec(ref_finite)  ) );
+  
+  uvec n1 = find(A, 10);
+  uvec n2 = find(A, 10, "last");
+  
+  REQUIRE( n1.n_elem == 10 );
+  REQUIRE( n2.n_elem == 10 );
+  REQUIRE( n1(0) == ref_nonzero.front() );
+  REQUIRE( n2(9) == ref_nonzero.back()  );
+  
+  vec C = nonzeros(A);
+  vec D = A.elem(find(A));
+  
+  REQUIRE( C.n_elem == ref_vals.size() );
+  REQUIRE( D.n_elem == ref_vals.size() );
+  
+  bool same_C = true;
+  bool same_D = true;
+  
+  for(uword i=0; i < C.n_elem; ++i)
+    {
+    const double ref = ref_vals[i];
+    
+    if(std::isnan(ref))
+      {
+      same_C = same_C && std::isnan(C(i));
+      same_D = same_D && std::isnan(D(i));
+      }
+    else
+      {
+      same_C = same_C && (C(i) == ref);
+      same_D = same_D && (D(i) == ref);
+      }
+    }
+  
+  REQUIRE( same_C );
+  REQUIRE( same_D );
+  
+  uvec bad_indices = find(A > 0.5);
+  bad_indices(bad_indices.n_elem-1) = N;
+  
+  vec E;
+  
+  REQUIRE_THROWS( E = A.elem(bad_indices) );
+  }
@@ -98,3 +98,80 @@ TEST_CASE("fn_find_unique_2")
   
   // REQUIRE_THROWS(  );
   }
+
+
+
+TEST_CASE("fn_find_unique_3")
+  {
+  // large integer input with few unique values
+  
+  const uword N = 20000;
+  
+  uvec A(N);
+  
+  for(uword i=0; i < N; ++i)  { A(i) = (i * 7919) % 97; }
+  
+  uvec indices_a = find_unique(A);
+  uvec indices_b = find_unique(A, false);
+  
+  REQUIRE( indices_a.n_elem == 97 );
+  REQUIRE( indices_b.n_elem == 97 );
+  
+  // first occurrence of each value
+  REQUIRE( all(indices_a == regspace<uvec>(0, 96)) );
+  
+  REQUIRE( indices_b.is_sorted() == false );
+  REQUIRE( all( A.elem(indices_b) == regspace<uvec>(0, 96) ) );
+  }
+
+
+
+template<typename eT>
+static
+void
+fn_find_unique_check_first_occurrence(const uword N, const uword n_distinct)
+  {
+  Col<eT> A(N);
+  
+  for(uword i=0; i < N; ++i)  { A(i) = eT( (i * 7919) % n_distinct ); }
+  
+  // reference: index of the first occurrence of each value, ordered by value
+  
+  uvec ref(n_distinct);
+  
+  ref.fill(N);
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const uword val = uword(A(i));
+    
+    if(ref(val) == N)  { ref(val) = i; }
+    }
+  
+  const uvec indices_a = find_unique(A);
+  const uvec indices_b = find_unique(A, false);
+  
+  REQUIRE( indices_a.n_elem == n_distinct );
+  REQUIRE( indices_b.n_elem == n_distinct );
+  
+  REQUIRE( all(indices_a == sort(ref)) );
+  REQUIRE( all(indices_b == ref      ) );
+  }
+
+
+
+TEST_CASE("fn_find_unique_4")
+  {
+  // indices must be the first occurrences irrespective of the processing path:
+  // hashing is used for integer inputs with at least 4096 elements and few unique values
+  
+  fn_find_unique_check_first_occurrence<sword >(4095,  97);
+  fn_find_unique_check_first_occurrence<sword >(4096,  97);
+  fn_find_unique_check_first_occurrence<sword >(4097,  97);
+  fn_find_unique_check_first_occurrence<sword >(4097, 600);  // too many unique values for hashing
+  
+  fn_find_unique_check_first_occurrence<double>(4095,  97);
+  fn_find_unique_check_first_occurrence<double>(4096,  97);
+  fn_find_unique_check_first_occurrence<double>(4097,  97);
+  fn_find_unique_check_first_occurrence<double>(4097, 600);
+  }
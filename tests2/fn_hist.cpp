@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_hist_1")
+  {
+  vec x = { -datum::inf, -2.0, 0.24, 0.25, 0.26, 0.5, 0.9, 1.0, 7.0, datum::inf, datum::nan };
+  
+  vec c = linspace<vec>(0, 1, 3);  // centers: 0, 0.5, 1
+  
+  uvec h = hist(x, c);
+  
+  // ties are assigned to the lower bin
+  uvec h_gt = { 4, 2, 4 };
+  
+  REQUIRE( h.n_elem == 3 );
+  REQUIRE( accu(h != h_gt) == 0 );
+  
+  // non-uniform centers covering the same range must produce the same result
+  
+  vec c2 = { 0.0, 0.5, 1.0, 100.0 };
+  
+  uvec h2 = hist(x, c2);
+  uvec h2_gt = { 4, 2, 3, 1 };
+  
+  REQUIRE( accu(h2 != h2_gt) == 0 );
+  }
+
+
+
+TEST_CASE("fn_hist_2")
+  {
+  mat X = randn<mat>(1000, 3);
+  vec c = linspace<vec>(-2, 2, 9);
+  
+  umat H0 = hist(X,     c, 0);
+  umat H1 = hist(X.t(), c, 1);
+  
+  REQUIRE( H0.n_rows == 9 );
+  REQUIRE( H0.n_cols == 3 );
+  
+  REQUIRE( accu(H0 != H1.t()) == 0 );
+  
+  REQUIRE( accu(sum(H0)) == X.n_elem );
+  
+  // compare against brute-force search for the nearest center
+  
+  uvec h_gt(9, fill::zeros);
+  
+  for(uword i=0; i < X.n_rows; ++i)  { h_gt( index_min(abs(c - X(i,0))) )++; }
+  
+  REQUIRE( accu(H0.col(0) != h_gt) == 0 );
+  }
+
+
+
+TEST_CASE("fn_histc_1")
+  {
+  vec x = { -1.0, 0.0, 0.1, 0.5, 0.99, 1.0, 1.5, 2.0, 2.5, datum::nan };
+  
+  vec e = { 0.0, 1.0, 2.0 };
+  
+  uvec h    = histc(x, e);
+  uvec h_gt = { 4, 2, 1 };
+  
+  REQUIRE( h.n_elem == 3 );
+  REQUIRE( accu(h != h_gt) == 0 );
+  
+  vec e2 = { 0.0, 1.0, 2.0, 10.0 };
+  
+  uvec h2    = histc(x, e2);
+  uvec h2_gt = { 4, 2, 2, 0 };
+  
+  REQUIRE( accu(h2 != h2_gt) == 0 );
+  }
+
+
+
+TEST_CASE("fn_hist_weighted_1")
+  {
+  rowvec x = { 0.1, 0.2, 0.6, 0.9, 2.0 };
+  rowvec w = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+  
+  rowvec c = { 0.0, 1.0 };
+  
+  rowvec h    = hist_weighted(x, c, w);
+  rowvec h_gt = { 3.0, 12.0 };
+  
+  REQUIRE( h.n_rows == 1 );
+  REQUIRE( h.n_cols == 2 );
+  
+  REQUIRE( accu(abs(h - h_gt)) == Approx(0.0).margin(1e-10) );
+  
+  REQUIRE_THROWS( hist_weighted(x, c, w.head(3)) );
+  }
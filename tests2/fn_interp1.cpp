@@ -53,3 +53,42 @@ TEST_CASE("fn_interp1_1")
   
   // REQUIRE_THROWS(  );
   }
+
+
+
+TEST_CASE("fn_interp1_2")
+  {
+  // uniformly spaced X, with unsorted XI
+  
+  vec x = linspace<vec>(0, 10, 11);
+  vec y = square(x);
+  
+  vec xi = { 3.5, 0.25, 9.75, -1.0, 11.0, 5.0 };
+  
+  vec yi_a;
+  vec yi_b;
+  
+  interp1(x, y, xi, yi_a, "linear",  -1.0);
+  interp1(x, y, xi, yi_b, "nearest", -1.0);
+  
+  vec yi_a_gt = { 12.5, 0.25, 95.25, -1.0, -1.0, 25.0 };
+  vec yi_b_gt = {  9.0, 0.0, 100.0, -1.0, -1.0, 25.0 };
+  
+  REQUIRE( accu(abs( yi_a - yi_a_gt )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( yi_b - yi_b_gt )) == Approx(0.0).margin(1e-10) );
+  
+  // uniformly spaced X must give the same result as non-uniformly spaced X within the same intervals
+  
+  vec x2 = join_cols(x, vec({ 11.5 }));
+  vec y2 = join_cols(y, vec({ 1.0  }));
+  
+  vec xi2 = linspace<vec>(0, 9.5, 39);
+  
+  vec yi_c;
+  vec yi_d;
+  
+  interp1(x,  y,  xi2, yi_c);
+  interp1(x2, y2, xi2, yi_d);
+  
+  REQUIRE( accu(abs( yi_c - yi_d )) == Approx(0.0).margin(1e-10) );
+  }
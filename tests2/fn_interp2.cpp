@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_interp2_1")
+  {
+  vec x = linspace<vec>(0, 4, 5);
+  vec y = linspace<vec>(0, 2, 3);
+  
+  // Z(i,j) = 2*y(i) + x(j), which is reproduced exactly by bilinear interpolation
+  
+  mat Z(y.n_elem, x.n_elem);
+  
+  for(uword j=0; j < x.n_elem; ++j)
+  for(uword i=0; i < y.n_elem; ++i)
+    {
+    Z(i,j) = 2.0*y(i) + x(j);
+    }
+  
+  vec xi = { 0.5, 1.25, 3.0, 5.0 };
+  vec yi = { 0.25, 1.5 };
+  
+  mat zi_a;
+  mat zi_b;
+  
+  interp2(x, y, Z, xi, yi, zi_a, "linear",  -1.0);
+  interp2(x, y, Z, xi, yi, zi_b, "nearest", -1.0);
+  
+  mat zi_a_gt = { { 1.0, 1.75, 3.5, -1.0 }, { 3.5, 4.25, 6.0, -1.0 } };
+  mat zi_b_gt = { { 0.0, 1.0,  3.0, -1.0 }, { 2.0, 3.0,  5.0, -1.0 } };
+  
+  REQUIRE( zi_a.n_rows == 2 );
+  REQUIRE( zi_a.n_cols == 4 );
+  
+  REQUIRE( accu(abs( zi_a - zi_a_gt )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( zi_b - zi_b_gt )) == Approx(0.0).margin(1e-10) );
+  }
+
+
+
+TEST_CASE("fn_interp2_uniform_large")
+  {
+  // uniformly spaced grids large enough to take the parallel path when OpenMP is enabled
+  
+  vec x = linspace<vec>(0, 10, 201);
+  vec y = linspace<vec>(0,  5, 151);
+  
+  mat Z(y.n_elem, x.n_elem);
+  
+  for(uword j=0; j < x.n_elem; ++j)
+  for(uword i=0; i < y.n_elem; ++i)
+    {
+    Z(i,j) = 2.0*y(i) - 3.0*x(j) + 1.0;
+    }
+  
+  vec xi = linspace<vec>(-0.5, 10.5, 317);
+  vec yi = linspace<vec>(-0.5,  5.5, 263);
+  
+  yi(7) = datum::nan;
+  
+  mat zi;
+  
+  interp2(x, y, Z, xi, yi, zi, "linear", -1.0);
+  
+  REQUIRE( zi.n_rows == yi.n_elem );
+  REQUIRE( zi.n_cols == xi.n_elem );
+  
+  bool ok = true;
+  
+  for(uword j=0; j < xi.n_elem; ++j)
+  for(uword i=0; i < yi.n_elem; ++i)
+    {
+    const double xv = xi(j);
+    const double yv = yi(i);
+    
+    if( (xv < 0.0) || (xv > 10.0) )
+      {
+      ok = ok && (zi(i,j) == -1.0);
+      }
+    else
+    if(i == 7)
+      {
+      ok = ok && std::isnan(zi(i,j));
+      }
+    else
+    if( (yv < 0.0) || (yv > 5.0) )
+      {
+      ok = ok && (zi(i,j) == -1.0);
+      }
+    else
+      {
+      ok = ok && (std::abs(zi(i,j) - (2.0*yv - 3.0*xv + 1.0)) < 1e-10);
+      }
+    }
+  
+  REQUIRE( ok );
+  }
@@ -165,3 +165,64 @@ TEST_CASE("fn_princomp_6")
   REQUIRE(std::abs(coeff(19,19)) == Approx(9.5528446175e-01).margin(0.01));
   }
 
+
+TEST_CASE("running_princomp_1")
+  {
+  mat m(1000, 20);
+  initMatrix(m);
+  
+  running_princomp<double> rp;
+  
+  for(uword i=0; i < 10; ++i)  { rp( m.rows(i*100, i*100 + 99) ); }
+  
+  REQUIRE(rp.count() == 1000);
+  
+  REQUIRE( norm(rp.mean() - mean(m), "inf") == Approx(0.0).margin(1e-10) );
+  
+  checkEigenvectors(rp.coeff());
+  checkEigenvalues(rp.latent());
+  
+  mat coeff;
+  mat score;
+  princomp(coeff, score, m);
+  
+  // sign of the eigenvectors can be flipped
+  REQUIRE( norm(abs(rp.score(m)) - abs(score), "inf") == Approx(0.0).margin(1e-8) );
+  }
+
+TEST_CASE("running_princomp_2")
+  {
+  // approximately low rank data; truncated updates should match the full decomposition
+  
+  arma_rng::set_seed(123);
+  
+  mat m = randn<mat>(2000, 4) * diagmat(vec{8.0, 4.0, 2.0, 1.0}) * randn<mat>(4, 50) + 0.01 * randn<mat>(2000, 50);
+  
+  mat coeff;
+  mat score;
+  vec latent;
+  princomp(coeff, score, latent, m);
+  
+  running_princomp<double> rp1(4);
+  running_princomp<double> rp2(4, "randomised");
+  
+  for(uword i=0; i < 10; ++i)
+    {
+    rp1( m.rows(i*200, i*200 + 199) );
+    rp2( m.rows(i*200, i*200 + 199) );
+    }
+  
+  REQUIRE( rp1.coeff().n_cols == 4 );
+  REQUIRE( rp2.coeff().n_cols == 4 );
+  
+  for(uword i=0; i < 4; ++i)
+    {
+    REQUIRE( rp1.latent()(i) == Approx(latent(i)).epsilon(1e-4) );
+    REQUIRE( rp2.latent()(i) == Approx(latent(i)).epsilon(1e-4) );
+    
+    REQUIRE( std::abs(dot(rp1.coeff().col(i), coeff.col(i))) == Approx(1.0).epsilon(1e-4) );
+    REQUIRE( std::abs(dot(rp2.coeff().col(i), coeff.col(i))) == Approx(1.0).epsilon(1e-4) );
+    }
+  
+  REQUIRE( norm(abs(rp1.score(m)) - abs(score.head_cols(4)), "inf") <= 1e-3 * norm(score, "inf") );
+  }
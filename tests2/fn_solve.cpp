@@ -145,3 +145,196 @@ TEST_CASE("fn_solve_3")
   REQUIRE( X1(4) == Approx(-1.602040603621000) );
   REQUIRE( X1(5) == Approx(-5.985543296434588) );
   }
+
+
+
+TEST_CASE("fn_solve_mixed")
+  {
+  arma_rng::set_seed(123);
+  
+  const uword N = 100;
+  
+  // general square system
+  
+  mat A = randu<mat>(N,N) + N*eye<mat>(N,N);
+  mat B = randu<mat>(N,3);
+  
+  mat X1;
+  mat X2;
+  
+  bool status1 = solve(X1, A, B);
+  bool status2 = solve(X2, A, B, solve_opts::mixed);
+  
+  REQUIRE( status1 == true );
+  REQUIRE( status2 == true );
+  
+  REQUIRE( norm(X1-X2,"inf") <= 1e-12 * norm(X1,"inf") );
+  
+  // symmetric positive definite system
+  
+  mat C = randu<mat>(N,N);
+  mat S = C.t()*C + N*eye<mat>(N,N);
+  
+  mat Y1;
+  mat Y2;
+  
+  bool status3 = solve(Y1, S, B);
+  bool status4 = solve(Y2, S, B, solve_opts::mixed + solve_opts::likely_sympd);
+  
+  REQUIRE( status3 == true );
+  REQUIRE( status4 == true );
+  
+  REQUIRE( norm(Y1-Y2,"inf") <= 1e-12 * norm(Y1,"inf") );
+  
+  // complex system
+  
+  cx_mat D = randu<cx_mat>(N,N) + N*eye<cx_mat>(N,N);
+  cx_mat E = randu<cx_mat>(N,2);
+  
+  cx_mat Z1;
+  cx_mat Z2;
+  
+  bool status5 = solve(Z1, D, E);
+  bool status6 = solve(Z2, D, E, solve_opts::mixed);
+  
+  REQUIRE( status5 == true );
+  REQUIRE( status6 == true );
+  
+  REQUIRE( norm(Z1-Z2,"inf") <= 1e-12 * norm(Z1,"inf") );
+  
+  // ill-conditioned system: single precision refinement can't converge, so the full precision fallback is used
+  
+  vec s = logspace<vec>(0, -12, N);
+  
+  mat U;
+  mat V;
+  
+  qr_econ(U, C, randn<mat>(N,N));
+  qr_econ(V, C, randn<mat>(N,N));
+  
+  mat H = U * diagmat(s) * V.t();
+  
+  mat W1;
+  mat W2;
+  
+  bool status7 = solve(W1, H, B);
+  bool status8 = solve(W2, H, B, solve_opts::mixed);
+  
+  REQUIRE( status7 == true );
+  REQUIRE( status8 == true );
+  
+  REQUIRE( norm(W1-W2,"inf") <= 1e-12 * norm(W1,"inf") );
+  
+  // expression as B, evaluated once for the mixed precision solver and the full precision fallback
+  
+  mat W3;
+  
+  bool status9 = solve(W3, H, 2.0*B, solve_opts::mixed);
+  
+  REQUIRE( status9 == true );
+  
+  REQUIRE( norm(2.0*W1-W3,"inf") <= 1e-12 * norm(W3,"inf") );
+  
+  mat X3;
+  
+  bool status10 = solve(X3, A, B.cols(0,1), solve_opts::mixed);
+  
+  REQUIRE( status10 == true );
+  
+  REQUIRE( norm(X1.cols(0,1)-X3,"inf") <= 1e-12 * norm(X3,"inf") );
+  
+  mat X5 = B;
+  
+  bool status11 = solve(X5, A, X5.cols(0,1), solve_opts::mixed);
+  
+  REQUIRE( status11 == true );
+  
+  REQUIRE( norm(X3-X5,"inf") <= 1e-12 * norm(X3,"inf") );
+  
+  // the mixed precision solver does its own refinement
+  
+  mat X4;
+  
+  REQUIRE_THROWS( solve(X4, A, B, solve_opts::mixed + solve_opts::refine) );
+  }
+
+
+
+TEST_CASE("solve_factoriser_test")
+  {
+  mat A(60, 60, fill::randu);
+  A.diag() += 60.0;
+  
+  mat S = A.t() * A;                       // symmetric positive definite
+  mat T = symmatl(A) - 80.0*eye(60,60);    // symmetric indefinite
+  mat R(80, 60, fill::randu);              // over-determined
+  
+  mat B(60, 3, fill::randu);
+  mat C(80, 3, fill::randu);
+  
+  const char* methods[]  = { "lu", "chol", "ldlt" };
+  const mat*  matrices[] = { &A,   &S,     &T     };
+  
+  for(uword i=0; i < 3; ++i)
+    {
+    const mat& M = *(matrices[i]);
+    
+    solve_factoriser SF;
+    
+    REQUIRE( SF.factorise(M, methods[i]) );
+    
+    REQUIRE( SF.rcond() == Approx( rcond(M) ).epsilon(0.5) );
+    
+    mat X1 = solve(M, B);
+    mat X2;
+    mat X3;
+    
+    REQUIRE( SF.solve(X2, B)          );
+    REQUIRE( SF.solve(X3, B.col(1))   );
+    
+    REQUIRE( approx_equal(X1,        X2, "absdiff", 1e-10) );
+    REQUIRE( approx_equal(X1.col(1), X3, "absdiff", 1e-10) );
+    }
+  
+  solve_factoriser QR;
+  
+  REQUIRE( QR.factorise(R, "qr") );
+  
+  mat Y1 = solve(R, C);
+  mat Y2;
+  
+  REQUIRE( QR.solve(Y2, C) );
+  
+  REQUIRE( Y2.n_rows == 60 );
+  REQUIRE( Y2.n_cols == 3  );
+  REQUIRE( approx_equal(Y1, Y2, "absdiff", 1e-10) );
+  
+  // aliasing, complex elements, failures
+  
+  cx_mat CA(40, 40, fill::randu);
+  CA.diag() += 40.0;
+  
+  cx_mat CH = CA.t() * CA;
+  cx_mat CB(40, 2, fill::randu);
+  
+  solve_factoriser CF;
+  
+  REQUIRE( CF.factorise(CH, "ldlt") );
+  
+  cx_mat CX = solve(CH, CB);
+  
+  REQUIRE( CF.solve(CB, CB) );
+  REQUIRE( approx_equal(CX, CB, "absdiff", 1e-10) );
+  
+  mat X4;
+  
+  REQUIRE( QR.solve(X4, B) == false );
+  REQUIRE( X4.n_elem == 0 );
+  
+  REQUIRE( CF.solve(X4, B) == false );
+  
+  solve_factoriser SF;
+  
+  REQUIRE( SF.factorise(T, "chol") == false );
+  REQUIRE( SF.solve(X4, B) == false );
+  }
@@ -491,6 +491,57 @@ TEST_CASE("fn_trans_4")
 
 
 
+TEST_CASE("fn_trans_5")
+  {
+  // large and non-square sizes, covering the blocked, multi-threaded and low-memory in-place algorithms
+
+  const uword sizes[][2] = { {700,600}, {600,700}, {513,517}, {512,1024}, {700,700}, {6,4}, {3,7}, {1,5} };
+
+  for(uword s=0; s < 8; ++s)
+    {
+    const uword n_rows = sizes[s][0];
+    const uword n_cols = sizes[s][1];
+
+    mat A(n_rows, n_cols);
+
+    for(uword col=0; col < n_cols; ++col)
+    for(uword row=0; row < n_rows; ++row)
+      {
+      A(row,col) = double(row) + double(col) * 10000.0;
+      }
+
+    mat At(n_cols, n_rows);
+
+    for(uword col=0; col < n_cols; ++col)
+    for(uword row=0; row < n_rows; ++row)
+      {
+      At(col,row) = A(row,col);
+      }
+
+    cx_mat C  = cx_mat(A, -2*A);
+    cx_mat Ct = cx_mat(At, 2*At);
+
+    mat    X;
+    cx_mat Y;
+
+    X = A.t();  REQUIRE( approx_equal(X, At, "absdiff", 0.0) );
+    Y = C.t();  REQUIRE( approx_equal(Y, Ct, "absdiff", 0.0) );
+
+    X = A;  X = X.t();  REQUIRE( approx_equal(X, At, "absdiff", 0.0) );
+    Y = C;  Y = Y.t();  REQUIRE( approx_equal(Y, Ct, "absdiff", 0.0) );
+
+    X = A;  inplace_trans(X);            REQUIRE( approx_equal(X, At, "absdiff", 0.0) );
+    X = A;  inplace_trans(X, "lowmem");  REQUIRE( approx_equal(X, At, "absdiff", 0.0) );
+
+    Y = C;  inplace_trans(Y);            REQUIRE( approx_equal(Y, Ct, "absdiff", 0.0) );
+    Y = C;  inplace_trans(Y, "lowmem");  REQUIRE( approx_equal(Y, Ct, "absdiff", 0.0) );
+
+    Y = C;  inplace_strans(Y, "lowmem");  REQUIRE( approx_equal(Y, conj(Ct), "absdiff", 0.0) );
+    }
+  }
+
+
+
 TEST_CASE("op_trans_sp_mat")
   {
   SpMat<unsigned int> a(4, 4);
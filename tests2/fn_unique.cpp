@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_unique_1")
+  {
+  vec A = { 5, 1, 3, 5, 1, 2 };
+  
+  rowvec B = { 5, 1, 3, 5, 1, 2 };
+  
+  vec    A_uniq = unique(A);
+  rowvec B_uniq = unique(B);
+  
+  vec A_uniq_gt = { 1, 2, 3, 5 };
+  
+  REQUIRE( A_uniq.n_elem == 4 );
+  REQUIRE( B_uniq.n_elem == 4 );
+  
+  REQUIRE( accu(abs(A_uniq - A_uniq_gt    )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(B_uniq - A_uniq_gt.t())) == Approx(0.0).margin(1e-10) );
+  
+  vec C = { 1.0, datum::nan };
+  vec D;
+  
+  REQUIRE_THROWS( D = unique(C) );
+  }
+
+
+
+TEST_CASE("fn_unique_2")
+  {
+  // large integer input, with few and many unique values
+  
+  imat A = randi<imat>(100, 100, distr_param(-50, 50));
+  
+  ivec A_uniq    = unique(A);
+  ivec A_uniq_gt = conv_to<ivec>::from( unique(conv_to<mat>::from(A)) );
+  
+  REQUIRE( A_uniq.is_sorted("strictascend") );
+  REQUIRE( all(A_uniq == A_uniq_gt) );
+  
+  urowvec B = regspace<urowvec>(9999, 0);
+  
+  urowvec B_uniq = unique( join_rows(B, B) );
+  
+  REQUIRE( B_uniq.n_elem == 10000 );
+  REQUIRE( all(B_uniq == regspace<urowvec>(0, 9999)) );
+  }
@@ -291,3 +291,21 @@ TEST_CASE("mat_mul_cx_1")
 
 
 
+
+
+
+TEST_CASE("mat_mul_cx_2")
+  {
+  // multiplication involving non-contiguous subviews, which are passed to BLAS without copying
+  
+  cx_mat X(40, 30, fill::randu);
+  
+  cx_mat A = X.submat(2, 1, 26, 20);   // 25x20
+  cx_mat B = X.submat(4, 3, 23, 12);   // 20x10
+  
+  REQUIRE( accu(abs( X.submat(2, 1, 26, 20) * X.submat(4, 3, 23, 12)    - A*B     )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( X.submat(2, 1, 26, 20).t() * X.submat(2, 1, 26, 20) - A.t()*A )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( X.submat(2, 1, 26, 20) * X.submat(2, 1, 26, 20).t() - A*A.t() )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( X.submat(4, 3, 23, 12).st() * A.st()               - B.st()*A.st() )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( B.t() * X.submat(2, 1, 26, 20).t()                 - B.t()*A.t()   )) == Approx(0.0).margin(1e-10) );
+  }
@@ -927,3 +927,46 @@ TEST_CASE("mat_mul_real_6")
 
 
 
+
+
+
+TEST_CASE("mat_mul_real_7")
+  {
+  // multiplication involving non-contiguous subviews, which are passed to BLAS without copying
+  
+  mat X(50, 40, fill::randu);
+  mat Y(60, 50, fill::randu);
+  
+  mat A  = X.submat(5, 3, 34, 22);   // 30x20
+  mat B  = Y.submat(7, 2, 26, 31);   // 20x30
+  mat AA = X.submat(5, 3, 24, 22);   // 20x20
+  
+  REQUIRE( accu(abs( X.submat(5, 3, 34, 22) * B                         - A*B         )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( A * Y.submat(7, 2, 26, 31)                         - A*B         )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( X.submat(5, 3, 34, 22) * Y.submat(7, 2, 26, 31)    - A*B         )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( X.submat(5, 3, 34, 22).t() * Y.submat(7, 2, 26, 31).t() - A.t()*B.t() )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( 2.0 * X.submat(5, 3, 34, 22).t() * A              - 2.0*A.t()*A )) == Approx(0.0).margin(1e-10) );
+  
+  REQUIRE( accu(abs( X.submat(5, 3, 34, 22).t() * X.submat(5, 3, 34, 22) - A.t()*A )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( X.submat(5, 3, 34, 22) * X.submat(5, 3, 34, 22).t() - A*A.t() )) == Approx(0.0).margin(1e-10) );
+  
+  vec v(20, fill::randu);
+  
+  REQUIRE( accu(abs( X.submat(5, 3, 34, 22) * v                     - A*v         )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( X.submat(5, 3, 34, 22) * Y.submat(7, 2, 26, 2) - A*B.col(0)  )) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs( AA * X.submat(5, 3, 5, 22).t()                 - AA*AA.row(0).t() )) == Approx(0.0).margin(1e-10) );
+  
+  // result aliased with the parent matrix
+  
+  mat Z = X;
+  
+  Z = Z.submat(5, 3, 34, 22) * B;
+  
+  REQUIRE( Z.n_rows == 30 );
+  REQUIRE( Z.n_cols == 30 );
+  REQUIRE( accu(abs( Z - A*B )) == Approx(0.0).margin(1e-10) );
+  
+  mat W;
+  
+  REQUIRE_THROWS( W = X.submat(5, 3, 34, 22) * A );
+  }
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("symmat_packed_basic")
+  {
+  const uword N = 30;
+  
+  mat R(N, N, fill::randu);
+  
+  const mat A = R.t()*R + N*eye<mat>(N,N);  // symmetric positive definite
+  
+  symmat_packed<double> P(A);
+  
+  REQUIRE( P.n_rows == N );
+  REQUIRE( approx_equal(P.as_dense(), symmatl(A), "absdiff", 0.0) );
+  
+  REQUIRE( P(3,7) == A(7,3) );
+  REQUIRE( P(7,3) == A(7,3) );
+  
+  // only the lower triangle is used
+  
+  symmat_packed<double> L(trimatl(A));
+  
+  REQUIRE( approx_equal(L.as_dense(), symmatl(A), "absdiff", 0.0) );
+  
+  L(9,2) = 1.0;
+  
+  REQUIRE( L.as_dense()(2,9) == 1.0 );
+  
+  L(2,9) = 3.0;  // writing to the upper triangle sets the lower triangle
+  
+  REQUIRE( L(9,2) == 3.0 );
+  
+  const mat X(N, 4, fill::randu);
+  
+  mat Y;
+  
+  P.mul(Y, X);
+  
+  REQUIRE( approx_equal(Y, A*X, "reldiff", 1e-12) );
+  
+  const mat B(N, 3, fill::randu);
+  
+  const mat Z = solve(P, B);
+  
+  REQUIRE( approx_equal(Z, solve(A, B), "reldiff", 1e-10) );
+  
+  // not positive definite
+  
+  symmat_packed<double> Q(-A);
+  
+  mat W;
+  
+  REQUIRE( solve(W, Q, B) == false );
+  }
+
+
+
+TEST_CASE("symmat_packed_cx")
+  {
+  const uword N = 20;
+  
+  cx_mat R(N, N, fill::randu);
+  
+  const cx_mat A = R.t()*R + N*eye<cx_mat>(N,N);  // hermitian positive definite
+  
+  symmat_packed<cx_double> P(A);
+  
+  REQUIRE( approx_equal(P.as_dense(), symmatl(A), "absdiff", 0.0) );
+  
+  P(2,5) = cx_double(1.0, 2.0);
+  
+  REQUIRE( cx_double(P(5,2)) == cx_double(1.0, -2.0) );
+  
+  P(5,2) = A(5,2);
+  
+  const cx_mat X(N, 2, fill::randu);
+  
+  cx_mat Y;
+  
+  P.mul(Y, X);
+  
+  REQUIRE( approx_equal(Y, A*X, "reldiff", 1e-12) );
+  
+  REQUIRE( approx_equal(solve(P, X), solve(A, X), "reldiff", 1e-10) );
+  }
+
+
+
+TEST_CASE("trimat_packed_basic")
+  {
+  const uword N = 40;
+  
+  mat A(N, N, fill::randu);
+  
+  A.diag() += 2.0;
+  
+  const mat U = trimatu(A);
+  const mat L = trimatl(A);
+  
+  trimat_packed<double> PU(A);
+  trimat_packed<double> PL(A, "lower");
+  
+  REQUIRE( PU.is_lower == false );
+  REQUIRE( PL.is_lower == true  );
+  
+  REQUIRE( approx_equal(PU.as_dense(), U, "absdiff", 0.0) );
+  REQUIRE( approx_equal(PL.as_dense(), L, "absdiff", 0.0) );
+  
+  REQUIRE( PU(5,2) == 0.0 );
+  REQUIRE( PL(5,2) == A(5,2) );
+  
+  REQUIRE_THROWS( PU(5,2) = 1.0 );
+  
+  PL(5,2) *= 2.0;
+  
+  REQUIRE( PL(5,2) == 2.0*A(5,2) );
+  
+  PL(5,2) = A(5,2);
+  
+  const mat X(N, 3, fill::randu);
+  
+  mat YU;
+  mat YL;
+  
+  PU.mul(YU, X);
+  PL.mul(YL, X);
+  
+  REQUIRE( approx_equal(YU, U*X, "reldiff", 1e-12) );
+  REQUIRE( approx_equal(YL, L*X, "reldiff", 1e-12) );
+  
+  REQUIRE( approx_equal(solve(PU, X), solve(trimatu(U), X), "reldiff", 1e-10) );
+  REQUIRE( approx_equal(solve(PL, X), solve(trimatl(L), X), "reldiff", 1e-10) );
+  
+  trimat_packed<double> Z(N, "lower");
+  
+  mat W;
+  
+  REQUIRE( solve(W, Z, X) == false );
+  
+  REQUIRE_THROWS( trimat_packed<double>(A, "sideways") );
+  }
+
+
+
+TEST_CASE("trimat_packed_solve_rcond")
+  {
+  const mat A =
+    {
+    { 1.0,   1.0, 0.0 },
+    { 0.0, 1e-20, 1.0 },
+    { 0.0,   0.0, 1.0 }
+    };
+  
+  const trimat_packed<double> P(A);
+  
+  const vec b = { 1.0, 1.0, 1.0 };
+  
+  vec x;
+  
+  // no exact zero on the diagonal, but rcond is below epsilon
+  
+  REQUIRE( solve(x, P, b) == false );
+  REQUIRE( x.n_elem == 0 );
+  
+  REQUIRE_THROWS( x = solve(P, b) );
+  
+  REQUIRE( solve(x, P, b, solve_opts::allow_ugly) );
+  REQUIRE( approx_equal(A*x, b, "reldiff", 1e-10) );
+  
+  REQUIRE( solve(x, P, b, solve_opts::fast) );
+  }
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("mul_ooc_1")
+  {
+  mat A = randu<mat>(123, 77);
+  mat B = randu<mat>( 77, 51);
+  
+  A.save("mul_ooc_A.bin", arma_binary);
+  B.save("mul_ooc_B.bin", arma_binary);
+  
+  // small memory limit, so that all three dimensions are split into several tiles
+  
+  REQUIRE( mul_ooc<mat>("mul_ooc_C.bin", "mul_ooc_A.bin", "mul_ooc_B.bin", 6*8*20*20) );
+  
+  mat C;
+  
+  REQUIRE( C.load("mul_ooc_C.bin", arma_binary) );
+  
+  REQUIRE( approx_equal(C, A*B, "reldiff", 1e-12) );
+  
+  // memory limit large enough to hold the operands in single tiles
+  
+  REQUIRE( mul_ooc<mat>("mul_ooc_C.bin", "mul_ooc_A.bin", "mul_ooc_B.bin") );
+  
+  REQUIRE( C.load("mul_ooc_C.bin", arma_binary) );
+  
+  REQUIRE( approx_equal(C, A*B, "reldiff", 1e-12) );
+  
+  std::remove("mul_ooc_A.bin");
+  std::remove("mul_ooc_B.bin");
+  std::remove("mul_ooc_C.bin");
+  }
+
+
+
+TEST_CASE("mul_ooc_2")
+  {
+  cx_fmat A = randu<cx_fmat>(40, 30);
+  cx_fmat B = randu<cx_fmat>(30, 35);
+  
+  A.save("mul_ooc_A.bin", arma_binary);
+  B.save("mul_ooc_B.bin", arma_binary);
+  
+  REQUIRE( mul_ooc<cx_fmat>("mul_ooc_C.bin", "mul_ooc_A.bin", "mul_ooc_B.bin", 6*8*16*16) );
+  
+  cx_fmat C;
+  
+  REQUIRE( C.load("mul_ooc_C.bin", arma_binary) );
+  
+  REQUIRE( approx_equal(C, A*B, "reldiff", 1e-4) );
+  
+  // incompatible element type and incompatible dimensions
+  
+  REQUIRE( mul_ooc<mat>("mul_ooc_C.bin", "mul_ooc_A.bin", "mul_ooc_B.bin") == false );
+  REQUIRE( mul_ooc<cx_fmat>("mul_ooc_C.bin", "mul_ooc_B.bin", "mul_ooc_B.bin") == false );
+  
+  std::remove("mul_ooc_A.bin");
+  std::remove("mul_ooc_B.bin");
+  std::remove("mul_ooc_C.bin");
+  }
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("rng_ctr_1")
+  {
+  // known answer tests for Philox4x32-10, from the Random123 distribution
+  
+  u32 out[4];
+  
+  arma_rng_ctr::philox(&(out[0]), u64(0), u64(0), u64(0));
+  
+  REQUIRE( out[0] == u32(0x6627e8d5u) );
+  REQUIRE( out[1] == u32(0xe169c58du) );
+  REQUIRE( out[2] == u32(0xbc57ac4cu) );
+  REQUIRE( out[3] == u32(0x9b00dbd8u) );
+  
+  arma_rng_ctr::philox(&(out[0]), ~u64(0), ~u64(0), ~u64(0));
+  
+  REQUIRE( out[0] == u32(0x408f276du) );
+  REQUIRE( out[1] == u32(0x41c83b0eu) );
+  REQUIRE( out[2] == u32(0xa20bc7c6u) );
+  REQUIRE( out[3] == u32(0x6d5451fdu) );
+  }
+
+
+
+TEST_CASE("rng_ctr_2")
+  {
+  // the values depend only on the seed and on the position in the stream
+  
+  const uword N = 100000;
+  
+  vec A(N);
+  vec B(N);
+  vec C(40);
+  
+  arma_rng_ctr::set_seed(123);
+  arma_rng_ctr::randn_fill(A.memptr(), N, 0.0, 1.0);
+  
+  arma_rng_ctr::set_seed(123);
+  arma_rng_ctr::randn_fill(B.memptr(),         60000, 0.0, 1.0);
+  arma_rng_ctr::randn_fill(B.memptr() + 60000, 40000, 0.0, 1.0);
+  
+  REQUIRE( all(A == B) );
+  
+  arma_rng_ctr::set_seed(123);
+  arma_rng_ctr::skip(30);
+  arma_rng_ctr::randn_fill(C.memptr(), 40, 0.0, 1.0);
+  
+  REQUIRE( all(C == A.subvec(60,99)) );
+  
+  arma_rng_ctr::set_seed(123);
+  arma_rng_ctr::set_stream(1);
+  arma_rng_ctr::randn_fill(B.memptr(), N, 0.0, 1.0);
+  
+  REQUIRE( any(A != B) );
+  
+  REQUIRE( mean(A) == Approx(0.0).margin(0.02) );
+  REQUIRE( stddev(A) == Approx(1.0).epsilon(0.02) );
+  }
+
+
+
+TEST_CASE("rng_ctr_3")
+  {
+  const uword N = 100000;
+  
+  vec  A(N);
+  ivec B(N);
+  
+  cx_vec C(N);
+  
+  arma_rng_ctr::set_seed(456);
+  
+  arma_rng_ctr::randu_fill(A.memptr(), N, 2.0, 4.0);
+  arma_rng_ctr::randi_fill(B.memptr(), N, -3, 5);
+  arma_rng_ctr::randn_fill(C.memptr(), N, 0.0, 1.0);
+  
+  REQUIRE( A.min() >= 2.0 );
+  REQUIRE( A.max() <  4.0 );
+  REQUIRE( mean(A) == Approx(3.0).margin(0.02) );
+  
+  REQUIRE( B.min() == -3 );
+  REQUIRE( B.max() ==  5 );
+  REQUIRE( mean(conv_to<vec>::from(B)) == Approx(1.0).margin(0.05) );
+  
+  REQUIRE( mean(real(C)) == Approx(0.0).margin(0.02) );
+  REQUIRE( mean(imag(C)) == Approx(0.0).margin(0.02) );
+  REQUIRE( stddev(real(C)) == Approx(1.0).epsilon(0.02) );
+  }
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("sp_compact_1")
+  {
+  sp_mat A = sprandu<sp_mat>(500, 300, 0.05);
+  
+  sp_compact<double> C(A);
+  
+  REQUIRE( C.n_rows    == A.n_rows    );
+  REQUIRE( C.n_cols    == A.n_cols    );
+  REQUIRE( C.n_nonzero == A.n_nonzero );
+  
+  REQUIRE( C.row_indices.n_elem == A.n_nonzero  );
+  REQUIRE( C.col_ptrs.n_elem    == A.n_cols + 1 );
+  
+  // conversion back to SpMat gives identical CSC arrays
+  
+  sp_mat B(C);
+  
+  REQUIRE( B.n_nonzero == A.n_nonzero );
+  
+  for(uword i=0; i < A.n_nonzero; ++i)
+    {
+    REQUIRE( B.values[i]      == A.values[i]      );
+    REQUIRE( B.row_indices[i] == A.row_indices[i] );
+    }
+  
+  for(uword i=0; i <= A.n_cols; ++i)
+    {
+    REQUIRE( B.col_ptrs[i] == A.col_ptrs[i] );
+    }
+  
+  // multiplication with dense matrices and vectors
+  
+  const mat D(A);
+  
+  const vec x = randu<vec>(300);
+  const vec z = randu<vec>(500);
+  const mat X = randu<mat>(300, 4);
+  
+  vec y1 = C * x;
+  vec y2 = C.t() * z;
+  mat Y3 = C * X;
+  
+  REQUIRE( approx_equal(y1, D * x,     "reldiff", 1e-12) );
+  REQUIRE( approx_equal(y2, D.t() * z, "reldiff", 1e-12) );
+  REQUIRE( approx_equal(Y3, D * X,     "reldiff", 1e-12) );
+  
+  // other operations via conversion
+  
+  sp_mat P = C * A.t();
+  sp_mat Q = A * A.t();
+  
+  REQUIRE( approx_equal(P, Q, "absdiff", 1e-10) );
+  
+  REQUIRE( accu(C) == Approx(accu(A)) );
+  }
+
+
+
+TEST_CASE("sp_compact_2")
+  {
+  // symmetric positive definite matrix
+  sp_mat A = sprandu<sp_mat>(200, 200, 0.02);
+  
+  A = A + A.t();
+  
+  A.diag() += 10.0;
+  
+  sp_compact<double> C(A);
+  
+  vec eigval_A = eigs_sym(A, 5);
+  vec eigval_C = eigs_sym(C, 5);
+  
+  REQUIRE( approx_equal(eigval_A, eigval_C, "reldiff", 1e-10) );
+  
+  #if defined(ARMA_USE_SUPERLU)
+    {
+    const vec b = randu<vec>(200);
+    
+    vec x_A = spsolve(A, b);
+    vec x_C = spsolve(C, b);
+    
+    REQUIRE( approx_equal(x_A, x_C, "reldiff", 1e-10) );
+    }
+  #endif
+  
+  sp_compact<double> E;
+  
+  REQUIRE( E.n_nonzero == 0 );
+  
+  E = C;
+  
+  REQUIRE( E.n_nonzero == C.n_nonzero );
+  
+  E = A * 2.0;
+  
+  REQUIRE( approx_equal(sp_mat(E), sp_mat(A * 2.0), "absdiff", 0.0) );
+  }
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("sp_pattern_1")
+  {
+  const uword n_rows = 120;
+  const uword n_cols =  90;
+  const uword N      = 4000;
+  
+  // repeated locations, in no particular order
+  Mat<uword> locations = join_cols( randi< Row<uword> >(N, distr_param(0, int(n_rows)-1)), randi< Row<uword> >(N, distr_param(0, int(n_cols)-1)) );
+  
+  sp_pattern P(locations, n_rows, n_cols);
+  
+  REQUIRE( P.n_rows      == n_rows );
+  REQUIRE( P.n_cols      == n_cols );
+  REQUIRE( P.n_locations == N      );
+  REQUIRE( P.n_nonzero   <  N      );
+  
+  sp_mat A;
+  
+  for(uword iter=0; iter < 3; ++iter)
+    {
+    vec values = randu<vec>(N) + 1.0;
+    
+    P.assemble(A, values);
+    
+    sp_mat B(true, locations, values, n_rows, n_cols);
+    
+    REQUIRE( A.n_nonzero == P.n_nonzero );
+    REQUIRE( B.n_nonzero == P.n_nonzero );
+    REQUIRE( P.has_pattern(A) );
+    
+    REQUIRE( approx_equal(A, B, "absdiff", 1e-12) );
+    }
+  
+  // changes made via element access are discarded
+  A(0,0) = 123.0;
+  A(1,1) = 456.0;
+  
+  vec values = randu<vec>(N) + 1.0;
+  
+  P.assemble(A, values);
+  
+  sp_mat B(true, locations, values, n_rows, n_cols);
+  
+  REQUIRE( A.n_nonzero == P.n_nonzero );
+  REQUIRE( approx_equal(A, B, "absdiff", 1e-12) );
+  }
+
+
+
+TEST_CASE("sp_pattern_2")
+  {
+  // distinct locations
+  umat locations = { { 1, 7, 9, 0 },
+                     { 2, 8, 9, 2 } };
+  
+  sp_pattern P(locations, 10, 10);
+  
+  REQUIRE( P.n_nonzero == 4 );
+  
+  sp_mat A = sprandu<sp_mat>(10, 10, 0.5);
+  
+  REQUIRE( P.has_pattern(A) == false );
+  
+  vec values = { 1.0, 2.0, 3.0, 4.0 };
+  
+  P.assemble(A, values);
+  
+  REQUIRE( A.n_nonzero == 4 );
+  
+  REQUIRE( double(A(1,2)) == Approx(1.0) );
+  REQUIRE( double(A(7,8)) == Approx(2.0) );
+  REQUIRE( double(A(9,9)) == Approx(3.0) );
+  REQUIRE( double(A(0,2)) == Approx(4.0) );
+  REQUIRE( accu(A) == Approx(10.0) );
+  
+  // zero values keep their slot
+  values(1) = 0.0;
+  
+  P.assemble(A, values);
+  
+  REQUIRE( A.n_nonzero == 4 );
+  REQUIRE( accu(A) == Approx(8.0) );
+  }
+
+
+
+TEST_CASE("sp_pattern_3")
+  {
+  sp_pattern P(Mat<uword>(2, 0), 5, 6);
+  
+  REQUIRE( P.n_nonzero == 0 );
+  
+  sp_mat A;
+  
+  P.assemble(A, vec());
+  
+  REQUIRE( A.n_rows    == 5 );
+  REQUIRE( A.n_cols    == 6 );
+  REQUIRE( A.n_nonzero == 0 );
+  }
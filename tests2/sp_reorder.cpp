@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+static
+uword
+sp_reorder_bandwidth(const sp_mat& A)
+  {
+  uword bw = 0;
+  
+  for(sp_mat::const_iterator it = A.begin(); it != A.end(); ++it)
+    {
+    const uword r = it.row();
+    const uword c = it.col();
+    
+    bw = (std::max)(bw, (r > c) ? (r - c) : (c - r));
+    }
+  
+  return bw;
+  }
+
+
+
+static
+bool
+sp_reorder_is_permutation(const uvec& p, const uword n)
+  {
+  if(p.n_elem != n)  { return false; }
+  
+  return all( sort(p) == regspace<uvec>(0, n-1) );
+  }
+
+
+
+static
+sp_mat
+sp_reorder_grid(const uword m)
+  {
+  // 5-point Laplacian on an m x m grid
+  
+  const uword n = m*m;
+  
+  sp_mat A(n,n);
+  
+  for(uword j=0; j < m; ++j)
+  for(uword i=0; i < m; ++i)
+    {
+    const uword k = i + j*m;
+    
+    A(k,k) = 4.0;
+    
+    if(i > 0)  { A(k, k-1) = -1.0; A(k-1, k) = -1.0; }
+    if(j > 0)  { A(k, k-m) = -1.0; A(k-m, k) = -1.0; }
+    }
+  
+  return A;
+  }
+
+
+
+TEST_CASE("sp_reorder_symperm")
+  {
+  sp_mat A = sprandu<sp_mat>(60, 60, 0.1);
+  
+  A += speye<sp_mat>(60, 60);
+  
+  const uvec p = randperm(60);
+  
+  const sp_mat B = symperm(A, p);
+  
+  const mat D(A);
+  
+  REQUIRE( B.n_rows    == 60          );
+  REQUIRE( B.n_cols    == 60          );
+  REQUIRE( B.n_nonzero == A.n_nonzero );
+  
+  REQUIRE( approx_equal(mat(B), mat(D(p,p)), "absdiff", 0.0) );
+  
+  // the columns of the result must be usable by operations that rely on sorted row indices
+  REQUIRE( approx_equal(mat(B.t()), mat(D(p,p).t()), "absdiff", 0.0) );
+  
+  const uvec q = sort_index(p);
+  
+  REQUIRE( approx_equal(mat(symperm(B, q)), D, "absdiff", 0.0) );
+  
+  // the identity permutation leaves the matrix unchanged
+  REQUIRE( approx_equal(mat(symperm(A, regspace<uvec>(0, 59))), D, "absdiff", 0.0) );
+  
+  // empty matrix
+  const sp_mat E = symperm(sp_mat(), uvec());
+  
+  REQUIRE( E.n_rows == 0 );
+  REQUIRE( E.n_cols == 0 );
+  
+  REQUIRE_THROWS( symperm(A, uvec(59, fill::zeros)) );
+  REQUIRE_THROWS( symperm(A, uvec(60, fill::zeros)) );
+  REQUIRE_THROWS( symperm(sp_mat(4,5), regspace<uvec>(0,3)) );
+  }
+
+
+
+TEST_CASE("sp_reorder_rcm")
+  {
+  // banded matrix with its rows and columns shuffled
+  
+  const uword n = 200;
+  
+  sp_mat A(n,n);
+  
+  for(uword i=0; i < n; ++i)
+  for(uword j=i; j < (std::min)(n, i+4); ++j)
+    {
+    A(i,j) = 1.0 + i + j;
+    A(j,i) = 1.0 + i + j;
+    }
+  
+  const uvec shuffle = randperm(n);
+  
+  const sp_mat S = symperm(A, shuffle);
+  
+  REQUIRE( sp_reorder_bandwidth(S) > 3 );
+  
+  const uvec p = symrcm(S);
+  
+  REQUIRE( sp_reorder_is_permutation(p, n) );
+  
+  REQUIRE( sp_reorder_bandwidth(symperm(S, p)) <= 6 );
+  
+  // grid graph: the bandwidth of the natural ordering is the grid width
+  
+  const sp_mat G = sp_reorder_grid(15);
+  
+  const sp_mat GS = symperm(G, randperm(G.n_rows));
+  
+  const uvec pg = symrcm(GS);
+  
+  REQUIRE( sp_reorder_is_permutation(pg, G.n_rows) );
+  
+  REQUIRE( sp_reorder_bandwidth(symperm(GS, pg)) <= 20 );
+  
+  // disconnected components and isolated vertices
+  
+  sp_mat C(10,10);
+  
+  C(0,5) = 1.0;  C(5,0) = 1.0;
+  C(2,7) = 1.0;  C(7,2) = 1.0;
+  C(7,9) = 1.0;  C(9,7) = 1.0;
+  
+  REQUIRE( sp_reorder_is_permutation(symrcm(C), 10) );
+  
+  REQUIRE( symrcm(sp_mat()).n_elem == 0 );
+  
+  REQUIRE_THROWS( symrcm(sp_mat(4,5)) );
+  }
+
+
+
+TEST_CASE("sp_reorder_amd")
+  {
+  const sp_mat G = sp_reorder_grid(20);
+  
+  const uword n = G.n_rows;
+  
+  const uvec p = symamd(G);
+  
+  REQUIRE( sp_reorder_is_permutation(p, n) );
+  
+  // fill-in of the Cholesky factor, from the dense factorisation of the permuted matrix
+  
+  const mat L_amd  = chol( mat(symperm(G, p       )), "lower" );
+  const mat L_rand = chol( mat(symperm(G, randperm(n))), "lower" );
+  const mat L_nat  = chol( mat(G), "lower" );
+  
+  const uword nnz_amd  = accu( abs(L_amd ) > 1e-12 );
+  const uword nnz_rand = accu( abs(L_rand) > 1e-12 );
+  const uword nnz_nat  = accu( abs(L_nat ) > 1e-12 );
+  
+  REQUIRE( nnz_amd < nnz_rand );
+  REQUIRE( nnz_amd < nnz_nat  );
+  
+  // unsymmetric structure is symmetrised
+  
+  sp_mat U = sprandu<sp_mat>(50, 50, 0.05);
+  
+  U.diag().ones();
+  
+  REQUIRE( sp_reorder_is_permutation(symamd(U), 50) );
+  
+  // a star graph: the centre is not eliminated before the leaves (it ties with the final leaf)
+  
+  sp_mat S(8,8);
+  
+  S.diag().ones();
+  
+  for(uword i=1; i < 8; ++i)  { S(0,i) = 1.0; S(i,0) = 1.0; }
+  
+  const uvec ps = symamd(S);
+  
+  REQUIRE( sp_reorder_is_permutation(ps, 8) );
+  REQUIRE( ((ps(6) == 0) || (ps(7) == 0)) );
+  
+  REQUIRE( symamd(sp_mat()).n_elem == 0 );
+  
+  REQUIRE_THROWS( symamd(sp_mat(4,5)) );
+  }
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("sp_sell_1")
+  {
+  // rows of very different lengths, so that sorting and padding are exercised
+  sp_mat A = sprandu<sp_mat>(1003, 517, 0.01);
+  
+  for(uword r=0; r < A.n_rows; r += 2)  { A(r, 7) = 2.0; }
+  for(uword c=0; c < A.n_cols; ++c)     { A(11,c) = 3.0; }
+  
+  const vec x = randu<vec>(517);
+  const mat X = randu<mat>(517, 3);
+  
+  const vec y_ref = mat(A) * x;
+  const mat Y_ref = mat(A) * X;
+  
+  for(const uword sigma : { uword(0), uword(13), uword(256), uword(5000) })
+    {
+    sp_sell<double> S(A, sigma);
+    
+    REQUIRE( S.n_rows    == A.n_rows    );
+    REQUIRE( S.n_cols    == A.n_cols    );
+    REQUIRE( S.n_nonzero == A.n_nonzero );
+    REQUIRE( S.n_stored  >= A.n_nonzero );
+    REQUIRE( (S.sigma % sp_sell<double>::chunk_size) == 0 );
+    
+    vec y;
+    mat Y;
+    
+    S.mul(y, x);
+    S.mul(Y, X);
+    
+    REQUIRE( approx_equal(y, y_ref, "reldiff", 1e-12) );
+    REQUIRE( approx_equal(Y, Y_ref, "reldiff", 1e-12) );
+    }
+  }
+
+
+
+TEST_CASE("sp_sell_2")
+  {
+  // empty rows, and a number of rows that is not a multiple of the chunk size
+  sp_cx_mat A(21, 9);
+  
+  A(0,3)  = cx_double(1.0, 2.0);
+  A(5,0)  = cx_double(3.0,-1.0);
+  A(5,8)  = cx_double(0.5, 0.5);
+  A(20,4) = cx_double(2.0, 0.0);
+  
+  const cx_vec x = randu<cx_vec>(9);
+  
+  sp_sell<cx_double> S(A);
+  
+  cx_vec y;
+  
+  S.mul(y, x);
+  
+  REQUIRE( approx_equal(y, cx_mat(A) * x, "reldiff", 1e-12) );
+  
+  sp_sell<cx_double> E;
+  
+  REQUIRE( E.n_rows   == 0 );
+  REQUIRE( E.n_stored == 0 );
+  }
+
+
+
+TEST_CASE("sp_sell_3")
+  {
+  // non-finite x(0) must only affect the rows that have a non-zero in column 0;
+  // the zero padding of shorter rows must not contribute 0*Inf = NaN
+  
+  sp_mat A(20, 6);
+  
+  A(0,0) = 1.0;
+  A(0,1) = 2.0;
+  A(0,2) = 3.0;
+  A(1,4) = 4.0;
+  A(2,0) = 5.0;
+  
+  for(uword row=3; row < 20; ++row)  { A(row, row % 6) = double(row); }
+  
+  vec x = linspace<vec>(1.0, 2.0, 6);
+  
+  x(0) = datum::inf;
+  
+  sp_sell<double> S(A);
+  
+  vec y;
+  
+  S.mul(y, x);
+  
+  const vec y_ref = A * x;
+  
+  REQUIRE( y.n_elem == 20 );
+  
+  REQUIRE( y(0) ==  datum::inf );
+  REQUIRE( y(2) ==  datum::inf );
+  
+  REQUIRE( y.has_nan() == false );
+  
+  for(uword row=0; row < 20; ++row)
+    {
+    if( (row % 6) == 0 )  { REQUIRE( y(row) == y_ref(row) ); }
+    else                  { REQUIRE( y(row) == Approx(y_ref(row)) ); }
+    }
+  }
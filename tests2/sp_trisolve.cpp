@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("sp_trisolve_1")
+  {
+  const uword N = 2000;
+  
+  sp_mat A = sprandu<sp_mat>(N, N, 0.002);
+  
+  A.diag() += 1.0;
+  
+  const sp_mat L = trimatl(A);
+  const sp_mat U = trimatu(A);
+  
+  const mat B = randu<mat>(N, 3);
+  
+  sp_trisolve<double> SL(L);
+  sp_trisolve<double> SU(U);
+  
+  REQUIRE( SL.is_lower         );
+  REQUIRE( SU.is_lower == false );
+  REQUIRE( SL.n_levels >  1     );
+  REQUIRE( SL.n_levels <= N     );
+  
+  mat XL;
+  mat XU;
+  
+  REQUIRE( SL.solve(XL, B) );
+  REQUIRE( SU.solve(XU, B) );
+  
+  REQUIRE( approx_equal(mat(L * XL), B, "reldiff", 1e-10) );
+  REQUIRE( approx_equal(mat(U * XU), B, "reldiff", 1e-10) );
+  
+  // the analysis is reused for another right-hand side, solved in place
+  
+  vec x = randu<vec>(N);
+  
+  const vec b = x;
+  
+  REQUIRE( SL.solve(x, x) );
+  
+  REQUIRE( approx_equal(vec(L * x), b, "reldiff", 1e-10) );
+  }
+
+
+
+TEST_CASE("sp_trisolve_2")
+  {
+  sp_cx_mat A = sprandu<sp_cx_mat>(50, 50, 0.1);
+  
+  A.diag() += cx_double(2.0, 1.0);
+  
+  const sp_cx_mat U = trimatu(A);
+  
+  const cx_vec b = randu<cx_vec>(50);
+  
+  sp_trisolve<cx_double> S(U);
+  
+  cx_vec x;
+  
+  REQUIRE( S.solve(x, b) );
+  
+  REQUIRE( approx_equal(cx_mat(U) * x, b, "reldiff", 1e-10) );
+  
+  // diagonal matrix
+  
+  sp_mat D(10, 10);
+  
+  D.diag().fill(4.0);
+  
+  sp_trisolve<double> SD(D);
+  
+  vec y;
+  
+  REQUIRE( SD.solve(y, ones<vec>(10)) );
+  
+  REQUIRE( SD.n_levels == 1 );
+  REQUIRE( approx_equal(y, 0.25 * ones<vec>(10), "absdiff", 1e-15) );
+  }
+
+
+
+TEST_CASE("sp_trisolve_3")
+  {
+  // zero on the diagonal
+  
+  sp_mat A(5, 5);
+  
+  A(0,0) = 1.0;
+  A(2,1) = 1.0;
+  A(4,4) = 1.0;
+  
+  sp_trisolve<double> S(A);
+  
+  vec x;
+  
+  REQUIRE( S.solve(x, ones<vec>(5)) == false );
+  REQUIRE( x.is_empty() );
+  
+  // not triangular
+  
+  sp_mat B = sprandu<sp_mat>(20, 20, 0.3);
+  
+  B(0,19) = 1.0;
+  B(19,0) = 1.0;
+  
+  REQUIRE_THROWS( sp_trisolve<double>(B) );
+  }
+
+
+
+TEST_CASE("sp_trisolve_spsolve")
+  {
+  // spsolve() detects triangular matrices and uses substitution instead of a factorisation
+  
+  sp_mat A = sprandu<sp_mat>(300, 300, 0.02);
+  
+  A.diag() += 1.0;
+  
+  const mat B = randu<mat>(300, 2);
+  
+  mat X;
+  
+  REQUIRE( spsolve(X, trimatl(A), B, "lapack") );
+  
+  REQUIRE( approx_equal(mat(trimatl(A) * X), B, "reldiff", 1e-10) );
+  
+  REQUIRE( spsolve(X, trimatu(A), B) );
+  
+  REQUIRE( approx_equal(mat(trimatu(A) * X), B, "reldiff", 1e-10) );
+  }
+
+
+
+TEST_CASE("sp_trisolve_spsolve_singular")
+  {
+  // as with the SuperLU solver without refinement, only an exact zero on the diagonal is rejected
+  
+  sp_mat A(4, 4);
+  
+  A(0,0) = 2.0;
+  A(1,1) = 4.0;
+  A(2,2) = 1e-20;
+  A(3,3) = 1.0;
+  A(3,0) = 1.0;
+  
+  const vec b(4, fill::ones);
+  
+  vec x;
+  
+  REQUIRE( spsolve(x, A, b) );
+  REQUIRE( x.n_elem == 4 );
+  REQUIRE( x(0) == Approx(0.5) );
+  REQUIRE( x(2) == Approx(1e20) );
+  REQUIRE( x(3) == Approx(0.5) );
+  
+  A(2,2) = 0.0;
+  
+  REQUIRE( spsolve(x, A, b) == false );
+  REQUIRE( x.is_empty() );
+  }
@@ -2565,6 +2565,130 @@ TEST_CASE("spmat_batch_insert_unsorted_case_zeroes")
 
 
 
+TEST_CASE("spmat_batch_insert_add_values_large_test")
+  {
+  const uword n_rows = 200;
+  const uword n_cols = 300;
+  const uword N      = 50000;
+  
+  Mat<uword> locations = join_cols( randi< Row<uword> >(N, distr_param(0, int(n_rows)-1)), randi< Row<uword> >(N, distr_param(0, int(n_cols)-1)) );
+  
+  vec values = randu<vec>(N);
+  
+  // exact cancellation at some locations, and explicit zeros
+  for(uword i=0; i < N; i += 10)  { values(i+1) = -values(i); locations(0,i+1) = locations(0,i); locations(1,i+1) = locations(1,i); }
+  for(uword i=5; i < N; i += 10)  { values(i) = 0.0; }
+  
+  mat D(n_rows, n_cols, fill::zeros);
+  
+  for(uword i=0; i < N; ++i)  { D(locations(0,i), locations(1,i)) += values(i); }
+  
+  sp_mat A(true, locations, values, n_rows, n_cols);
+  
+  REQUIRE( approx_equal(mat(A), D, "absdiff", 1e-10) );
+  
+  REQUIRE( all(nonzeros(A) != 0.0) );
+  
+  for(uword c=0; c < n_cols; ++c)
+  for(uword k=A.col_ptrs[c]+1; k < A.col_ptrs[c+1]; ++k)
+    {
+    REQUIRE( A.row_indices[k-1] < A.row_indices[k] );
+    }
+  
+  REQUIRE( A.col_ptrs[n_cols+1] == std::numeric_limits<uword>::max() );
+  
+  // taking ownership of the locations gives the same result
+  Mat<uword> locations2 = locations;
+  
+  sp_mat B(true, std::move(locations2), values, n_rows, n_cols);
+  
+  REQUIRE( locations2.n_elem == 0 );
+  REQUIRE( B.n_nonzero == A.n_nonzero );
+  REQUIRE( approx_equal(B, A, "absdiff", 0.0) );
+  }
+
+
+
+TEST_CASE("spmat_batch_insert_unsorted_large_test")
+  {
+  const uword n_rows = 300;
+  const uword n_cols = 200;
+  
+  mat D( sprandu<sp_mat>(n_rows, n_cols, 0.5) );
+  
+  const uvec indices = shuffle( find(D) );
+  
+  Mat<uword> locations = ind2sub( size(D), indices );
+  
+  const vec values = D.elem(indices);
+  
+  sp_mat A(locations, values, n_rows, n_cols);
+  
+  REQUIRE( A.n_nonzero == indices.n_elem );
+  REQUIRE( approx_equal(mat(A), D, "absdiff", 0.0) );
+  
+  sp_mat B(std::move(locations), values, n_rows, n_cols);
+  
+  REQUIRE( locations.n_elem == 0 );
+  REQUIRE( approx_equal(B, A, "absdiff", 0.0) );
+  
+  // already sorted locations
+  const uvec sorted_indices = find(D);
+  
+  sp_mat C(ind2sub(size(D), sorted_indices), D.elem(sorted_indices), n_rows, n_cols, false);
+  
+  REQUIRE( approx_equal(C, A, "absdiff", 0.0) );
+  }
+
+
+
+TEST_CASE("spmat_large_elementwise_and_transpose_test")
+  {
+  // large enough to use the parallel versions when OpenMP is enabled
+  
+  sp_mat A = sprandn<sp_mat>(400, 400, 0.1);
+  sp_mat B = sprandn<sp_mat>(400, 400, 0.1);
+  
+  B.col(7).zeros();
+  B.cols(100,120) = A.cols(100,120);
+  
+  mat dA(A);
+  mat dB(B);
+  
+  REQUIRE( approx_equal(mat(A.t()),      dA.t(),         "absdiff", 0.0) );
+  REQUIRE( approx_equal(mat(A + A.t()),  dA + dA.t(),    "absdiff", 1e-12) );
+  REQUIRE( approx_equal(mat(A + B),      dA + dB,        "absdiff", 1e-12) );
+  REQUIRE( approx_equal(mat(A - B),      dA - dB,        "absdiff", 1e-12) );
+  REQUIRE( approx_equal(mat(A % B),      dA % dB,        "absdiff", 1e-12) );
+  REQUIRE( approx_equal(mat(min(A, B)),  min(dA, dB),    "absdiff", 0.0) );
+  REQUIRE( approx_equal(mat(max(A, B)),  max(dA, dB),    "absdiff", 0.0) );
+  
+  sp_mat C = A - B;
+  
+  REQUIRE( C.n_nonzero == uword(accu(dA - dB != 0.0)) );
+  
+  for(uword c=0; c < C.n_cols; ++c)
+  for(uword k=C.col_ptrs[c]+1; k < C.col_ptrs[c+1]; ++k)
+    {
+    REQUIRE( C.row_indices[k-1] < C.row_indices[k] );
+    }
+  
+  sp_mat D = A.t();
+  
+  for(uword c=0; c < D.n_cols; ++c)
+  for(uword k=D.col_ptrs[c]+1; k < D.col_ptrs[c+1]; ++k)
+    {
+    REQUIRE( D.row_indices[k-1] < D.row_indices[k] );
+    }
+  
+  sp_cx_mat X = sprandu<sp_cx_mat>(300, 500, 0.1);
+  
+  REQUIRE( approx_equal(cx_mat(X.t()),  cx_mat(X).t(),  "absdiff", 0.0) );
+  REQUIRE( approx_equal(cx_mat(X.st()), cx_mat(X).st(), "absdiff", 0.0) );
+  }
+
+
+
 TEST_CASE("spmat_const_row_col_iterator_test")
   {
   mat X;
@@ -3194,3 +3318,74 @@ TEST_CASE("spmat_vectorise_dimension_alias")
     REQUIRE(m(i) == Approx(n(i)));
     }
   }
+
+
+
+TEST_CASE("spmat_csr_mirror_test")
+  {
+  sp_mat A = sprandu<sp_mat>(300, 200, 0.05);
+  
+  REQUIRE( A.has_csr() == false );
+  
+  const SpMat_csr<double>& A_csr = A.csr();
+  
+  REQUIRE( A.has_csr() );
+  REQUIRE( A_csr.n_rows    == A.n_rows    );
+  REQUIRE( A_csr.n_cols    == A.n_cols    );
+  REQUIRE( A_csr.n_nonzero == A.n_nonzero );
+  REQUIRE( A_csr.row_ptrs[A.n_rows] == A.n_nonzero );
+  
+  for(uword row=0; row < A.n_rows; ++row)
+  for(uword i=A_csr.row_ptrs[row]; i < A_csr.row_ptrs[row+1]; ++i)
+    {
+    REQUIRE( A_csr.values[i] == A(row, A_csr.col_indices[i]) );
+    }
+  
+  const vec x = randu<vec>(200);
+  const mat D(A);
+  
+  // row-wise multiplication and row extraction via the mirror
+  
+  vec y = A * x;
+  
+  REQUIRE( approx_equal(y, D * x, "reldiff", 1e-12) );
+  
+  sp_rowvec r = A.row(17);
+  sp_mat    s = A(span(42,42), span(30,150));
+  
+  REQUIRE( approx_equal(rowvec(r), D.row(17),                    "absdiff", 0.0) );
+  REQUIRE( approx_equal(mat(s),    D(span(42,42), span(30,150)), "absdiff", 0.0) );
+  
+  // the mirror is discarded when the matrix is modified
+  
+  A(5,5) = 123.0;
+  
+  REQUIRE( A.has_csr() == false );
+  
+  A.csr();
+  
+  A *= 2.0;
+  
+  REQUIRE( A.has_csr() == false );
+  
+  A.csr();
+  
+  y = A * x;
+  
+  mat D2(A);
+  
+  REQUIRE( D2(5,5) == 246.0 );
+  REQUIRE( approx_equal(y, D2 * x, "reldiff", 1e-12) );
+  
+  // copies do not share the mirror
+  
+  sp_mat B(A);
+  
+  REQUIRE( A.has_csr() );
+  REQUIRE( B.has_csr() == false );
+  
+  sp_mat C(std::move(A));
+  
+  REQUIRE( A.has_csr() == false );
+  REQUIRE( approx_equal(C, B, "absdiff", 0.0) );
+  }
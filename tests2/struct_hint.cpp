@@ -0,0 +1,308 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+
+TEST_CASE("struct_hint_set_and_reset")
+  {
+  mat A(10, 10, fill::randu);
+  
+  REQUIRE( A.get_hint() == struct_hint::none );
+  
+  A.set_hint(struct_hint::sympd);
+  
+  REQUIRE( A.get_hint() == struct_hint::sympd );
+  
+  // copies carry the hint
+  
+  mat B = A;
+  
+  REQUIRE( B.get_hint() == struct_hint::sympd );
+  
+  // reading through a const reference keeps the hint
+  
+  const mat& A_ref = A;
+  
+  const double val = A_ref(1,2);
+  
+  REQUIRE( val == A_ref.at(1,2) );
+  REQUIRE( A.get_hint() == struct_hint::sympd );
+  
+  // any potential modification discards the hint
+  
+  A(1,2) = 1.0;
+  
+  REQUIRE( A.get_hint() == struct_hint::none );
+  
+  B.col(3).zeros();
+  
+  REQUIRE( B.get_hint() == struct_hint::none );
+  
+  B.set_hint(struct_hint::triu);
+  
+  B.diag() += 1.0;
+  
+  REQUIRE( B.get_hint() == struct_hint::none );
+  
+  B.set_hint(struct_hint::tril);
+  
+  B += 1.0;
+  
+  REQUIRE( B.get_hint() == struct_hint::none );
+  
+  B.set_hint(struct_hint::tril);
+  
+  B.set_size(5,5);
+  
+  REQUIRE( B.get_hint() == struct_hint::none );
+  
+  // band hint with bandwidths
+  
+  A.set_hint(struct_hint::band, 2, 3);
+  
+  uword KL = 0;
+  uword KU = 0;
+  
+  REQUIRE( A.get_hint(KL, KU) == struct_hint::band );
+  REQUIRE( KL == 2 );
+  REQUIRE( KU == 3 );
+  
+  // swap exchanges the hints along with the elements
+  
+  mat C(10, 10, fill::randu);
+  
+  A.swap(C);
+  
+  REQUIRE( A.get_hint() == struct_hint::none );
+  REQUIRE( C.get_hint() == struct_hint::band );
+  
+  C.reset_hint();
+  
+  REQUIRE( C.get_hint() == struct_hint::none );
+  
+  // fixed size matrices
+  
+  mat44 F(fill::randu);
+  
+  F.set_hint(struct_hint::sym);
+  
+  F(0,1) = 0.0;
+  
+  REQUIRE( F.get_hint() == struct_hint::none );
+  
+  // vectors don't keep hints
+  
+  vec x(1, fill::ones);
+  
+  x.set_hint(struct_hint::sympd);
+  
+  REQUIRE( x.get_hint() == struct_hint::none );
+  }
+
+
+
+TEST_CASE("struct_hint_solve")
+  {
+  const uword N = 60;
+  
+  mat X(N, N, fill::randu);
+  
+  mat A = X.t()*X + N*eye(N,N);  // sympd
+  mat U = trimatu(X) + N*eye(N,N);
+  mat L = trimatl(X) + N*eye(N,N);
+  
+  mat T = toeplitz( join_cols(vec{4.0, 1.0, 0.5}, zeros(N-3)) );  // symmetric with 2 sub- and super-diagonals
+  
+  mat B(N, 3, fill::randu);
+  
+  const mat XA = solve(A, B);
+  const mat XU = solve(U, B);
+  const mat XL = solve(L, B);
+  const mat XT = solve(T, B);
+  
+  // detections are not recorded
+  
+  REQUIRE( A.get_hint() == struct_hint::none );
+  REQUIRE( U.get_hint() == struct_hint::none );
+  REQUIRE( L.get_hint() == struct_hint::none );
+  REQUIRE( T.get_hint() == struct_hint::none );
+  
+  A.set_hint(struct_hint::sympd);
+  U.set_hint(struct_hint::triu);
+  L.set_hint(struct_hint::tril);
+  T.set_hint(struct_hint::band, 2, 2);
+  
+  // solutions via hints match the solutions via detection
+  
+  REQUIRE( approx_equal(solve(A, B), XA, "reldiff", 1e-12) );
+  REQUIRE( approx_equal(solve(U, B), XU, "reldiff", 1e-12) );
+  REQUIRE( approx_equal(solve(L, B), XL, "reldiff", 1e-12) );
+  REQUIRE( approx_equal(solve(T, B), XT, "reldiff", 1e-12) );
+  
+  REQUIRE( approx_equal(solve(A, B, solve_opts::fast),    XA, "reldiff", 1e-10) );
+  REQUIRE( approx_equal(solve(T, B, solve_opts::refine),  XT, "reldiff", 1e-10) );
+  REQUIRE( approx_equal(solve(U, B, solve_opts::no_band), XU, "reldiff", 1e-10) );
+  
+  // a wrong sympd hint falls back to the general solver
+  
+  mat G = X + N*eye(N,N);
+  
+  G(0,0) = -1.0;
+  
+  const mat XG = solve(G, B);
+  
+  G.set_hint(struct_hint::sympd);
+  
+  REQUIRE( approx_equal(solve(G, B), XG, "reldiff", 1e-10) );
+  REQUIRE( approx_equal(G*XG, B, "absdiff", 1e-10) );
+  
+  // in-place solve discards the hint
+  
+  mat Y = U;
+  
+  Y = solve(Y, B.col(0));
+  
+  REQUIRE( Y.get_hint() == struct_hint::none );
+  }
+
+
+
+TEST_CASE("struct_hint_inv_det")
+  {
+  const uword N = 40;
+  
+  mat X(N, N, fill::randu);
+  
+  mat A = X.t()*X + N*eye(N,N);
+  mat U = trimatu(X) + eye(N,N);
+  
+  const mat    iA = inv(A);
+  const double dA = det(A);
+  const double lA = log_det_sympd(A);
+  
+  A.set_hint(struct_hint::sympd);
+  
+  REQUIRE( approx_equal(inv(A), iA, "reldiff", 1e-10) );
+  
+  REQUIRE( det(A) == Approx(dA).epsilon(1e-10) );
+  
+  double val  = 0.0;
+  double sign = 0.0;
+  
+  log_det(val, sign, A);
+  
+  REQUIRE( val  == Approx(lA).epsilon(1e-10) );
+  REQUIRE( sign == 1.0 );
+  
+  const double dU = det(U);
+  
+  REQUIRE( U.get_hint() == struct_hint::none );
+  
+  U.set_hint(struct_hint::triu);
+  
+  REQUIRE( dU == Approx(prod(U.diag())).epsilon(1e-10) );
+  REQUIRE( det(U) == Approx(dU).epsilon(1e-10) );
+  
+  REQUIRE( approx_equal(inv(U)*U, eye(N,N), "absdiff", 1e-10) );
+  
+  // in-place inverse
+  
+  mat V = U;
+  
+  V = inv(V);
+  
+  REQUIRE( V.get_hint() == struct_hint::none );
+  REQUIRE( approx_equal(V*U, eye(N,N), "absdiff", 1e-10) );
+  
+  // complex
+  
+  cx_mat C(N, N, fill::randu);
+  
+  cx_mat P = C.t()*C + N*eye<cx_mat>(N,N);
+  
+  const cx_double dP = det(P);
+  
+  P.set_hint(struct_hint::sympd);
+  
+  REQUIRE( std::abs(det(P) - dP) < 1e-8 * std::abs(dP) );
+  REQUIRE( approx_equal(inv(P)*P, eye<cx_mat>(N,N), "absdiff", 1e-10) );
+  }
+
+
+
+TEST_CASE("struct_hint_modification_after_solve")
+  {
+  const uword N = 20;
+  
+  mat X(N, N, fill::randu);
+  
+  vec b(N, fill::randu);
+  
+  // modification through a previously obtained pointer
+  
+    {
+    mat A = trimatu(X) + N*eye(N,N);
+    
+    double* p = A.memptr();
+    
+    vec x1 = solve(A, b);
+    
+    p[5] = 3.0;
+    
+    vec x2 = solve(A, b);
+    
+    REQUIRE( norm(A*x2 - b) < 1e-12 );
+    }
+  
+  // modification through a previously obtained subview
+  
+    {
+    mat A = trimatu(X) + N*eye(N,N);
+    
+    subview<double> S = A.submat(0, 0, N-1, N-1);
+    
+    vec x1 = solve(A, b);
+    
+    S(N-1, 0) = 3.0;
+    
+    vec x2 = solve(A, b);
+    
+    REQUIRE( norm(A*x2 - b) < 1e-12 );
+    }
+  
+  // modification through a matrix sharing the memory
+  
+    {
+    mat A = trimatu(X) + N*eye(N,N);
+    
+    mat A_alias(A.memptr(), N, N, false, true);
+    
+    vec x1 = solve(A_alias, b);
+    
+    A(N-1, 0) = 3.0;
+    
+    vec x2 = solve(A_alias, b);
+    
+    REQUIRE( norm(A_alias*x2 - b) < 1e-12 );
+    }
+  }